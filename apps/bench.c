@@ -0,0 +1,703 @@
+// apps/bench.c
+//
+// Benchmark harness. Every case generates a fixed number of bytes per
+// repetition; after warm-up repetitions the harness reports the median, p99
+// and minimum time per item over all repetitions, plus GB/s and cycles/byte
+// from the median run.
+//
+// "latency" cases make one library call per item, so each result waits for
+// the previous state update. "throughput" cases fill a cache-resident buffer
+// and show what the generator sustains when the caller batches.
+//
+// Usage: bench [--reps N] [--warmup N] [--bytes N[K|M|G]] [--pin CPU]
+//              [--filter SUBSTRING] [--format text|json|csv]
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+
+#include "cromulent.h"
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define HAVE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+#if defined(__VERSION__)
+#define COMPILER __VERSION__
+#else
+#define COMPILER "unknown"
+#endif
+
+#define SEED 69420
+#define BUF_WORDS 8192 // 64 KiB, stays in L2
+#define MAX_CASES 128
+#define MAX_REPS 1000
+
+// Sink for results so the compiler cannot drop the generator calls
+static volatile uint64_t sink;
+static uint64_t buf[BUF_WORDS];
+
+typedef struct bench_case bench_case;
+
+struct bench_case {
+  char name[48];
+  const char *mode;       // "latency" or "throughput"
+  int backend;            // cromulent_backend to select, or -1
+  unsigned item_bytes;    // bytes produced per item
+  size_t step;            // items per call of a fill case; counts round to it
+  const CromulentPRNG2 *gen;
+  uint64_t (*run)(const bench_case *c, size_t items);
+};
+
+typedef struct {
+  double ns_median, ns_p99, ns_min; // per item
+  double cycles_median;             // per item, 0 when unavailable
+} bench_result;
+
+static uint64_t read_tsc(void) {
+#if HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Cases ----------------------------------------------------------------------
+
+static uint64_t run_v2_next(const bench_case *c, size_t items) {
+  uint64_t state[16], acc = 0;
+  c->gen->init(state, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += c->gen->next(state);
+  return acc;
+}
+
+static uint64_t run_v2_fill(const bench_case *c, size_t items) {
+  uint64_t state[16], acc = 0;
+  c->gen->init(state, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    c->gen->fill(state, buf, BUF_WORDS);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static uint64_t run_next(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  uint64_t acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_next(&st);
+  return acc;
+}
+
+static uint64_t run_double(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  double acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_double(&st);
+  return (uint64_t)acc;
+}
+
+static uint64_t run_float(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  float acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_float(&st);
+  return (uint64_t)acc;
+}
+
+static uint64_t run_normal(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  double acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_normal(&st);
+  return (uint64_t)(int64_t)acc;
+}
+
+static uint64_t run_exponential(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  double acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_exponential(&st);
+  return (uint64_t)acc;
+}
+
+static uint64_t run_range_small(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  uint64_t acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_range(&st, 1000003);
+  return acc;
+}
+
+// n just above 2^63 rejects almost half of all draws
+static uint64_t run_range_worst(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_state st;
+  uint64_t acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_range(&st, (1ULL << 63) + 1);
+  return acc;
+}
+
+// 4096 categories with Zipf-like weights, built on first use
+#define ALIAS_CATEGORIES 4096
+static cromulent_alias_entry alias_entries[ALIAS_CATEGORIES];
+static cromulent_alias alias_table;
+
+static const cromulent_alias *bench_alias(void) {
+  if (alias_table.n == 0) {
+    static double weights[ALIAS_CATEGORIES];
+    for (size_t i = 0; i < ALIAS_CATEGORIES; i++)
+      weights[i] = 1.0 / (double)(i + 1);
+    cromulent_alias_init(&alias_table, alias_entries, weights,
+                         ALIAS_CATEGORIES);
+  }
+  return &alias_table;
+}
+
+static uint64_t run_alias_sample(const bench_case *c, size_t items) {
+  (void)c;
+  const cromulent_alias *t = bench_alias();
+  cromulent_state st;
+  uint64_t acc = 0;
+  cromulent_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_alias_sample(t, &st);
+  return acc;
+}
+
+static uint64_t run_tls_next(const bench_case *c, size_t items) {
+  (void)c;
+  uint64_t acc = 0;
+  cromulent_tls_seed(SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_tls_next();
+  return acc;
+}
+
+static uint64_t run_x4_fill(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_x4_state st;
+  uint64_t acc = 0;
+  cromulent_x4_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_x4_fill(&st, buf, BUF_WORDS / 4);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static uint64_t run_fill_u64(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_bulk_state st;
+  uint64_t acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_fill_u64(&st, buf, BUF_WORDS);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static uint64_t run_strong_next(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_strong_state st;
+  uint64_t acc = 0;
+  cromulent_strong_init(&st, SEED);
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_strong_next(&st);
+  return acc;
+}
+
+static uint64_t run_strong_fill_u64(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_strong_bulk_state st;
+  uint64_t acc = 0;
+  cromulent_strong_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_strong_fill_u64(&st, buf, BUF_WORDS);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static uint64_t run_at(const bench_case *c, size_t items) {
+  (void)c;
+  uint64_t acc = 0;
+  for (size_t i = 0; i < items; i++)
+    acc += cromulent_at(SEED, i);
+  return acc;
+}
+
+static uint64_t run_at_range(const bench_case *c, size_t items) {
+  (void)c;
+  uint64_t acc = 0;
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_at_range(SEED, done, buf, BUF_WORDS);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static uint64_t run_fill_bytes(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_bulk_state st;
+  uint64_t acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_fill_bytes(&st, buf, sizeof buf);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static double dbuf[BUF_WORDS];
+static float fbuf[2 * BUF_WORDS];
+
+static uint64_t run_fill_double(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_bulk_state st;
+  double acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_fill_double(&st, dbuf, BUF_WORDS);
+    acc += dbuf[done % BUF_WORDS];
+  }
+  return (uint64_t)acc;
+}
+
+static uint64_t run_fill_float(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_bulk_state st;
+  float acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += 2 * BUF_WORDS) {
+    cromulent_fill_float(&st, fbuf, 2 * BUF_WORDS);
+    acc += fbuf[done % BUF_WORDS];
+  }
+  return (uint64_t)acc;
+}
+
+static uint64_t run_fill_normal(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_bulk_state st;
+  double acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_fill_normal(&st, dbuf, BUF_WORDS);
+    acc += dbuf[done % BUF_WORDS];
+  }
+  return (uint64_t)(int64_t)acc;
+}
+
+static uint64_t run_fill_exponential(const bench_case *c, size_t items) {
+  (void)c;
+  cromulent_bulk_state st;
+  double acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_fill_exponential(&st, dbuf, BUF_WORDS);
+    acc += dbuf[done % BUF_WORDS];
+  }
+  return (uint64_t)acc;
+}
+
+// Same bounds as the range_small / range_worst latency cases
+static uint64_t run_fill_range(uint64_t n, size_t items) {
+  cromulent_bulk_state st;
+  uint64_t acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_fill_range(&st, n, buf, BUF_WORDS);
+    acc ^= buf[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+static uint64_t run_fill_range_small(const bench_case *c, size_t items) {
+  (void)c;
+  return run_fill_range(1000003, items);
+}
+
+static uint64_t run_fill_range_worst(const bench_case *c, size_t items) {
+  (void)c;
+  return run_fill_range((1ULL << 63) + 1, items);
+}
+
+static uint64_t run_fill_alias(const bench_case *c, size_t items) {
+  (void)c;
+  const cromulent_alias *t = bench_alias();
+  static uint32_t out[BUF_WORDS];
+  cromulent_bulk_state st;
+  uint64_t acc = 0;
+  cromulent_bulk_init(&st, SEED);
+  for (size_t done = 0; done < items; done += BUF_WORDS) {
+    cromulent_alias_fill(t, &st, out, BUF_WORDS);
+    acc += out[done % BUF_WORDS];
+  }
+  return acc;
+}
+
+// Case table -----------------------------------------------------------------
+
+static bench_case cases[MAX_CASES];
+static size_t case_count;
+
+static bench_case *add_case(const char *name, const char *mode,
+                            unsigned item_bytes,
+                            uint64_t (*run)(const bench_case *, size_t)) {
+  if (case_count == MAX_CASES) {
+    fprintf(stderr, "bench: more than %d cases; raise MAX_CASES\n",
+            MAX_CASES);
+    exit(1);
+  }
+  bench_case *c = &cases[case_count++];
+  snprintf(c->name, sizeof c->name, "%s", name);
+  c->mode = mode;
+  c->backend = -1;
+  c->item_bytes = item_bytes;
+  c->step = BUF_WORDS;
+  c->gen = NULL;
+  c->run = run;
+  return c;
+}
+
+static void build_cases(void) {
+  add_case("cromulent128/next", "latency", 8, run_next);
+  add_case("cromulent128/double", "latency", 8, run_double);
+  add_case("cromulent128/float", "latency", 4, run_float);
+  add_case("cromulent128/normal", "latency", 8, run_normal);
+  add_case("cromulent128/exponential", "latency", 8, run_exponential);
+  add_case("cromulent128/range_small", "latency", 8, run_range_small);
+  add_case("cromulent128/range_worst", "latency", 8, run_range_worst);
+  add_case("cromulent128/alias_sample", "latency", 8, run_alias_sample);
+  add_case("cromulent128/tls_next", "latency", 8, run_tls_next);
+  add_case("cromulent128/x4_fill", "throughput", 8, run_x4_fill);
+  add_case("strong/next", "latency", 8, run_strong_next);
+  add_case("counter/at", "latency", 8, run_at);
+
+  static const cromulent_backend backends[] = {
+      CROMULENT_BACKEND_SCALAR, CROMULENT_BACKEND_AVX2,
+      CROMULENT_BACKEND_AVX512, CROMULENT_BACKEND_NEON};
+  for (size_t i = 0; i < sizeof backends / sizeof backends[0]; i++) {
+    if (!cromulent_backend_supported(backends[i]))
+      continue;
+    bench_case *c = add_case("bulk/fill_u64", "throughput", 8, run_fill_u64);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_bytes", "throughput", 8, run_fill_bytes);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_double", "throughput", 8, run_fill_double);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_float", "throughput", 4, run_fill_float);
+    c->backend = backends[i];
+    c->step = 2 * BUF_WORDS;
+    c = add_case("bulk/fill_normal", "throughput", 8, run_fill_normal);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_exponential", "throughput", 8,
+                 run_fill_exponential);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_range_small", "throughput", 8,
+                 run_fill_range_small);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_range_worst", "throughput", 8,
+                 run_fill_range_worst);
+    c->backend = backends[i];
+    c = add_case("bulk/fill_alias", "throughput", 8, run_fill_alias);
+    c->backend = backends[i];
+    c = add_case("strong/fill_u64", "throughput", 8, run_strong_fill_u64);
+    c->backend = backends[i];
+    c = add_case("counter/at_range", "throughput", 8, run_at_range);
+    c->backend = backends[i];
+  }
+
+  size_t n = 0;
+  const CromulentPRNG2 *list = cromulent_registry_v2_all(&n);
+  for (size_t i = 0; i < n; i++) {
+    char name[48];
+    if (list[i].state_size > 16 * sizeof(uint64_t))
+      continue;
+    snprintf(name, sizeof name, "registry/%s/next", list[i].name);
+    bench_case *c = add_case(name, "latency", 8, run_v2_next);
+    c->gen = &list[i];
+    snprintf(name, sizeof name, "registry/%s/fill", list[i].name);
+    c = add_case(name, "throughput", 8, run_v2_fill);
+    c->gen = &list[i];
+  }
+}
+
+// Measurement ----------------------------------------------------------------
+
+static int compare_double(const void *a, const void *b) {
+  const double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of a sorted array
+static double percentile(const double *sorted, int n, double p) {
+  int rank = (int)(p / 100.0 * n + 0.999999);
+  if (rank < 1)
+    rank = 1;
+  if (rank > n)
+    rank = n;
+  return sorted[rank - 1];
+}
+
+static bench_result measure(const bench_case *c, size_t items, int warmup,
+                            int reps) {
+  static double ns[MAX_REPS], cycles[MAX_REPS];
+  bench_result r;
+
+  for (int i = 0; i < warmup; i++)
+    sink ^= c->run(c, items);
+
+  for (int i = 0; i < reps; i++) {
+    const uint64_t c0 = read_tsc();
+    const double t0 = now_ns();
+    sink ^= c->run(c, items);
+    const double t1 = now_ns();
+    const uint64_t c1 = read_tsc();
+    ns[i] = (t1 - t0) / items;
+    cycles[i] = (double)(c1 - c0) / items;
+  }
+
+  qsort(ns, reps, sizeof ns[0], compare_double);
+  qsort(cycles, reps, sizeof cycles[0], compare_double);
+  r.ns_median = percentile(ns, reps, 50);
+  r.ns_p99 = percentile(ns, reps, 99);
+  r.ns_min = ns[0];
+  r.cycles_median = HAVE_TSC ? percentile(cycles, reps, 50) : 0;
+  return r;
+}
+
+// Output ---------------------------------------------------------------------
+
+enum { FORMAT_TEXT, FORMAT_JSON, FORMAT_CSV };
+
+static const char *backend_label(const bench_case *c) {
+  if (c->backend < 0)
+    return "-";
+  return cromulent_backend_name((cromulent_backend)c->backend);
+}
+
+// A JSON string literal: quotes, backslashes and control characters escaped
+static void print_json_string(const char *s) {
+  putchar('"');
+  for (; *s; s++) {
+    const unsigned char ch = (unsigned char)*s;
+    if (ch == '"' || ch == '\\')
+      printf("\\%c", ch);
+    else if (ch < 0x20)
+      printf("\\u%04x", ch);
+    else
+      putchar(ch);
+  }
+  putchar('"');
+}
+
+static void print_header(int format, int reps, int warmup, size_t bytes) {
+  switch (format) {
+  case FORMAT_JSON:
+    printf("{\n  \"compiler\": ");
+    print_json_string(COMPILER);
+    printf(",\n  \"reps\": %d,\n  \"warmup\": %d,\n"
+           "  \"bytes\": %zu,\n  \"cycle_counter\": \"%s\",\n"
+           "  \"results\": [\n",
+           reps, warmup, bytes, HAVE_TSC ? "rdtsc" : "none");
+    break;
+  case FORMAT_CSV:
+    puts("name,mode,backend,item_bytes,reps,ns_per_item_median,"
+         "ns_per_item_p99,ns_per_item_min,gb_per_s,cycles_per_byte");
+    break;
+  default:
+    printf("%d reps after %d warm-up, %zu bytes per rep, cycles from %s\n",
+           reps, warmup, bytes, HAVE_TSC ? "rdtsc" : "(unavailable)");
+    printf("%-32s %-10s %-7s %9s %9s %9s %8s %8s\n", "case", "mode",
+           "backend", "ns/item", "p99", "min", "GB/s", "cyc/B");
+  }
+}
+
+static void print_result(int format, const bench_case *c,
+                         const bench_result *r, int reps, int first) {
+  const double gbps = c->item_bytes / r->ns_median;
+  const double cpb = r->cycles_median / c->item_bytes;
+
+  switch (format) {
+  case FORMAT_JSON:
+    printf("%s    {\"name\": ", first ? "" : ",\n");
+    print_json_string(c->name);
+    printf(", \"mode\": ");
+    print_json_string(c->mode);
+    printf(", \"backend\": ");
+    print_json_string(backend_label(c));
+    printf(", \"item_bytes\": %u, \"reps\": %d, \"ns_per_item\": "
+           "{\"median\": %.4f, \"p99\": %.4f, \"min\": %.4f}, "
+           "\"gb_per_s\": %.4f, \"cycles_per_byte\": ",
+           c->item_bytes, reps, r->ns_median, r->ns_p99, r->ns_min, gbps);
+    if (HAVE_TSC)
+      printf("%.4f}", cpb);
+    else
+      printf("null}");
+    break;
+  case FORMAT_CSV:
+    printf("%s,%s,%s,%u,%d,%.4f,%.4f,%.4f,%.4f,", c->name, c->mode,
+           backend_label(c), c->item_bytes, reps, r->ns_median, r->ns_p99,
+           r->ns_min, gbps);
+    if (HAVE_TSC)
+      printf("%.4f", cpb);
+    printf("\n");
+    break;
+  default:
+    printf("%-32s %-10s %-7s %9.3f %9.3f %9.3f %8.2f %8.3f\n", c->name,
+           c->mode, backend_label(c), r->ns_median, r->ns_p99, r->ns_min, gbps,
+           cpb);
+  }
+  fflush(stdout);
+}
+
+static void print_footer(int format) {
+  if (format == FORMAT_JSON)
+    printf("\n  ]\n}\n");
+}
+
+// Command line ---------------------------------------------------------------
+
+static size_t parse_size(const char *s) {
+  char *end;
+  size_t v = (size_t)strtoull(s, &end, 10);
+  switch (*end) {
+  case 'G':
+  case 'g':
+    v <<= 10; // fall through
+  case 'M':
+  case 'm':
+    v <<= 10; // fall through
+  case 'K':
+  case 'k':
+    v <<= 10;
+  }
+  return v;
+}
+
+static int pin_to_cpu(int cpu) {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return sched_setaffinity(0, sizeof set, &set);
+#else
+  (void)cpu;
+  return -1;
+#endif
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--reps N] [--warmup N] [--bytes N[K|M|G]] [--pin CPU]\n"
+          "          [--filter SUBSTRING] [--format text|json|csv]\n",
+          argv0);
+}
+
+int main(int argc, char **argv) {
+  int reps = 21, warmup = 3, format = FORMAT_TEXT;
+  size_t bytes = 64 << 20;
+  const char *filter = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!val) {
+      usage(argv[0]);
+      return 1;
+    }
+    if (strcmp(arg, "--reps") == 0)
+      reps = atoi(val);
+    else if (strcmp(arg, "--warmup") == 0)
+      warmup = atoi(val);
+    else if (strcmp(arg, "--bytes") == 0)
+      bytes = parse_size(val);
+    else if (strcmp(arg, "--filter") == 0)
+      filter = val;
+    else if (strcmp(arg, "--pin") == 0) {
+      if (pin_to_cpu(atoi(val)) != 0)
+        fprintf(stderr, "warning: could not pin to CPU %s\n", val);
+    } else if (strcmp(arg, "--format") == 0) {
+      if (strcmp(val, "json") == 0)
+        format = FORMAT_JSON;
+      else if (strcmp(val, "csv") == 0)
+        format = FORMAT_CSV;
+      else if (strcmp(val, "text") == 0)
+        format = FORMAT_TEXT;
+      else {
+        usage(argv[0]);
+        return 1;
+      }
+    } else {
+      usage(argv[0]);
+      return 1;
+    }
+    i++;
+  }
+  if (reps < 1 || reps > MAX_REPS || warmup < 0 || bytes < sizeof buf) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  build_cases();
+  const cromulent_backend original = cromulent_backend_active();
+
+  print_header(format, reps, warmup, bytes);
+  int first = 1;
+  for (size_t i = 0; i < case_count; i++) {
+    const bench_case *c = &cases[i];
+    if (filter && !strstr(c->name, filter))
+      continue;
+    if (c->backend >= 0)
+      cromulent_backend_select((cromulent_backend)c->backend);
+
+    // Whole buffers, so that fill cases write exactly `items` items
+    size_t items = bytes / c->item_bytes;
+    items -= items % c->step;
+    if (items == 0)
+      items = c->step;
+    const bench_result r = measure(c, items, warmup, reps);
+    print_result(format, c, &r, reps, first);
+    first = 0;
+
+    cromulent_backend_select(original);
+  }
+  print_footer(format);
+  return 0;
+}
@@ -0,0 +1,136 @@
+// apps/bench_alias.cpp
+//
+// Weighted choice from a fixed categorical distribution: binary search over a
+// CDF with cromulent_double and std::discrete_distribution driven by
+// cromulent::engine, against the alias-table samplers, one call per draw and
+// bulk.
+//
+//   bench_alias [samples] [categories]
+
+#include "cromulent.hpp"
+
+#include "cromulent.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t kSeed = 69420;
+constexpr std::size_t kBufferValues = 8192;
+
+template <class F> double ns_per_value(std::uint64_t samples, F &&run) {
+  const auto start = std::chrono::steady_clock::now();
+  const std::uint64_t sink = run();
+  const auto end = std::chrono::steady_clock::now();
+  // Keep the result alive without printing it in the table.
+  volatile std::uint64_t keep = sink;
+  (void)keep;
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(samples);
+}
+
+void report(const char *name, double ns) {
+  std::printf("%-34s: %6.2f ns/value, %7.1f M/s\n", name, ns, 1e3 / ns);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::uint64_t samples = 100000000;
+  std::size_t categories = 4096;
+  if (argc > 1)
+    samples = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2)
+    categories = std::strtoull(argv[2], nullptr, 10);
+  samples -= samples % kBufferValues;
+  if (samples == 0)
+    samples = kBufferValues;
+  if (categories == 0)
+    categories = 1;
+
+  // Zipf-like weights
+  std::vector<double> weights(categories);
+  for (std::size_t i = 0; i < categories; ++i)
+    weights[i] = 1.0 / static_cast<double>(i + 1);
+
+  std::printf("%llu samples over %zu categories with seed %llu, bulk backend "
+              "%s\n",
+              static_cast<unsigned long long>(samples), categories,
+              static_cast<unsigned long long>(kSeed),
+              cromulent_backend_name(cromulent_backend_active()));
+
+  std::vector<double> cdf(categories);
+  std::partial_sum(weights.begin(), weights.end(), cdf.begin());
+  for (double &c : cdf)
+    c /= cdf.back();
+  report("cdf search + cromulent_double", ns_per_value(samples, [&] {
+           cromulent_state st;
+           cromulent_init(&st, kSeed);
+           std::uint64_t acc = 0;
+           for (std::uint64_t i = 0; i < samples; ++i) {
+             const double u = cromulent_double(&st);
+             acc += static_cast<std::uint64_t>(
+                 std::upper_bound(cdf.begin(), cdf.end() - 1, u) -
+                 cdf.begin());
+           }
+           return acc;
+         }));
+
+  report("std::discrete_distribution", ns_per_value(samples, [&] {
+           cromulent::engine rng(kSeed);
+           std::discrete_distribution<int> dist(weights.begin(),
+                                                weights.end());
+           std::uint64_t acc = 0;
+           for (std::uint64_t i = 0; i < samples; ++i)
+             acc += static_cast<std::uint64_t>(dist(rng));
+           return acc;
+         }));
+
+  report("cromulent::alias_distribution", ns_per_value(samples, [&] {
+           cromulent::engine rng(kSeed);
+           cromulent::alias_distribution<int> dist(weights.begin(),
+                                                   weights.end());
+           std::uint64_t acc = 0;
+           for (std::uint64_t i = 0; i < samples; ++i)
+             acc += static_cast<std::uint64_t>(dist(rng));
+           return acc;
+         }));
+
+  std::vector<cromulent_alias_entry> entries(categories);
+  cromulent_alias table;
+  if (cromulent_alias_init(&table, entries.data(), weights.data(),
+                           categories) != 0) {
+    std::fprintf(stderr, "cromulent_alias_init failed\n");
+    return 1;
+  }
+
+  report("cromulent_alias_sample", ns_per_value(samples, [&] {
+           cromulent_state st;
+           cromulent_init(&st, kSeed);
+           std::uint64_t acc = 0;
+           for (std::uint64_t i = 0; i < samples; ++i)
+             acc += cromulent_alias_sample(&table, &st);
+           return acc;
+         }));
+
+  std::vector<std::uint32_t> buf(kBufferValues);
+  report("cromulent_alias_fill", ns_per_value(samples, [&] {
+           cromulent_bulk_state st;
+           cromulent_bulk_init(&st, kSeed);
+           std::uint64_t acc = 0;
+           for (std::uint64_t done = 0; done < samples;
+                done += kBufferValues) {
+             cromulent_alias_fill(&table, &st, buf.data(), buf.size());
+             acc += buf[done % kBufferValues];
+           }
+           return acc;
+         }));
+  return 0;
+}
@@ -0,0 +1,111 @@
+// apps/bench_inline.c
+//
+// Library calls against cromulent_inline.h in consumer loops that do a little
+// work per draw: a Monte Carlo estimate of pi (two doubles per iteration), a
+// histogram of die rolls (cromulent_range), and jittering an array with
+// floats. Both forms produce the same values, which the benchmark checks bit
+// for bit.
+//
+// Usage: bench_inline [iterations]
+
+#include "cromulent_inline.h"
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_ITERS 200000000ULL
+#define SEED 69420
+#define JITTER_WORDS 4096
+
+static double elapsed_ns(const struct timespec *start,
+                         const struct timespec *end) {
+  return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+static float jitter_buf[JITTER_WORDS];
+
+// One function per loop and form, so each is compiled the way a consumer
+// would write it: the draw function named directly in the loop body.
+#define DEFINE_LOOPS(form, next_double, next_range, next_float)                \
+  static uint64_t pi_##form(uint64_t iters) {                                  \
+    cromulent_state st;                                                        \
+    cromulent_init(&st, SEED);                                                 \
+    uint64_t hits = 0;                                                         \
+    for (uint64_t i = 0; i < iters; i++) {                                     \
+      const double x = next_double(&st);                                       \
+      const double y = next_double(&st);                                       \
+      hits += x * x + y * y < 1.0;                                             \
+    }                                                                          \
+    return hits;                                                               \
+  }                                                                            \
+  static uint64_t dice_##form(uint64_t iters) {                                \
+    cromulent_state st;                                                        \
+    cromulent_init(&st, SEED);                                                 \
+    uint64_t counts[6] = {0};                                                  \
+    for (uint64_t i = 0; i < iters; i++)                                       \
+      counts[next_range(&st, 6)]++;                                            \
+    return counts[0] * 3 + counts[5];                                          \
+  }                                                                            \
+  static uint64_t jitter_##form(uint64_t iters) {                              \
+    cromulent_state st;                                                        \
+    cromulent_init(&st, SEED);                                                 \
+    for (size_t i = 0; i < JITTER_WORDS; i++)                                  \
+      jitter_buf[i] = 0.0f;                                                    \
+    for (uint64_t i = 0; i < iters; i++)                                       \
+      jitter_buf[i % JITTER_WORDS] += next_float(&st) - 0.5f;                  \
+    uint64_t bits = 0;                                                         \
+    for (size_t i = 0; i < JITTER_WORDS; i++) {                                \
+      uint32_t word;                                                           \
+      memcpy(&word, &jitter_buf[i], sizeof word);                              \
+      bits = bits * 31 + word;                                                 \
+    }                                                                          \
+    return bits;                                                               \
+  }
+
+DEFINE_LOOPS(called, cromulent_double, cromulent_range, cromulent_float)
+DEFINE_LOOPS(inlined, cromulent_double_inline, cromulent_range_inline,
+             cromulent_float_inline)
+
+static int run(const char *name, uint64_t (*called)(uint64_t),
+               uint64_t (*inlined)(uint64_t), uint64_t iters) {
+  struct timespec start, mid, end;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  const uint64_t a = called(iters);
+  clock_gettime(CLOCK_MONOTONIC, &mid);
+  const uint64_t b = inlined(iters);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  const double ns_called = elapsed_ns(&start, &mid) / (double)iters;
+  const double ns_inlined = elapsed_ns(&mid, &end) / (double)iters;
+  printf("%-8s: called %.2f ns/iter, inline %.2f ns/iter (%.2fx)%s\n", name,
+         ns_called, ns_inlined, ns_called / ns_inlined,
+         a == b ? "" : "  MISMATCH");
+  return a == b ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+  uint64_t iters = DEFAULT_ITERS;
+  if (argc > 1) {
+    const char *arg = argv[1];
+    char *end;
+    errno = 0;
+    const unsigned long long v = strtoull(arg, &end, 0);
+    if (argc > 2 || *arg < '0' || *arg > '9' || *end != '\0' ||
+        errno != 0 || v == 0) {
+      fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+      return 1;
+    }
+    iters = v;
+  }
+
+  printf("running %" PRIu64 " iterations with seed %d\n", iters, SEED);
+  int status = 0;
+  status |= run("pi", pi_called, pi_inlined, iters);
+  status |= run("dice", dice_called, dice_inlined, iters);
+  status |= run("jitter", jitter_called, jitter_inlined, iters);
+  return status;
+}
@@ -8,6 +8,10 @@
 
 #define NUM_SAMPLES 10000000000ULL
 
+// Bulk fill: total bytes written, reusing one cache-resident buffer.
+#define FILL_BYTES (16ULL << 30)
+#define FILL_WORDS 8192
+
 extern void init_xoshiro(uint64_t);
 extern uint64_t xoshiro256pp(void);
 extern void init_pcg64(uint64_t);
@@ -30,10 +34,105 @@ void benchmark(const char *name, void (*init)(uint64_t), uint64_t (*next)(void),
   clock_gettime(CLOCK_MONOTONIC, &end);
   double time_ns =
       (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
-  printf("%-15s: %.2f ns/sample, dummy=%" PRIu64 "\n", name,
+  printf("%-17s: %.2f ns/sample, dummy=%" PRIu64 "\n", name,
          time_ns / NUM_SAMPLES, dummy);
 }
 
+static double elapsed_ns(const struct timespec *start,
+                         const struct timespec *end) {
+  return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+static uint64_t fill_buf[FILL_WORDS];
+
+void benchmark_fill(uint64_t seed) {
+  const uint64_t rounds = FILL_BYTES / sizeof(fill_buf);
+  struct timespec start, end;
+  uint64_t dummy = 0;
+
+  cromulent_state st;
+  cromulent_init(&st, seed);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint64_t r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < FILL_WORDS; i++)
+      fill_buf[i] = cromulent_next(&st);
+    dummy ^= fill_buf[r % FILL_WORDS];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  printf("%-17s: %.2f GB/s, dummy=%" PRIu64 "\n", "next loop",
+         FILL_BYTES / elapsed_ns(&start, &end), dummy);
+
+  cromulent_x4_state x4;
+  cromulent_x4_init(&x4, seed);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint64_t r = 0; r < rounds; r++) {
+    cromulent_x4_fill(&x4, fill_buf, FILL_WORDS / 4);
+    dummy ^= fill_buf[r % FILL_WORDS];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  printf("%-17s: %.2f GB/s, dummy=%" PRIu64 "\n", "x4_fill",
+         FILL_BYTES / elapsed_ns(&start, &end), dummy);
+
+  cromulent_bulk_state bulk;
+  cromulent_bulk_init(&bulk, seed);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint64_t r = 0; r < rounds; r++) {
+    cromulent_fill_u64(&bulk, fill_buf, FILL_WORDS);
+    dummy ^= fill_buf[r % FILL_WORDS];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  printf("%-17s: %.2f GB/s (%s), dummy=%" PRIu64 "\n", "fill_u64",
+         FILL_BYTES / elapsed_ns(&start, &end),
+         cromulent_backend_name(cromulent_backend_active()), dummy);
+}
+
+// Batch fill through the v2 registry, one private instance per generator.
+#define REGISTRY_FILL_BYTES (4ULL << 30)
+
+void benchmark_registry_fill(uint64_t seed) {
+  const uint64_t rounds = REGISTRY_FILL_BYTES / sizeof(fill_buf);
+  size_t n = 0;
+  const CromulentPRNG2 *list = cromulent_registry_v2_all(&n);
+
+  for (size_t g = 0; g < n; g++) {
+    uint64_t state[16];
+    struct timespec start, end;
+    uint64_t dummy = 0;
+
+    if (list[g].state_size > sizeof state)
+      continue;
+    list[g].init(state, seed);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint64_t r = 0; r < rounds; r++) {
+      list[g].fill(state, fill_buf, FILL_WORDS);
+      dummy ^= fill_buf[r % FILL_WORDS];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("%-17s: %.2f GB/s (v2 fill), dummy=%" PRIu64 "\n", list[g].name,
+           REGISTRY_FILL_BYTES / elapsed_ns(&start, &end), dummy);
+  }
+}
+
+// Startup cost of handing each of SPLIT_STREAMS workers its own substream.
+#define SPLIT_STREAMS 10000
+
+void benchmark_split(uint64_t seed) {
+  static cromulent_state streams[SPLIT_STREAMS];
+  struct timespec start, end;
+  uint64_t dummy = 0;
+
+  cromulent_state master;
+  cromulent_init(&master, seed);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint64_t i = 0; i < SPLIT_STREAMS; i++) {
+    cromulent_split(&master, i, &streams[i]);
+    dummy ^= cromulent_next(&streams[i]);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  printf("%-17s: %.2f us for %d streams, dummy=%" PRIu64 "\n", "split",
+         elapsed_ns(&start, &end) / 1e3, SPLIT_STREAMS, dummy);
+}
+
 int main(void) {
   uint64_t seed = 69420;
 
@@ -42,6 +141,17 @@ int main(void) {
   benchmark("cromulent128", init_cromulent, cromulent128pp, seed);
   benchmark("splitmix64", init_splitmix64, splitmix64pp, seed);
   benchmark("pcg64", init_pcg64, pcg64pp, seed);
+  benchmark("cromulent_strong", init_cromulent_strong, cromulent_strongpp,
+            seed);
+  benchmark("cromulent_at", init_cromulent_at, cromulent_atpp, seed);
+  const CromulentPRNG *avx2 = cromulent_registry_find("cromulent128_avx2");
+  if (avx2)
+    benchmark(avx2->name, avx2->init, avx2->next, seed);
+
+  printf("filling %llu bytes with seed %" PRIu64 "\n", FILL_BYTES, seed);
+  benchmark_fill(seed);
+  benchmark_registry_fill(seed);
+  benchmark_split(seed);
 
   return 0;
 }
@@ -0,0 +1,108 @@
+// apps/bench_shuffle.cpp
+//
+// Shuffling a large array of 64-bit values: std::shuffle driven by
+// cromulent::engine against cromulent_shuffle and the bucketed
+// cromulent_shuffle_large, plus k-of-n sampling against std::sample.
+//
+//   bench_shuffle [elements] [threads]
+
+#include "cromulent.hpp"
+
+#include "cromulent.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t kSeed = 69420;
+
+template <class F> double ns_per_value(std::uint64_t values, F &&run) {
+  const auto start = std::chrono::steady_clock::now();
+  const std::uint64_t sink = run();
+  const auto end = std::chrono::steady_clock::now();
+  // Keep the result alive without printing it in the table.
+  volatile std::uint64_t keep = sink;
+  (void)keep;
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(values);
+}
+
+void report(const char *name, double ns) {
+  std::printf("%-34s: %6.2f ns/element, %7.1f M/s\n", name, ns, 1e3 / ns);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = std::size_t{1} << 26;
+  unsigned threads = 1;
+  if (argc > 1)
+    n = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2)
+    threads = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+  if (n == 0)
+    n = 1;
+
+  std::printf("%zu elements (%.1f MiB) with seed %llu, %u thread(s)\n", n,
+              static_cast<double>(n * sizeof(std::uint64_t)) / (1 << 20),
+              static_cast<unsigned long long>(kSeed), threads);
+
+  std::vector<std::uint64_t> a(n);
+  std::iota(a.begin(), a.end(), 0);
+
+  report("std::shuffle", ns_per_value(n, [&] {
+           cromulent::engine rng(kSeed);
+           std::shuffle(a.begin(), a.end(), rng);
+           return a[n / 2];
+         }));
+
+  report("cromulent_shuffle", ns_per_value(n, [&] {
+           cromulent_state st;
+           cromulent_init(&st, kSeed);
+           cromulent_shuffle(&st, a.data(), n, sizeof a[0]);
+           return a[n / 2];
+         }));
+
+  std::vector<unsigned char> ws(
+      cromulent_shuffle_large_workspace(n, sizeof a[0]));
+  report("cromulent_shuffle_large", ns_per_value(n, [&] {
+           cromulent_state st;
+           cromulent_init(&st, kSeed);
+           cromulent_shuffle_large(&st, a.data(), n, sizeof a[0], ws.data(),
+                                   threads);
+           return a[n / 2];
+         }));
+
+  // k-of-n sampling, k = 1000, per sample drawn
+  const std::size_t k = std::min<std::size_t>(1000, n);
+  std::vector<std::uint64_t> out(k);
+  const int rounds = 100;
+  report("std::sample (k = 1000)", ns_per_value(k * rounds, [&] {
+           cromulent::engine rng(kSeed);
+           std::uint64_t acc = 0;
+           for (int r = 0; r < rounds; ++r) {
+             std::sample(a.begin(), a.end(), out.begin(), k, rng);
+             acc += out[0];
+           }
+           return acc;
+         }));
+  report("cromulent_sample_k (k = 1000)", ns_per_value(k * rounds, [&] {
+           cromulent_state st;
+           cromulent_init(&st, kSeed);
+           std::uint64_t acc = 0;
+           for (int r = 0; r < rounds; ++r) {
+             cromulent_sample_k(&st, n, out.data(), k);
+             acc += a[out[0]];
+           }
+           return acc;
+         }));
+  return 0;
+}
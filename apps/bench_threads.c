@@ -0,0 +1,119 @@
+// apps/bench_threads.c
+//
+// Multi-threaded scaling: every thread draws SAMPLES_PER_THREAD values either
+// from the thread-local generator, from the global registry generator behind
+// a mutex, or from a private instance of a v2 registry generator.
+// Usage: bench_threads [max_threads] [v2 generator, default cromulent128]
+
+#include "cromulent.h"
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SAMPLES_PER_THREAD 50000000ULL
+#define MAX_THREADS 256
+
+extern void init_cromulent(uint64_t);
+extern uint64_t cromulent128pp(void);
+
+static pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+static const CromulentPRNG2 *v2_gen;
+
+typedef struct {
+  uint64_t stream;
+  uint64_t dummy;
+} worker_result;
+
+static void *run_tls(void *arg) {
+  worker_result *res = arg;
+  uint64_t dummy = 0;
+  for (uint64_t i = 0; i < SAMPLES_PER_THREAD; i++)
+    dummy ^= cromulent_tls_next();
+  res->dummy = dummy;
+  return NULL;
+}
+
+static void *run_locked(void *arg) {
+  worker_result *res = arg;
+  uint64_t dummy = 0;
+  for (uint64_t i = 0; i < SAMPLES_PER_THREAD; i++) {
+    pthread_mutex_lock(&global_lock);
+    dummy ^= cromulent128pp();
+    pthread_mutex_unlock(&global_lock);
+  }
+  res->dummy = dummy;
+  return NULL;
+}
+
+static void *run_v2(void *arg) {
+  worker_result *res = arg;
+  uint64_t state[16];
+  uint64_t dummy = 0;
+  v2_gen->init(state, 42 + res->stream);
+  for (uint64_t i = 0; i < SAMPLES_PER_THREAD; i++)
+    dummy ^= v2_gen->next(state);
+  res->dummy = dummy;
+  return NULL;
+}
+
+static double run(const char *name, void *(*fn)(void *), int threads) {
+  pthread_t tid[MAX_THREADS];
+  worker_result res[MAX_THREADS];
+  struct timespec start, end;
+  uint64_t dummy = 0;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int t = 0; t < threads; t++) {
+    res[t].stream = (uint64_t)t;
+    pthread_create(&tid[t], NULL, fn, &res[t]);
+  }
+  for (int t = 0; t < threads; t++) {
+    pthread_join(tid[t], NULL);
+    dummy ^= res[t].dummy;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  const double ns =
+      (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+  const double msps = threads * SAMPLES_PER_THREAD / ns * 1e3;
+  printf("%-17s threads=%-3d: %8.1f Msamples/s, dummy=%" PRIu64 "\n", name,
+         threads, msps, dummy);
+  return msps;
+}
+
+int main(int argc, char **argv) {
+  long max_threads = argc > 1 ? strtol(argv[1], NULL, 10)
+                              : sysconf(_SC_NPROCESSORS_ONLN);
+  if (max_threads < 1)
+    max_threads = 1;
+  if (max_threads > MAX_THREADS)
+    max_threads = MAX_THREADS;
+
+  const char *v2_name = argc > 2 ? argv[2] : "cromulent128";
+  v2_gen = cromulent_registry_v2_find(v2_name);
+  if (!v2_gen || v2_gen->state_size > 16 * sizeof(uint64_t)) {
+    fprintf(stderr, "unknown generator: %s\n", v2_name);
+    return 1;
+  }
+
+  cromulent_tls_seed(42);
+  init_cromulent(42);
+
+  printf("Thread scaling, %llu samples per thread\n",
+         (unsigned long long)SAMPLES_PER_THREAD);
+  // 1, 2, 4, ... and finally max_threads itself
+  for (int threads = 1;; threads *= 2) {
+    if (threads > max_threads)
+      threads = (int)max_threads;
+    run("tls", run_tls, threads);
+    run("mutex", run_locked, threads);
+    run(v2_gen->name, run_v2, threads);
+    if (threads == max_threads)
+      break;
+  }
+  return 0;
+}
@@ -0,0 +1,596 @@
+// apps/cromulent_practrand.c
+//
+// Runs PractRand on several streams at once and survives being interrupted.
+// Every combination of --gen, --seed and --backend is a job; a combination
+// given twice (--seed 1 --seed 0x1) is an error. Each job runs in its own
+// process, since the backend is chosen per process, and feeds its own
+// RNG_test through a pipe. The parent runs up to --jobs of them at a time.
+//
+// Every --checkpoint bytes a job saves the generator state (cromulent_save
+// words for cromulent_bulk) and PractRand's progress so far, as read from its
+// report, into <results>/practrand-<job>.state. With --resume a job continues
+// from its last checkpoint. PractRand cannot save its own state, so the rest
+// of the stream goes to a new RNG_test run, a segment, whose report is
+// appended to the same log after a "=== segment" line. Each segment is
+// tested on its own, and the bytes between the checkpoint and the
+// interruption are tested twice. Jobs that finished are not run again.
+//
+// After every job the parent rewrites <results>/practrand-summary.json with
+// each job's status, bytes tested, worst evaluation, and the stream offset
+// of its first failure.
+//
+// Generators are the v2 registry entries plus "cromulent_bulk" and
+// "cromulent_strong_bulk", the SIMD bulk streams; cromulent_bulk is the
+// default. The exit status is 0 when every job completed or was skipped
+// because the CPU lacks its backend, and 1 otherwise.
+//
+// Usage: cromulent-practrand [--gen NAME]... [--seed N]... [--backend NAME]...
+//                            [--bytes N[K|M|G|T]] [--checkpoint N[K|M|G|T]]
+//                            [--jobs N] [--rng-test PATH] [--results DIR]
+//                            [--resume] [--list]
+
+#include "cromulent.h"
+#include "tool_common.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define DEFAULT_SEED 0xDEADBEEFULL
+#define DEFAULT_BYTES (128ULL << 40)
+#define DEFAULT_CHECKPOINT (64ULL << 30)
+#define DEFAULT_RNG_TEST "practrand/RNG_test"
+#define DEFAULT_RESULTS "tests/results"
+#define BLOCK (1 << 20)
+#define MAX_LIST 64
+#define MAX_JOBS 1024
+#define SKIP_STATUS 77
+#define STATE_VERSION 1
+
+typedef struct {
+  const char *gens[MAX_LIST], *backends[MAX_LIST];
+  uint64_t seeds[MAX_LIST];
+  unsigned ngens, nseeds, nbackends;
+  uint64_t bytes, checkpoint;
+  unsigned jobs;
+  const char *rng_test, *results;
+  int resume;
+} options;
+
+typedef enum {
+  JOB_PENDING,
+  JOB_RUNNING,
+  JOB_COMPLETE,
+  JOB_INTERRUPTED,
+  JOB_SKIPPED
+} job_status;
+
+static const char *const status_names[] = {"pending", "running", "complete",
+                                           "interrupted", "skipped"};
+
+typedef struct {
+  const char *gen, *backend;
+  uint64_t seed;
+  char id[128];
+  job_status status;
+  pid_t pid;
+} job;
+
+// What a report says so far. Offsets count bytes of the job's stream, so a
+// failure in segment 2 is placed after the bytes segment 1 started from.
+typedef struct {
+  uint64_t tested;        // end of the longest length PractRand reported
+  uint64_t first_failure; // start of the stream up to the first FAIL
+  int failed, suspicious;
+} progress;
+
+// A job's .state file: its settings, how far it got, and the generator state
+// at the last checkpoint
+typedef struct {
+  char gen[64], backend[32];
+  uint64_t seed, target, bytes;
+  unsigned segments;
+  int done;
+  progress pr;
+  uint8_t *saved;
+  size_t saved_size;
+} checkpoint;
+
+// RNG_test's -tlmax, rounded down so that it never waits for bytes the job
+// will not send
+static void format_size(char *buf, size_t size, uint64_t bytes) {
+  static const char *const units[] = {"TB", "GB", "MB", "KB"};
+  for (int u = 0; u < 4; u++) {
+    const int shift = 10 * (4 - u);
+    if (u == 3 || bytes % (1ULL << shift) == 0) {
+      snprintf(buf, size, "%" PRIu64 "%s", bytes >> shift, units[u]);
+      return;
+    }
+  }
+}
+
+static void job_path(char *buf, size_t size, const options *o, const job *j,
+                     const char *suffix) {
+  snprintf(buf, size, "%s/practrand-%s%s", o->results, j->id, suffix);
+}
+
+// Read an RNG_test report. Its results come in rounds that each start with
+// "length= ... (2^N bytes)"; every round reports the stream up to that length
+// and lists the anomalies, with the evaluation at the end of the line.
+static void read_progress(const char *log, progress *pr) {
+  memset(pr, 0, sizeof *pr);
+  FILE *f = fopen(log, "r");
+  if (!f)
+    return;
+  char line[512];
+  uint64_t start = 0, length = 0;
+  while (fgets(line, sizeof line, f)) {
+    unsigned long long from;
+    const char *p;
+    if (sscanf(line, "=== segment %*u from byte %llu", &from) == 1) {
+      start = from;
+      length = 0;
+    } else if (strncmp(line, "length=", 7) == 0 && (p = strstr(line, "(2^"))) {
+      const double log2_bytes = strtod(p + 3, NULL);
+      length = (uint64_t)llround(pow(2.0, log2_bytes));
+      if (start + length > pr->tested)
+        pr->tested = start + length;
+    } else if (strstr(line, "FAIL")) {
+      if (!pr->failed)
+        pr->first_failure = start + length;
+      pr->failed = 1;
+    } else if (strstr(line, "suspicious") || strstr(line, "SUSPICIOUS")) {
+      pr->suspicious = 1;
+    }
+  }
+  fclose(f);
+}
+
+static const char *progress_result(const progress *pr) {
+  if (pr->failed)
+    return "fail";
+  if (pr->suspicious)
+    return "suspicious";
+  return pr->tested ? "pass" : "none";
+}
+
+// Written to a temporary file and renamed over the old one, so an
+// interruption leaves either the previous checkpoint or the new one.
+static int write_checkpoint(const char *path, const checkpoint *c) {
+  char tmp[1040];
+  snprintf(tmp, sizeof tmp, "%s.tmp", path);
+  FILE *f = fopen(tmp, "w");
+  if (!f)
+    return -1;
+  fprintf(f, "cromulent-practrand %d\n", STATE_VERSION);
+  fprintf(f, "gen %s\nseed 0x%" PRIx64 "\nbackend %s\n", c->gen, c->seed,
+          c->backend);
+  fprintf(f, "target %" PRIu64 "\nbytes %" PRIu64 "\n", c->target, c->bytes);
+  fprintf(f, "segments %u\ndone %d\n", c->segments, c->done);
+  fprintf(f, "tested %" PRIu64 "\nresult %s\n", c->pr.tested,
+          progress_result(&c->pr));
+  fprintf(f, "first_failure %" PRIu64 "\nstate ", c->pr.first_failure);
+  for (size_t i = 0; i < c->saved_size; i++)
+    fprintf(f, "%02x", c->saved[i]);
+  fprintf(f, "\n");
+  const int failed = ferror(f);
+  if (fclose(f) != 0 || failed || rename(tmp, path) != 0) {
+    remove(tmp);
+    return -1;
+  }
+  return 0;
+}
+
+// The fields read back on resume; tested and result are rebuilt from the log.
+// saved must hold saved_size bytes, or be NULL to skip the generator state.
+static int read_checkpoint(const char *path, checkpoint *c) {
+  FILE *f = fopen(path, "r");
+  if (!f)
+    return -1;
+  char line[1024];
+  int version = 0, have_state = 0;
+  while (fgets(line, sizeof line, f)) {
+    unsigned long long v;
+    const char *hex;
+    if (sscanf(line, "cromulent-practrand %d", &version) == 1)
+      continue;
+    if (sscanf(line, "gen %63s", c->gen) == 1 ||
+        sscanf(line, "backend %31s", c->backend) == 1)
+      continue;
+    if (sscanf(line, "seed %llx", &v) == 1)
+      c->seed = v;
+    else if (sscanf(line, "target %llu", &v) == 1)
+      c->target = v;
+    else if (sscanf(line, "bytes %llu", &v) == 1)
+      c->bytes = v;
+    else if (sscanf(line, "segments %llu", &v) == 1)
+      c->segments = (unsigned)v;
+    else if (sscanf(line, "done %llu", &v) == 1)
+      c->done = v != 0;
+    else if (strncmp(line, "state ", 6) == 0) {
+      hex = line + 6;
+      have_state = strspn(hex, "0123456789abcdef") == 2 * c->saved_size;
+      for (size_t i = 0; have_state && c->saved && i < c->saved_size; i++) {
+        unsigned byte;
+        sscanf(hex + 2 * i, "%2x", &byte);
+        c->saved[i] = (uint8_t)byte;
+      }
+    }
+  }
+  fclose(f);
+  return version == STATE_VERSION && (have_state || !c->saved) ? 0 : -1;
+}
+
+// One job, in its own process: select the backend, restore or seed the
+// generator, start RNG_test on a pipe and feed it to the target length.
+static int run_job(const options *o, const job *j) {
+  for (int b = CROMULENT_BACKEND_SCALAR; b <= CROMULENT_BACKEND_NEON; b++) {
+    if (strcmp(j->backend, cromulent_backend_name((cromulent_backend)b)) != 0)
+      continue;
+    if (cromulent_backend_select((cromulent_backend)b) != 0) {
+      fprintf(stderr, "%s: backend '%s' is not available on this CPU\n",
+              j->id, j->backend);
+      return SKIP_STATUS;
+    }
+  }
+
+  source src;
+  if (source_open(&src, j->gen) != 0) {
+    fprintf(stderr, "%s: cannot open generator\n", j->id);
+    return 1;
+  }
+  source_seed(&src, j->seed);
+
+  char state_path[1024], log_path[1024];
+  job_path(state_path, sizeof state_path, o, j, ".state");
+  job_path(log_path, sizeof log_path, o, j, ".txt");
+
+  checkpoint c;
+  memset(&c, 0, sizeof c);
+  c.saved_size = source_state_size(&src);
+  c.saved = malloc(c.saved_size);
+  if (!c.saved) {
+    perror("malloc");
+    return 1;
+  }
+  if (o->resume && read_checkpoint(state_path, &c) == 0) {
+    if (strcmp(c.gen, j->gen) != 0 || c.seed != j->seed ||
+        c.target != o->bytes) {
+      fprintf(stderr, "%s: %s was written for a different run\n", j->id,
+              state_path);
+      return 1;
+    }
+    if (c.done)
+      return 0;
+    source_load(&src, c.saved);
+  } else {
+    c.bytes = 0;
+    c.segments = 0;
+  }
+  snprintf(c.gen, sizeof c.gen, "%s", j->gen);
+  snprintf(c.backend, sizeof c.backend, "%s", j->backend);
+  c.seed = j->seed;
+  c.target = o->bytes;
+  c.done = 0;
+  c.segments++;
+
+  const int log = open(log_path, O_WRONLY | O_CREAT | O_APPEND |
+                                     (c.segments == 1 ? O_TRUNC : 0),
+                       0644);
+  if (log < 0) {
+    perror(log_path);
+    return 1;
+  }
+  dprintf(log, "=== segment %u from byte %" PRIu64 " ===\n", c.segments,
+          c.bytes);
+  read_progress(log_path, &c.pr);
+  source_save(&src, c.saved);
+  if (write_checkpoint(state_path, &c) != 0) {
+    perror(state_path);
+    return 1;
+  }
+
+  int fds[2];
+  if (pipe(fds) != 0) {
+    perror("pipe");
+    return 1;
+  }
+  char tlmax[32];
+  format_size(tlmax, sizeof tlmax, o->bytes - c.bytes);
+  const pid_t tester = fork();
+  if (tester < 0) {
+    perror("fork");
+    return 1;
+  }
+  if (tester == 0) {
+    dup2(fds[0], STDIN_FILENO);
+    dup2(log, STDOUT_FILENO);
+    dup2(log, STDERR_FILENO);
+    close(fds[0]);
+    close(fds[1]);
+    close(log);
+    execl(o->rng_test, o->rng_test, "stdin64", "-tlmax", tlmax, (char *)NULL);
+    fprintf(stderr, "cannot run %s: %s\n", o->rng_test, strerror(errno));
+    _exit(127);
+  }
+  close(fds[0]);
+  close(log);
+
+  // A full block at a time keeps every checkpoint on a block boundary.
+  uint64_t *buf = malloc(BLOCK);
+  if (!buf) {
+    perror("malloc");
+    return 1;
+  }
+  while (c.bytes < o->bytes) {
+    const uint64_t left = o->bytes - c.bytes;
+    const size_t n = left < BLOCK ? (size_t)left : BLOCK;
+    source_fill(&src, buf, n / 8);
+    // RNG_test closes the pipe once it has read -tlmax bytes, or if it dies;
+    // its exit status tells which.
+    if (write_all(fds[1], (const unsigned char *)buf, n) != 0)
+      break;
+    c.bytes += n;
+    if (c.bytes % o->checkpoint == 0 && c.bytes < o->bytes) {
+      read_progress(log_path, &c.pr);
+      source_save(&src, c.saved);
+      if (write_checkpoint(state_path, &c) != 0) {
+        perror(state_path);
+        return 1;
+      }
+    }
+  }
+  close(fds[1]);
+  free(buf);
+
+  int status;
+  while (waitpid(tester, &status, 0) < 0 && errno == EINTR)
+    ;
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    fprintf(stderr, "%s: RNG_test stopped early; --resume continues from "
+                    "the last checkpoint\n", j->id);
+    return 1;
+  }
+
+  read_progress(log_path, &c.pr);
+  c.done = 1;
+  source_save(&src, c.saved);
+  if (write_checkpoint(state_path, &c) != 0) {
+    perror(state_path);
+    return 1;
+  }
+  return 0;
+}
+
+static void write_summary(const options *o, const job *jobs, unsigned n) {
+  char path[1024], tmp[1040];
+  snprintf(path, sizeof path, "%s/practrand-summary.json", o->results);
+  snprintf(tmp, sizeof tmp, "%s.tmp", path);
+  FILE *f = fopen(tmp, "w");
+  if (!f) {
+    perror(tmp);
+    return;
+  }
+
+  fprintf(f, "{\n  \"target_bytes\": %" PRIu64 ",\n  \"jobs\": [", o->bytes);
+  for (unsigned i = 0; i < n; i++) {
+    const job *j = &jobs[i];
+    char log_path[1024], state_path[1024];
+    job_path(log_path, sizeof log_path, o, j, ".txt");
+    job_path(state_path, sizeof state_path, o, j, ".state");
+    // Files left by an earlier run only count once the job has run.
+    progress pr;
+    checkpoint c;
+    memset(&pr, 0, sizeof pr);
+    memset(&c, 0, sizeof c);
+    if (j->status != JOB_PENDING && j->status != JOB_SKIPPED) {
+      read_progress(log_path, &pr);
+      if (read_checkpoint(state_path, &c) != 0)
+        memset(&c, 0, sizeof c);
+    }
+
+    fprintf(f, "%s\n    {\"id\": \"%s\", \"generator\": \"%s\", "
+               "\"seed\": \"0x%" PRIx64 "\", \"backend\": \"%s\",\n",
+            i ? "," : "", j->id, j->gen, j->seed, j->backend);
+    fprintf(f, "     \"status\": \"%s\", \"result\": \"%s\", "
+               "\"segments\": %u,\n",
+            status_names[j->status], progress_result(&pr), c.segments);
+    fprintf(f, "     \"checkpoint_bytes\": %" PRIu64 ", "
+               "\"tested_bytes\": %" PRIu64 ", \"first_failure_bytes\": ",
+            c.done ? c.target : c.bytes, pr.tested);
+    if (pr.failed)
+      fprintf(f, "%" PRIu64, pr.first_failure);
+    else
+      fprintf(f, "null");
+    fprintf(f, ",\n     \"log\": \"practrand-%s.txt\"}", j->id);
+  }
+  fprintf(f, "\n  ]\n}\n");
+
+  const int failed = ferror(f);
+  if (fclose(f) != 0 || failed || rename(tmp, path) != 0) {
+    perror(path);
+    remove(tmp);
+  }
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--gen NAME]... [--seed N]... [--backend NAME]...\n"
+          "          [--bytes N[K|M|G|T]] [--checkpoint N[K|M|G|T]]\n"
+          "          [--jobs N] [--rng-test PATH] [--results DIR]\n"
+          "          [--resume] [--list]\n",
+          argv0);
+}
+
+static int is_backend(const char *name) {
+  for (int b = CROMULENT_BACKEND_SCALAR; b <= CROMULENT_BACKEND_NEON; b++)
+    if (strcmp(name, cromulent_backend_name((cromulent_backend)b)) == 0)
+      return 1;
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  static options o;
+  o.bytes = DEFAULT_BYTES;
+  o.checkpoint = DEFAULT_CHECKPOINT;
+  o.rng_test = DEFAULT_RNG_TEST;
+  o.results = DEFAULT_RESULTS;
+  const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  // RNG_test takes most of a CPU, and its producer a little more
+  o.jobs = cpus > 1 ? (unsigned)cpus / 2 : 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "--list") == 0) {
+      source_list();
+      return 0;
+    }
+    if (strcmp(arg, "--resume") == 0) {
+      o.resume = 1;
+      continue;
+    }
+    const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!val) {
+      usage(argv[0]);
+      return 1;
+    }
+    unsigned long long v = 0;
+    int bad = 0;
+    if (strcmp(arg, "--gen") == 0 && o.ngens < MAX_LIST) {
+      o.gens[o.ngens++] = val;
+    } else if (strcmp(arg, "--seed") == 0 && o.nseeds < MAX_LIST) {
+      bad = parse_number(val, 0, 0, &v);
+      o.seeds[o.nseeds++] = v;
+    } else if (strcmp(arg, "--backend") == 0 && o.nbackends < MAX_LIST) {
+      o.backends[o.nbackends++] = val;
+    } else if (strcmp(arg, "--bytes") == 0) {
+      bad = parse_number(val, 10, 1, &v);
+      o.bytes = v;
+    } else if (strcmp(arg, "--checkpoint") == 0) {
+      bad = parse_number(val, 10, 1, &v) || v > UINT64_MAX - BLOCK;
+      o.checkpoint = v;
+    } else if (strcmp(arg, "--jobs") == 0) {
+      bad = parse_number(val, 10, 0, &v) || v > UINT_MAX;
+      o.jobs = (unsigned)v;
+    } else if (strcmp(arg, "--rng-test") == 0) {
+      o.rng_test = val;
+    } else if (strcmp(arg, "--results") == 0) {
+      o.results = val;
+    } else {
+      bad = 1;
+    }
+    if (bad) {
+      usage(argv[0]);
+      return 1;
+    }
+    i++;
+  }
+  if (o.ngens == 0)
+    o.gens[o.ngens++] = BULK_NAME;
+  if (o.nseeds == 0)
+    o.seeds[o.nseeds++] = DEFAULT_SEED;
+  if (o.nbackends == 0)
+    o.backends[o.nbackends++] =
+        cromulent_backend_name(cromulent_backend_active());
+  o.bytes = o.bytes / 8 * 8;
+  o.checkpoint = (o.checkpoint + BLOCK - 1) / BLOCK * BLOCK;
+  if (o.bytes < 1024 || o.checkpoint == 0 || o.jobs < 1 ||
+      o.ngens * o.nseeds * o.nbackends > MAX_JOBS) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  static job jobs[MAX_JOBS];
+  unsigned njobs = 0;
+  for (unsigned g = 0; g < o.ngens; g++) {
+    source probe;
+    if (source_open(&probe, o.gens[g]) != 0) {
+      fprintf(stderr, "unknown generator '%s'; --list shows them\n",
+              o.gens[g]);
+      return 1;
+    }
+    source_close(&probe);
+    for (unsigned s = 0; s < o.nseeds; s++) {
+      for (unsigned b = 0; b < o.nbackends; b++) {
+        if (!is_backend(o.backends[b])) {
+          fprintf(stderr, "unknown backend '%s'\n", o.backends[b]);
+          return 1;
+        }
+        job *j = &jobs[njobs++];
+        j->gen = o.gens[g];
+        j->seed = o.seeds[s];
+        j->backend = o.backends[b];
+        j->status = JOB_PENDING;
+        snprintf(j->id, sizeof j->id, "%s-%" PRIx64 "-%s", j->gen, j->seed,
+                 j->backend);
+        // Two jobs with one id would share their files
+        for (unsigned k = 0; k + 1 < njobs; k++) {
+          if (strcmp(jobs[k].id, j->id) == 0) {
+            fprintf(stderr, "job %s is given twice\n", j->id);
+            return 1;
+          }
+        }
+      }
+    }
+  }
+
+  // A tester that exits must not take its producer with it.
+  signal(SIGPIPE, SIG_IGN);
+  fflush(stdout);
+
+  unsigned started = 0, running = 0;
+  while (started < njobs || running > 0) {
+    if (started < njobs && running < o.jobs) {
+      job *j = &jobs[started++];
+      const pid_t pid = fork();
+      if (pid < 0) {
+        perror("fork");
+        return 1;
+      }
+      if (pid == 0)
+        _exit(run_job(&o, j));
+      j->pid = pid;
+      j->status = JOB_RUNNING;
+      running++;
+      printf("started %s\n", j->id);
+      fflush(stdout);
+      continue;
+    }
+
+    int status;
+    const pid_t pid = wait(&status);
+    if (pid < 0) {
+      if (errno == EINTR)
+        continue;
+      perror("wait");
+      return 1;
+    }
+    for (unsigned i = 0; i < started; i++) {
+      job *j = &jobs[i];
+      if (j->status != JOB_RUNNING || j->pid != pid)
+        continue;
+      const int code = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+      j->status = code == 0             ? JOB_COMPLETE
+                  : code == SKIP_STATUS ? JOB_SKIPPED
+                                        : JOB_INTERRUPTED;
+      running--;
+      printf("%s: %s\n", j->id, status_names[j->status]);
+      fflush(stdout);
+    }
+    write_summary(&o, jobs, njobs);
+  }
+  write_summary(&o, jobs, njobs);
+
+  for (unsigned i = 0; i < njobs; i++)
+    if (jobs[i].status != JOB_COMPLETE && jobs[i].status != JOB_SKIPPED)
+      return 1;
+  return 0;
+}
@@ -0,0 +1,763 @@
+// apps/cromulent_smoke.c
+//
+// Fast statistical smoke test. The generator's output is read through its
+// fill entry point straight into the tests, with no pipe in between, and
+// checked for:
+//
+//   monobit         ones among all bits
+//   runs            bit changes between neighbouring bits
+//   bytes           frequency of the 256 byte values
+//   gap             gaps between zero bytes, against the geometric law
+//   birthday        repeated spacings among 2^17 sorted 48-bit values, for
+//                   the top and the bottom 48 bits of the words
+//   bcfn-N          Hamming weight of blocks of N words, in four classes,
+//                   and the classes of adjacent block pairs (in the spirit
+//                   of PractRand's BCFN)
+//   linear-bN       Berlekamp-Massey linear complexity of 1024-bit runs of
+//                   bit N of consecutive words (NIST SP 800-22)
+//
+// This is a quick check for broken kernels and plainly bad generators, not a
+// substitute for PractRand or TestU01.
+//
+// The output is split into chunks like a pool file: chunk c is the generator
+// seeded with cromulent_split_seed(seed, c), which is --seed for chunk 0.
+// Threads take whole chunks and the counts are summed, so the report does not
+// depend on --threads. A p-value below 1e-8 (or, for the chi-square tests,
+// above 1 - 1e-8) fails and the exit status is 1; below 1e-4 is reported as
+// suspicious.
+//
+// Generators are the v2 registry entries plus "cromulent_bulk" and
+// "cromulent_strong_bulk" (cromulent_fill_u64 and cromulent_strong_fill_u64)
+// and "weyl", a Weyl sequence that must fail. --backend selects the kernels;
+// the exit status is 77 if the CPU cannot run them.
+//
+// Usage: cromulent-smoke [--gen NAME] [--seed N] [--bytes N[K|M|G|T]]
+//                        [--threads N] [--chunk N[K|M|G]] [--backend NAME]
+//                        [--list]
+
+#include "cromulent.h"
+#include "tool_common.h"
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_SEED 0xDEADBEEFULL
+#define DEFAULT_BYTES (1ULL << 30)
+#define DEFAULT_CHUNK (64ULL << 20)
+#define MAX_THREADS 256
+#define BUF_WORDS 8192
+#define SKIP_STATUS 77
+
+#define WEYL_NAME "weyl"
+
+// Birthday samples and linear-complexity blocks come from the start of every
+// period of 2^22 words, so their cost stays small next to the other tests.
+#define SAMPLE_PERIOD (1u << 22)
+#define BDAY_BITS 17
+#define BDAY_M (1u << BDAY_BITS)
+#define BDAY_LAMBDA 2.0 // m^3 / (4 * 2^48)
+#define LC_M 1024
+#define LC_WORDS (LC_M / 64 + 1)
+#define LC_BLOCKS 32
+#define LC_CLASSES 5
+
+#define GAP_WIDTH 32
+#define GAP_BINS 33 // 32 bins of GAP_WIDTH bytes, then the tail
+#define BCFN_LEVELS 7 // blocks of 4^j words
+
+#define FAIL_P 1e-8
+#define SUSPICIOUS_P 1e-4
+
+// The stream under test: a tool source, or the Weyl sequence when weyl is set
+typedef struct {
+  source src;
+  int weyl;
+  uint64_t x;
+} input;
+
+// Counts for one or more chunks. Every field is a sum, so the totals do not
+// depend on which thread scanned which chunk.
+typedef struct {
+  uint64_t words;
+  uint64_t ones;
+  uint64_t changes, neighbours;
+  uint64_t bytes[256];
+  uint64_t gaps[GAP_BINS];
+  uint64_t bday_samples, bday_repeats[2];
+  uint64_t bcfn[BCFN_LEVELS][16];
+  uint64_t linear[2][LC_CLASSES];
+} tally;
+
+// Position within the chunk being scanned
+typedef struct {
+  uint64_t index;    // words of the chunk seen so far
+  uint64_t last_bit; // top bit of the previous word
+  int64_t gap;       // nonzero bytes since the last zero byte, -1 before it
+  uint64_t block_sum[BCFN_LEVELS]; // weight of the open block per level
+  int first_class[BCFN_LEVELS];     // class of the block opening a pair
+  uint64_t *sample, *keys, *scratch; // BDAY_M words each
+  uint64_t bits[2][LC_WORDS];   // the linear-complexity blocks being read
+} scan;
+
+typedef struct {
+  const char *name;
+  uint64_t seed, bytes, chunk_bytes, chunks;
+  atomic_uint_fast64_t next;
+  tally totals[MAX_THREADS];
+} job;
+
+typedef struct {
+  job *j;
+  unsigned worker;
+} worker_arg;
+
+// BCFN class boundaries: a block of 4^j words with Hamming weight w is in
+// class (w >= t[0]) + (w >= t[1]) + (w >= t[2]), with probability p[c].
+static uint64_t bcfn_t[BCFN_LEVELS][3];
+static double bcfn_p[BCFN_LEVELS][4];
+static int bcfn_class0[65]; // level 0 classes by the weight of a word
+
+// NIST SP 800-22 classes of T = L - M/2 for even M, with the two classes at
+// either end merged (T <= -2 and T >= 2) so that a few hundred blocks give
+// every class enough expected counts
+static const double lc_p[LC_CLASSES] = {1.0 / 24, 1.0 / 8, 1.0 / 2, 1.0 / 4,
+                                        1.0 / 12};
+
+// Bit count without relying on a popcnt instruction in the baseline target
+static int popcount64(uint64_t x) {
+  x -= (x >> 1) & 0x5555555555555555ULL;
+  x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+  x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return (int)((x * 0x0101010101010101ULL) >> 56);
+}
+
+static int input_open(input *in, const char *name) {
+  memset(in, 0, sizeof *in);
+  if (strcmp(name, WEYL_NAME) == 0) {
+    in->weyl = 1;
+    return 0;
+  }
+  return source_open(&in->src, name);
+}
+
+static void input_seed(input *in, uint64_t seed) {
+  if (in->weyl)
+    in->x = seed;
+  else
+    source_seed(&in->src, seed);
+}
+
+static void input_fill(input *in, uint64_t *dst, size_t n) {
+  if (!in->weyl) {
+    source_fill(&in->src, dst, n);
+    return;
+  }
+  for (size_t i = 0; i < n; i++)
+    dst[i] = in->x += 0x9e3779b97f4a7c15ULL;
+}
+
+// Regularized lower and upper incomplete gamma functions, each computed
+// directly where it is small so that tiny p-values keep their precision.
+static double gamma_series(double a, double x) {
+  double sum = 1.0 / a, term = sum;
+  for (int n = 1; n < 100000; n++) {
+    term *= x / (a + n);
+    sum += term;
+    if (fabs(term) < fabs(sum) * 1e-16)
+      break;
+  }
+  return sum * exp(-x + a * log(x) - lgamma(a));
+}
+
+static double gamma_fraction(double a, double x) {
+  const double tiny = 1e-300;
+  double b = x + 1.0 - a, c = 1.0 / tiny, d = 1.0 / b, h = d;
+  for (int i = 1; i < 100000; i++) {
+    const double an = -i * (i - a);
+    b += 2.0;
+    d = an * d + b;
+    if (fabs(d) < tiny)
+      d = tiny;
+    c = b + an / c;
+    if (fabs(c) < tiny)
+      c = tiny;
+    d = 1.0 / d;
+    const double del = d * c;
+    h *= del;
+    if (fabs(del - 1.0) < 1e-16)
+      break;
+  }
+  return exp(-x + a * log(x) - lgamma(a)) * h;
+}
+
+static double gamma_p(double a, double x) {
+  if (x <= 0)
+    return 0.0;
+  return x < a + 1 ? gamma_series(a, x) : 1.0 - gamma_fraction(a, x);
+}
+
+static double gamma_q(double a, double x) {
+  if (x <= 0)
+    return 1.0;
+  return x < a + 1 ? 1.0 - gamma_series(a, x) : gamma_fraction(a, x);
+}
+
+static double chi2_p(double x, unsigned df) { return gamma_q(df / 2.0, x / 2.0); }
+
+static double normal_p(double z) { return erfc(fabs(z) / sqrt(2.0)); }
+
+// Two-sided p-value of k events where lambda were expected
+static double poisson_p(uint64_t k, double lambda) {
+  const double below = gamma_q((double)k + 1, lambda); // P(X <= k)
+  const double above = k == 0 ? 1.0 : gamma_p((double)k, lambda);
+  const double p = 2.0 * (below < above ? below : above);
+  return p < 1.0 ? p : 1.0;
+}
+
+// Probability that a binomial(n, 1/2) count lies in [lo, hi)
+static double binomial_range(uint64_t n, uint64_t lo, uint64_t hi) {
+  double sum = 0;
+  for (uint64_t k = lo; k < hi && k <= n; k++)
+    sum += exp(lgamma((double)n + 1) - lgamma((double)k + 1) -
+               lgamma((double)(n - k) + 1) - (double)n * log(2.0));
+  return sum;
+}
+
+static void bcfn_setup(void) {
+  for (int j = 0; j < BCFN_LEVELS; j++) {
+    const uint64_t n = 64ULL << (2 * j);
+    const uint64_t half = n / 2;
+    const uint64_t quartile = (uint64_t)(0.6745 * sqrt((double)n) / 2 + 0.5);
+    bcfn_t[j][0] = half - quartile;
+    bcfn_t[j][1] = half;
+    bcfn_t[j][2] = half + quartile + 1;
+    uint64_t lo = 0;
+    for (int c = 0; c < 4; c++) {
+      const uint64_t hi = c < 3 ? bcfn_t[j][c] : n + 1;
+      bcfn_p[j][c] = binomial_range(n, lo, hi);
+      lo = hi;
+    }
+  }
+  for (uint64_t w = 0; w <= 64; w++)
+    bcfn_class0[w] = (w >= bcfn_t[0][0]) + (w >= bcfn_t[0][1]) +
+                     (w >= bcfn_t[0][2]);
+}
+
+// LSD radix sort of 48-bit keys, 12 bits per pass so the counts stay in L1.
+// One read of the keys counts the digits of all four passes.
+static void sort48(uint64_t *keys, uint64_t *tmp, size_t n) {
+  static _Thread_local uint32_t count[4][1 << 12];
+  memset(count, 0, sizeof count);
+  for (size_t i = 0; i < n; i++)
+    for (int p = 0; p < 4; p++)
+      count[p][(keys[i] >> (12 * p)) & 0xfff]++;
+  for (int p = 0; p < 4; p++) {
+    uint32_t at = 0;
+    for (size_t d = 0; d < (1 << 12); d++) {
+      const uint32_t c = count[p][d];
+      count[p][d] = at;
+      at += c;
+    }
+  }
+  for (int p = 0; p < 4; p++) {
+    const int shift = 12 * p;
+    for (size_t i = 0; i < n; i++)
+      tmp[count[p][(keys[i] >> shift) & 0xfff]++] = keys[i];
+    uint64_t *const swap = keys;
+    keys = tmp;
+    tmp = swap;
+  }
+}
+
+// Marsaglia's birthday spacings: sort the birthdays, sort the spacings and
+// count the spacings equal to their predecessor.
+static uint64_t birthday_repeats(uint64_t *keys, uint64_t *tmp) {
+  sort48(keys, tmp, BDAY_M);
+  for (size_t i = 0; i + 1 < BDAY_M; i++)
+    keys[i] = keys[i + 1] - keys[i];
+  sort48(keys, tmp, BDAY_M - 1);
+  uint64_t repeats = 0;
+  for (size_t i = 1; i + 1 < BDAY_M; i++)
+    repeats += keys[i] == keys[i - 1];
+  return repeats;
+}
+
+static void birthday_sample(scan *s, tally *t) {
+  for (size_t i = 0; i < BDAY_M; i++)
+    s->keys[i] = s->sample[i] >> 16;
+  t->bday_repeats[0] += birthday_repeats(s->keys, s->scratch);
+  for (size_t i = 0; i < BDAY_M; i++)
+    s->keys[i] = s->sample[i] & ((1ULL << 48) - 1);
+  t->bday_repeats[1] += birthday_repeats(s->keys, s->scratch);
+  t->bday_samples++;
+}
+
+// Berlekamp-Massey over GF(2) on LC_M bits, bit n in s[n / 64]. r holds the
+// bits read so far in reverse, r bit i = s[n - i], so each discrepancy is the
+// parity of c & r.
+static unsigned linear_complexity(const uint64_t *s) {
+  uint64_t c[LC_WORDS] = {1}, b[LC_WORDS] = {1}, r[LC_WORDS] = {0};
+  uint64_t t[LC_WORDS];
+  unsigned L = 0, m = 0;
+  int started = 0;
+
+  for (unsigned n = 0; n < LC_M; n++) {
+    for (unsigned w = n / 64; w > 0; w--)
+      r[w] = (r[w] << 1) | (r[w - 1] >> 63);
+    r[0] = (r[0] << 1) | ((s[n / 64] >> (n % 64)) & 1);
+
+    uint64_t d = 0;
+    for (unsigned w = 0; w <= L / 64; w++)
+      d ^= c[w] & r[w];
+    if (!(popcount64(d) & 1))
+      continue;
+
+    memcpy(t, c, sizeof c);
+    // c ^= b << (n - m), with m = -1 before the first length change
+    const unsigned k = started ? n - m : n + 1;
+    const unsigned ws = k / 64, bs = k % 64;
+    for (unsigned w = LC_WORDS; w-- > ws;) {
+      uint64_t v = b[w - ws] << bs;
+      if (bs && w > ws)
+        v |= b[w - ws - 1] >> (64 - bs);
+      c[w] ^= v;
+    }
+    if (2 * L <= n) {
+      L = n + 1 - L;
+      m = n;
+      started = 1;
+      memcpy(b, t, sizeof t);
+    }
+  }
+  return L;
+}
+
+static void linear_block(scan *s, tally *t) {
+  for (int k = 0; k < 2; k++) {
+    const int T = (int)linear_complexity(s->bits[k]) - LC_M / 2;
+    const int cls = T <= -2 ? 0 : T >= 2 ? 4 : T + 2;
+    t->linear[k][cls]++;
+    memset(s->bits[k], 0, sizeof s->bits[k]);
+  }
+}
+
+// Close the BCFN blocks that end with the word just scanned. A block of level
+// j covers 4^j words, so it ends where the word count is a multiple of 4^j,
+// and its weight carries into the block of level j + 1. Blocks pair up with
+// their neighbour: even-numbered blocks open a pair and odd ones close it.
+static void bcfn_block(scan *s, tally *t, int j, uint64_t weight) {
+  const int cls = (weight >= bcfn_t[j][0]) + (weight >= bcfn_t[j][1]) +
+                  (weight >= bcfn_t[j][2]);
+  if (((s->index + 1) >> (2 * j)) & 1)
+    s->first_class[j] = cls;
+  else
+    t->bcfn[j][s->first_class[j] * 4 + cls]++;
+}
+
+static void bcfn_carry(scan *s, tally *t) {
+  const uint64_t end = s->index + 1;
+  for (int j = 1; j < BCFN_LEVELS && !(end & ((1ULL << (2 * j)) - 1)); j++) {
+    const uint64_t weight = s->block_sum[j];
+    s->block_sum[j] = 0;
+    if (j + 1 < BCFN_LEVELS)
+      s->block_sum[j + 1] += weight;
+    bcfn_block(s, t, j, weight);
+  }
+}
+
+// Gaps between the zero bytes of one word, *gap carrying the count across
+// words
+static void gap_word(tally *t, int64_t *gap, uint64_t x) {
+  for (int b = 0; b < 64; b += 8) {
+    if ((x >> b) & 0xff) {
+      *gap += *gap >= 0;
+      continue;
+    }
+    if (*gap >= 0) {
+      const int64_t bin = *gap / GAP_WIDTH;
+      t->gaps[bin < GAP_BINS - 1 ? bin : GAP_BINS - 1]++;
+    }
+    *gap = 0;
+  }
+}
+
+static void scan_start(scan *s) {
+  s->index = 0;
+  s->last_bit = 0;
+  s->gap = -1;
+  memset(s->block_sum, 0, sizeof s->block_sum);
+  memset(s->first_class, 0, sizeof s->first_class);
+  memset(s->bits, 0, sizeof s->bits);
+}
+
+// The hot counters live in locals for the whole buffer: stores through t or s
+// could alias the words being read, so the compiler would otherwise reload
+// them for every word.
+static void scan_words(scan *s, tally *t, const uint64_t *w, size_t n) {
+  const uint64_t ones = 0x0101010101010101ULL, highs = 0x8080808080808080ULL;
+  // Byte counts go to four tables in turn, so that increments of the same
+  // value rarely wait on each other; n is small enough for 32-bit counts.
+  uint32_t bytes[4][256], pairs[16];
+  memset(bytes, 0, sizeof bytes);
+  memset(pairs, 0, sizeof pairs);
+  uint64_t set = 0, changes = 0, index = s->index, last_bit = s->last_bit;
+  uint64_t block = s->block_sum[1];
+  int64_t gap = s->gap;
+  int first = s->first_class[0];
+
+  if (n > 0 && index > 0)
+    changes += (w[0] & 1) != last_bit;
+  t->neighbours += 63 * (uint64_t)n + (index > 0 ? n : n - (n > 0));
+
+  for (size_t i = 0; i < n; i++, index++) {
+    const uint64_t x = w[i];
+    const int weight = popcount64(x);
+
+    set += (uint64_t)weight;
+    changes += (uint64_t)popcount64((x ^ (x >> 1)) & (~0ULL >> 1));
+    if (i > 0)
+      changes += (x & 1) != last_bit;
+    last_bit = x >> 63;
+
+    for (int b = 0; b < 64; b += 8)
+      bytes[(b >> 3) & 3][(x >> b) & 0xff]++;
+
+    if ((x - ones) & ~x & highs)
+      gap_word(t, &gap, x);
+    else if (gap >= 0)
+      gap += 8;
+
+    const int cls = bcfn_class0[weight];
+    if (index & 1)
+      pairs[first * 4 + cls]++;
+    else
+      first = cls;
+    block += (uint64_t)weight;
+    if ((index & 3) == 3) {
+      s->index = index;
+      s->block_sum[1] = block;
+      bcfn_carry(s, t);
+      block = 0;
+    }
+
+    const uint64_t pos = index % SAMPLE_PERIOD;
+    if (pos < BDAY_M) {
+      s->sample[pos] = x;
+      if (pos == BDAY_M - 1)
+        birthday_sample(s, t);
+    }
+    if (pos < (uint64_t)LC_BLOCKS * LC_M) {
+      const unsigned bit = (unsigned)(pos % LC_M);
+      s->bits[0][bit / 64] |= (x & 1) << (bit % 64);
+      s->bits[1][bit / 64] |= (x >> 63) << (bit % 64);
+      if (bit == LC_M - 1)
+        linear_block(s, t);
+    }
+  }
+
+  s->index = index;
+  s->last_bit = last_bit;
+  s->block_sum[1] = block;
+  s->gap = gap;
+  s->first_class[0] = first;
+  for (int v = 0; v < 256; v++)
+    t->bytes[v] += (uint64_t)bytes[0][v] + bytes[1][v] + bytes[2][v] +
+                   bytes[3][v];
+  for (int c = 0; c < 16; c++)
+    t->bcfn[0][c] += pairs[c];
+  t->ones += set;
+  t->changes += changes;
+  t->words += n;
+}
+
+static void *worker_main(void *arg) {
+  const worker_arg *a = arg;
+  job *j = a->j;
+  tally *t = &j->totals[a->worker];
+  input in;
+  scan s;
+  uint64_t *buf = malloc(BUF_WORDS * sizeof *buf);
+  s.sample = malloc(BDAY_M * sizeof *s.sample);
+  s.keys = malloc(BDAY_M * sizeof *s.keys);
+  s.scratch = malloc(BDAY_M * sizeof *s.scratch);
+  if (!buf || !s.sample || !s.keys || !s.scratch ||
+      input_open(&in, j->name) != 0) {
+    perror("cromulent-smoke");
+    exit(1);
+  }
+
+  for (;;) {
+    const uint64_t c = atomic_fetch_add_explicit(&j->next, 1,
+                                                 memory_order_relaxed);
+    if (c >= j->chunks)
+      break;
+    const uint64_t at = c * j->chunk_bytes;
+    uint64_t left = (j->bytes - at < j->chunk_bytes ? j->bytes - at
+                                                    : j->chunk_bytes) / 8;
+    input_seed(&in, cromulent_split_seed(j->seed, c));
+    scan_start(&s);
+    while (left > 0) {
+      const size_t n = left < BUF_WORDS ? (size_t)left : BUF_WORDS;
+      input_fill(&in, buf, n);
+      scan_words(&s, t, buf, n);
+      left -= n;
+    }
+  }
+
+  source_close(&in.src);
+  free(buf);
+  free(s.sample);
+  free(s.keys);
+  free(s.scratch);
+  return NULL;
+}
+
+// Print one result and return 1 if it fails. p < 0 marks a test that had too
+// little data to run. Chi-square tests also fail when the fit is too good.
+static int report(const char *name, const char *statistic, double p,
+                  int chi_square, unsigned *suspicious) {
+  const char *verdict = "normal";
+  int failed = 0;
+  if (p < 0) {
+    printf("  %-16s %-32s %-11s %s\n", name, "-", "-", "too little data");
+    return 0;
+  }
+  const double tail = chi_square && p > 0.5 ? 1.0 - p : p;
+  if (tail < FAIL_P) {
+    verdict = "FAIL";
+    failed = 1;
+  } else if (tail < SUSPICIOUS_P) {
+    verdict = "suspicious";
+    ++*suspicious;
+  }
+  printf("  %-16s %-32s %-11.4g %s\n", name, statistic, p, verdict);
+  return failed;
+}
+
+// Chi-square p-value of counts against probabilities, or -1 if a cell would
+// expect fewer than five counts
+static double chi_square_p(const uint64_t *counts, const double *probs,
+                           unsigned cells, double *statistic) {
+  uint64_t total = 0;
+  for (unsigned i = 0; i < cells; i++)
+    total += counts[i];
+  double x = 0;
+  for (unsigned i = 0; i < cells; i++) {
+    const double expected = (double)total * probs[i];
+    if (expected < 5)
+      return -1;
+    const double d = (double)counts[i] - expected;
+    x += d * d / expected;
+  }
+  *statistic = x;
+  return chi2_p(x, cells - 1);
+}
+
+static unsigned evaluate(const tally *t, unsigned *failed) {
+  char stat[64], name[32];
+  unsigned suspicious = 0;
+  double x, p;
+
+  const double bits = 64.0 * (double)t->words;
+  const double z_ones = (2.0 * (double)t->ones - bits) / sqrt(bits);
+  snprintf(stat, sizeof stat, "z = %+.2f", z_ones);
+  *failed += report("monobit", stat, normal_p(z_ones), 0, &suspicious);
+
+  const double n = (double)t->neighbours;
+  const double z_runs = (2.0 * (double)t->changes - n) / sqrt(n);
+  snprintf(stat, sizeof stat, "z = %+.2f", z_runs);
+  *failed += report("runs", stat, normal_p(z_runs), 0, &suspicious);
+
+  double uniform[256];
+  for (int i = 0; i < 256; i++)
+    uniform[i] = 1.0 / 256;
+  p = chi_square_p(t->bytes, uniform, 256, &x);
+  snprintf(stat, sizeof stat, "chi2 = %.1f, df 255", x);
+  *failed += report("bytes", stat, p, 1, &suspicious);
+
+  double gap_p[GAP_BINS];
+  const double q = 255.0 / 256, q_bin = pow(q, GAP_WIDTH);
+  for (int b = 0; b < GAP_BINS - 1; b++)
+    gap_p[b] = pow(q_bin, b) * (1 - q_bin);
+  gap_p[GAP_BINS - 1] = pow(q_bin, GAP_BINS - 1);
+  p = chi_square_p(t->gaps, gap_p, GAP_BINS, &x);
+  snprintf(stat, sizeof stat, "chi2 = %.1f, df %d", x, GAP_BINS - 1);
+  *failed += report("gap", stat, p, 1, &suspicious);
+
+  for (int k = 0; k < 2; k++) {
+    const double expected = BDAY_LAMBDA * (double)t->bday_samples;
+    snprintf(stat, sizeof stat, "%" PRIu64 " repeats, %.0f expected",
+             t->bday_repeats[k], expected);
+    p = t->bday_samples ? poisson_p(t->bday_repeats[k], expected) : -1;
+    *failed += report(k ? "birthday-lo48" : "birthday-hi48", stat, p, 0,
+                      &suspicious);
+  }
+
+  for (int j = 0; j < BCFN_LEVELS; j++) {
+    double cell_p[16];
+    for (int c = 0; c < 16; c++)
+      cell_p[c] = bcfn_p[j][c / 4] * bcfn_p[j][c % 4];
+    p = chi_square_p(t->bcfn[j], cell_p, 16, &x);
+    snprintf(name, sizeof name, "bcfn-%d", 1 << (2 * j));
+    snprintf(stat, sizeof stat, "chi2 = %.1f, df 15", x);
+    *failed += report(name, stat, p, 1, &suspicious);
+  }
+
+  for (int k = 0; k < 2; k++) {
+    p = chi_square_p(t->linear[k], lc_p, LC_CLASSES, &x);
+    snprintf(stat, sizeof stat, "chi2 = %.1f, df %d", x, LC_CLASSES - 1);
+    *failed += report(k ? "linear-b63" : "linear-b0", stat, p, 1,
+                      &suspicious);
+  }
+  return suspicious;
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--gen NAME] [--seed N] [--bytes N[K|M|G|T]]\n"
+          "          [--threads N] [--chunk N[K|M|G]] [--backend NAME]\n"
+          "          [--list]\n",
+          argv0);
+}
+
+int main(int argc, char **argv) {
+  const char *name = "cromulent128", *backend = NULL;
+  uint64_t seed = DEFAULT_SEED, bytes = DEFAULT_BYTES, chunk = DEFAULT_CHUNK;
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned threads = cpus > 0 ? (unsigned)cpus : 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "--list") == 0) {
+      source_list();
+      printf("%s\n", WEYL_NAME);
+      return 0;
+    }
+    const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!val) {
+      usage(argv[0]);
+      return 1;
+    }
+    unsigned long long v = 0;
+    int bad = 0;
+    if (strcmp(arg, "--gen") == 0) {
+      name = val;
+    } else if (strcmp(arg, "--seed") == 0) {
+      bad = parse_number(val, 0, 0, &v);
+      seed = v;
+    } else if (strcmp(arg, "--bytes") == 0) {
+      bad = parse_number(val, 10, 1, &v);
+      bytes = v;
+    } else if (strcmp(arg, "--threads") == 0) {
+      bad = parse_number(val, 10, 0, &v) || v > UINT_MAX;
+      threads = (unsigned)v;
+    } else if (strcmp(arg, "--chunk") == 0) {
+      bad = parse_number(val, 10, 1, &v);
+      chunk = v;
+    } else if (strcmp(arg, "--backend") == 0) {
+      backend = val;
+    } else {
+      bad = 1;
+    }
+    if (bad) {
+      usage(argv[0]);
+      return 1;
+    }
+    i++;
+  }
+  if (bytes < 8 || chunk < 8 || chunk % 8 || threads < 1) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  // The backend comes first: the AVX2 registry entry only exists when the
+  // CPU can run it.
+  if (backend) {
+    int found = 0;
+    for (int b = CROMULENT_BACKEND_SCALAR; b <= CROMULENT_BACKEND_NEON; b++) {
+      if (strcmp(backend, cromulent_backend_name((cromulent_backend)b)) != 0)
+        continue;
+      found = 1;
+      if (cromulent_backend_select((cromulent_backend)b) != 0) {
+        fprintf(stderr, "backend '%s' is not available on this CPU\n",
+                backend);
+        return SKIP_STATUS;
+      }
+    }
+    if (!found) {
+      fprintf(stderr, "unknown backend '%s'\n", backend);
+      return 1;
+    }
+  }
+
+  input probe;
+  if (input_open(&probe, name) != 0) {
+    fprintf(stderr, "unknown generator '%s'; --list shows them\n", name);
+    return 1;
+  }
+  source_close(&probe.src);
+  bcfn_setup();
+
+  static job j;
+  j.name = name;
+  j.seed = seed;
+  j.bytes = bytes / 8 * 8;
+  j.chunk_bytes = chunk;
+  j.chunks = (j.bytes + chunk - 1) / chunk;
+  atomic_init(&j.next, 0);
+  if (threads > MAX_THREADS)
+    threads = MAX_THREADS;
+  if (threads > j.chunks)
+    threads = (unsigned)j.chunks;
+
+  printf("cromulent-smoke: %s, seed 0x%" PRIx64 ", %" PRIu64
+         " bytes in %" PRIu64 " chunks, backend %s\n",
+         name, seed, j.bytes, j.chunks,
+         cromulent_backend_name(cromulent_backend_active()));
+
+  const double t0 = now();
+  pthread_t tids[MAX_THREADS];
+  worker_arg args[MAX_THREADS];
+  for (unsigned w = 0; w < threads; w++) {
+    args[w].j = &j;
+    args[w].worker = w;
+    if (pthread_create(&tids[w], NULL, worker_main, &args[w]) != 0) {
+      perror("pthread_create");
+      return 1;
+    }
+  }
+  for (unsigned w = 0; w < threads; w++)
+    pthread_join(tids[w], NULL);
+  const double secs = now() - t0;
+
+  tally total;
+  memset(&total, 0, sizeof total);
+  for (unsigned w = 0; w < threads; w++) {
+    const uint64_t *src = (const uint64_t *)&j.totals[w];
+    uint64_t *dst = (uint64_t *)&total;
+    for (size_t i = 0; i < sizeof total / sizeof(uint64_t); i++)
+      dst[i] += src[i];
+  }
+
+  printf("  %-16s %-32s %-11s %s\n", "test", "statistic", "p-value",
+         "evaluation");
+  unsigned failed = 0;
+  const unsigned suspicious = evaluate(&total, &failed);
+  printf("%u failed, %u suspicious; %.2f s on %u threads (%.2f GB/s)\n",
+         failed, suspicious, secs, threads, (double)j.bytes / secs / 1e9);
+  return failed ? 1 : 0;
+}
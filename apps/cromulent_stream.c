@@ -0,0 +1,293 @@
+// apps/cromulent_stream.c
+//
+// Raw random stream for PractRand and other consumers. Blocks of 64-bit words
+// (native byte order, like PractRand's stdin64) are generated into large
+// page-aligned buffers and handed to stdout or a file. When stdout is a pipe
+// on Linux the buffers are vmspliced into it, so the kernel maps the pages
+// instead of copying them; everything else goes through write().
+//
+// Generators are the v2 registry entries plus "cromulent_bulk" and
+// "cromulent_strong_bulk", the cromulent_fill_u64 and
+// cromulent_strong_fill_u64 streams, which run on the SIMD bulk kernels. With
+// --threads T, worker w produces blocks w, w + T, w + 2T, ... from its own
+// instance, seeded with cromulent_split_seed(seed, w). The output therefore depends
+// on the generator, seed, thread count and block size, and on nothing else.
+// With the defaults it is the stream dump_raw used to write.
+//
+// Usage: cromulent-stream [--gen NAME] [--seed N] [--bytes N[K|M|G|T]]
+//                         [--threads N] [--block N[K|M]] [--output FILE]
+//                         [--no-splice] [--list]
+
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sys/uio.h>
+#endif
+
+#include "cromulent.h"
+#include "tool_common.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define DEFAULT_SEED 0xDEADBEEFULL
+#define DEFAULT_BLOCK (1 << 20)
+#define MAX_THREADS 256
+#define PAGE 4096
+
+// Ring of block buffers shared by the workers and the writer. Block k lives
+// in slot k % nslots; ready[s] is the block the slot holds (or -1). A worker
+// may overwrite a slot once the block that used it before has been consumed:
+// written out, or for vmsplice, followed by enough fully spliced blocks to
+// fill the pipe, so that the reader has taken its pages.
+typedef struct {
+  unsigned char **slots;
+  long long *ready;
+  size_t nslots, block;
+  long long consumed; // every block up to this one is out of our hands
+  long long nblocks;  // -1 for an endless stream
+  unsigned threads;
+  pthread_mutex_t lock;
+  pthread_cond_t changed;
+  source sources[MAX_THREADS];
+} ring;
+
+typedef struct {
+  ring *r;
+  unsigned worker;
+} worker_arg;
+
+static void *worker_main(void *arg) {
+  const worker_arg *a = arg;
+  ring *r = a->r;
+  source *src = &r->sources[a->worker];
+
+  for (long long k = a->worker; r->nblocks < 0 || k < r->nblocks;
+       k += r->threads) {
+    const size_t s = (size_t)(k % (long long)r->nslots);
+    pthread_mutex_lock(&r->lock);
+    while (k - (long long)r->nslots > r->consumed)
+      pthread_cond_wait(&r->changed, &r->lock);
+    pthread_mutex_unlock(&r->lock);
+
+    source_fill(src, (uint64_t *)(void *)r->slots[s], r->block / 8);
+
+    pthread_mutex_lock(&r->lock);
+    r->ready[s] = k;
+    pthread_cond_broadcast(&r->changed);
+    pthread_mutex_unlock(&r->lock);
+  }
+  return NULL;
+}
+
+#if defined(__linux__)
+static int splice_all(int fd, const unsigned char *p, size_t n) {
+  while (n > 0) {
+    struct iovec iov = {(void *)p, n};
+    const ssize_t w = vmsplice(fd, &iov, 1, 0);
+    if (w < 0) {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    p += w;
+    n -= (size_t)w;
+  }
+  return 0;
+}
+
+// Size the pipe to one block where the kernel allows it. Returns the pipe's
+// capacity in bytes, or 0 if fd is not a pipe.
+static size_t setup_pipe(int fd, size_t block) {
+  struct stat st;
+  if (fstat(fd, &st) != 0 || !S_ISFIFO(st.st_mode))
+    return 0;
+  (void)fcntl(fd, F_SETPIPE_SZ, (int)block);
+  const int size = fcntl(fd, F_GETPIPE_SZ);
+  return size > 0 ? (size_t)size : 0;
+}
+#endif
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [--gen NAME] [--seed N] [--bytes N[K|M|G|T]]\n"
+          "          [--threads N] [--block N[K|M]] [--output FILE]\n"
+          "          [--no-splice] [--list]\n",
+          argv0);
+}
+
+int main(int argc, char **argv) {
+  const char *name = "cromulent128", *output = NULL;
+  uint64_t seed = DEFAULT_SEED;
+  unsigned long long limit = 0; // 0: endless
+  size_t block = DEFAULT_BLOCK;
+  unsigned threads = 1;
+  int use_splice = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "--list") == 0) {
+      source_list();
+      return 0;
+    }
+    if (strcmp(arg, "--no-splice") == 0) {
+      use_splice = 0;
+      continue;
+    }
+    const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!val) {
+      usage(argv[0]);
+      return 1;
+    }
+    unsigned long long v = 0;
+    int bad = 0;
+    if (strcmp(arg, "--gen") == 0) {
+      name = val;
+    } else if (strcmp(arg, "--seed") == 0) {
+      bad = parse_number(val, 0, 0, &v);
+      seed = v;
+    } else if (strcmp(arg, "--bytes") == 0) {
+      bad = parse_number(val, 10, 1, &limit);
+    } else if (strcmp(arg, "--threads") == 0) {
+      bad = parse_number(val, 10, 0, &v) || v > MAX_THREADS;
+      threads = (unsigned)v;
+    } else if (strcmp(arg, "--block") == 0) {
+      bad = parse_number(val, 10, 1, &v) || v > SIZE_MAX / 2;
+      block = (size_t)v;
+    } else if (strcmp(arg, "--output") == 0) {
+      output = val;
+    } else {
+      bad = 1;
+    }
+    if (bad) {
+      usage(argv[0]);
+      return 1;
+    }
+    i++;
+  }
+
+  source probe;
+  if (source_open(&probe, name) != 0) {
+    fprintf(stderr, "unknown generator '%s'; --list shows them\n", name);
+    return 1;
+  }
+  source_close(&probe);
+  if (threads < 1 || threads > MAX_THREADS || block < PAGE) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  int fd = STDOUT_FILENO;
+  if (output) {
+    fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      perror(output);
+      return 1;
+    }
+  }
+
+  // Whole pages, so that every block starts page-aligned and is spliced as
+  // whole pages
+  block = (block + PAGE - 1) / PAGE * PAGE;
+  // Blocks the writer must stay ahead of a slot before reusing it: 0 for
+  // write(), which copies; for vmsplice, as many blocks as the pipe can hold
+  // behind the one just spliced.
+  size_t lag = 0;
+#if defined(__linux__)
+  if (use_splice) {
+    const size_t capacity = setup_pipe(fd, block);
+    if (capacity > 0)
+      lag = (capacity + block - 1) / block;
+  }
+#else
+  (void)use_splice;
+#endif
+
+  static ring r;
+  r.block = block;
+  r.threads = threads;
+  r.nslots = 2 * (size_t)threads + 1 + lag;
+  r.consumed = -1;
+  r.nblocks = limit ? (long long)((limit + block - 1) / block) : -1;
+  r.slots = calloc(r.nslots, sizeof *r.slots);
+  r.ready = malloc(r.nslots * sizeof *r.ready);
+  if (!r.slots || !r.ready) {
+    perror("malloc");
+    return 1;
+  }
+  for (size_t s = 0; s < r.nslots; s++) {
+    r.ready[s] = -1;
+    if (posix_memalign((void **)&r.slots[s], PAGE, block) != 0) {
+      perror("posix_memalign");
+      return 1;
+    }
+  }
+  pthread_mutex_init(&r.lock, NULL);
+  pthread_cond_init(&r.changed, NULL);
+
+  pthread_t tids[MAX_THREADS];
+  worker_arg args[MAX_THREADS];
+  for (unsigned w = 0; w < threads; w++) {
+    if (source_open(&r.sources[w], name) != 0) {
+      perror("cromulent-stream");
+      return 1;
+    }
+    source_seed(&r.sources[w], cromulent_split_seed(seed, w));
+    args[w].r = &r;
+    args[w].worker = w;
+    if (pthread_create(&tids[w], NULL, worker_main, &args[w]) != 0) {
+      perror("pthread_create");
+      return 1;
+    }
+  }
+
+  // A consumer that has seen enough closes the pipe; report that as EPIPE
+  // and end normally instead of dying of SIGPIPE.
+  signal(SIGPIPE, SIG_IGN);
+  int status = 0;
+  for (long long k = 0; r.nblocks < 0 || k < r.nblocks; k++) {
+    const size_t s = (size_t)(k % (long long)r.nslots);
+    pthread_mutex_lock(&r.lock);
+    while (r.ready[s] != k)
+      pthread_cond_wait(&r.changed, &r.lock);
+    pthread_mutex_unlock(&r.lock);
+
+    size_t n = block;
+    if (limit && k == r.nblocks - 1 && limit % block)
+      n = (size_t)(limit % block);
+
+    int rc;
+#if defined(__linux__)
+    rc = lag ? splice_all(fd, r.slots[s], n) : write_all(fd, r.slots[s], n);
+#else
+    rc = write_all(fd, r.slots[s], n);
+#endif
+    if (rc != 0) {
+      if (errno != EPIPE) {
+        perror("cromulent-stream");
+        status = 1;
+      }
+      _exit(status);
+    }
+
+    pthread_mutex_lock(&r.lock);
+    r.consumed = k - (long long)lag;
+    pthread_cond_broadcast(&r.changed);
+    pthread_mutex_unlock(&r.lock);
+  }
+
+  for (unsigned w = 0; w < threads; w++)
+    pthread_join(tids[w], NULL);
+  if (output && close(fd) != 0) {
+    perror(output);
+    return 1;
+  }
+  return status;
+}
@@ -3,6 +3,7 @@
 // Very small smoke-test: for every registered PRNG, ensure that
 //  1) two successive values are *not* identical
 //  2) save→load round-trip reproduces the stream
+// The v2 sweep also runs two instances of each generator side by side.
 //
 // Compile with the rest of the project; link against libcromulent.
 
@@ -22,7 +23,7 @@ int main(void) {
 
   for (size_t i = 0; i < n; ++i) {
     const CromulentPRNG *g = &list[i];
-    printf("  %-12s ... ", g->name);
+    printf("  %-17s ... ", g->name);
 
     // uniqueness
     g->init(0xCAFEBABE12345678ULL);
@@ -54,6 +55,37 @@ int main(void) {
     puts("ok");
   }
 
+  const CromulentPRNG2 *list2 = cromulent_registry_v2_all(&n);
+  printf("v2 registry: %zu generators found\n", n);
+
+  for (size_t i = 0; i < n; ++i) {
+    const CromulentPRNG2 *g = &list2[i];
+    uint64_t st[16], other[16];
+    uint8_t buf[sizeof st];
+    assert(g->state_size <= sizeof st);
+    printf("  %-17s ... ", g->name);
+
+    // uniqueness, with a second instance running in between
+    g->init(st, 0xCAFEBABE12345678ULL);
+    g->init(other, 0xCAFEBABE12345678ULL);
+    uint64_t a = g->next(st);
+    g->next(other);
+    uint64_t b = g->next(st);
+    assert(a != b);
+    CHECK_EQ(b, g->next(other));
+    (void)a, (void)b; // only read by assert(), which NDEBUG builds drop
+
+    // round-trip
+    g->save(st, buf);
+    uint64_t expected[5];
+    g->fill(st, expected, 5);
+    g->load(other, buf);
+    for (int j = 0; j < 5; ++j)
+      CHECK_EQ(expected[j], g->next(other));
+
+    puts("ok");
+  }
+
   puts("All sanity checks passed.");
   return 0;
 }
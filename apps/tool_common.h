@@ -0,0 +1,203 @@
+// apps/tool_common.h
+//
+// Pieces shared by the command-line tools (POSIX only): the number parser
+// behind their options, write_all, and a source, one instance of any stream
+// the tools can run. Sources are the v2 registry entries plus
+// "cromulent_bulk" and "cromulent_strong_bulk", the cromulent_fill_u64 and
+// cromulent_strong_fill_u64 streams.
+
+#ifndef CROMULENT_TOOL_COMMON_H
+#define CROMULENT_TOOL_COMMON_H
+
+#include "cromulent.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define BULK_NAME "cromulent_bulk"
+#define STRONG_BULK_NAME "cromulent_strong_bulk"
+
+typedef enum { SRC_REGISTRY, SRC_BULK, SRC_STRONG_BULK } source_kind;
+
+typedef struct {
+  source_kind kind;
+  const CromulentPRNG2 *gen;
+  void *state;
+  cromulent_bulk_state bulk;
+  cromulent_strong_bulk_state strong;
+} source;
+
+static inline void store_le64(uint8_t *out, uint64_t v) {
+  for (int b = 0; b < 8; b++)
+    out[b] = (uint8_t)(v >> (8 * b));
+}
+
+static inline uint64_t load_le64(const uint8_t *in) {
+  uint64_t v = 0;
+  for (int b = 0; b < 8; b++)
+    v |= (uint64_t)in[b] << (8 * b);
+  return v;
+}
+
+// Parse an unsigned number in the given base (0: C prefixes) that fills the
+// whole string, with an optional K, M, G or T suffix when units is set.
+// Returns -1 for anything else, signs and overflow included.
+static inline int parse_number(const char *s, int base, int units,
+                               unsigned long long *out) {
+  if (*s < '0' || *s > '9')
+    return -1;
+  char *end;
+  errno = 0;
+  const unsigned long long v = strtoull(s, &end, base);
+  if (errno != 0)
+    return -1;
+  int shift = 0;
+  if (units && *end) {
+    static const char upper[] = "KMGT", lower[] = "kmgt";
+    for (int u = 0; u < 4; u++) {
+      if (*end == upper[u] || *end == lower[u]) {
+        shift = 10 * (u + 1);
+        end++;
+        break;
+      }
+    }
+  }
+  if (*end != '\0' || v > (ULLONG_MAX >> shift))
+    return -1;
+  *out = v << shift;
+  return 0;
+}
+
+static inline int write_all(int fd, const unsigned char *p, size_t n) {
+  while (n > 0) {
+    const ssize_t w = write(fd, p, n);
+    if (w < 0) {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    p += w;
+    n -= (size_t)w;
+  }
+  return 0;
+}
+
+// Print the names source_open accepts, one per line
+static inline void source_list(void) {
+  size_t count;
+  const CromulentPRNG2 *all = cromulent_registry_v2_all(&count);
+  for (size_t i = 0; i < count; i++)
+    printf("%s\n", all[i].name);
+  printf("%s\n%s\n", BULK_NAME, STRONG_BULK_NAME);
+}
+
+// Returns -1 with errno set for an unknown name (ENOENT) or a failed
+// allocation. An open source must be seeded before it is filled.
+static inline int source_open(source *src, const char *name) {
+  memset(src, 0, sizeof *src);
+  if (strcmp(name, BULK_NAME) == 0)
+    src->kind = SRC_BULK;
+  else if (strcmp(name, STRONG_BULK_NAME) == 0)
+    src->kind = SRC_STRONG_BULK;
+  else if ((src->gen = cromulent_registry_v2_find(name))) {
+    src->kind = SRC_REGISTRY;
+    src->state = malloc(src->gen->state_size);
+    if (!src->state)
+      return -1;
+  } else {
+    errno = ENOENT;
+    return -1;
+  }
+  return 0;
+}
+
+static inline void source_close(source *src) { free(src->state); }
+
+static inline void source_seed(source *src, uint64_t seed) {
+  switch (src->kind) {
+  case SRC_REGISTRY:
+    src->gen->init(src->state, seed);
+    break;
+  case SRC_BULK:
+    cromulent_bulk_init(&src->bulk, seed);
+    break;
+  case SRC_STRONG_BULK:
+    cromulent_strong_bulk_init(&src->strong, seed);
+    break;
+  }
+}
+
+// Next n words of the stream, in native byte order
+static inline void source_fill(source *src, uint64_t *dst, size_t n) {
+  switch (src->kind) {
+  case SRC_REGISTRY:
+    src->gen->fill(src->state, dst, n);
+    break;
+  case SRC_BULK:
+    cromulent_fill_u64(&src->bulk, dst, n);
+    break;
+  case SRC_STRONG_BULK:
+    cromulent_strong_fill_u64(&src->strong, dst, n);
+    break;
+  }
+}
+
+static inline size_t source_state_size(const source *src) {
+  return src->kind == SRC_REGISTRY ? src->gen->state_size
+                                   : 16 * CROMULENT_BULK_LANES;
+}
+
+// Only valid where a bulk state has no buffered step, after a whole number
+// of blocks, since its lanes are all that is saved: lane i of cromulent_bulk
+// in the cromulent_save format, and (a[i], b[i]) of cromulent_strong_bulk.
+static inline void source_save(const source *src, uint8_t *out) {
+  switch (src->kind) {
+  case SRC_REGISTRY:
+    src->gen->save(src->state, out);
+    break;
+  case SRC_BULK:
+    for (int i = 0; i < CROMULENT_BULK_LANES; i++) {
+      const cromulent_state lane = {src->bulk.s0[i], src->bulk.s1[i]};
+      cromulent_save(&lane, out + 16 * i);
+    }
+    break;
+  case SRC_STRONG_BULK:
+    for (int i = 0; i < CROMULENT_BULK_LANES; i++) {
+      store_le64(out + 16 * i, src->strong.a[i]);
+      store_le64(out + 16 * i + 8, src->strong.b[i]);
+    }
+    break;
+  }
+}
+
+static inline void source_load(source *src, const uint8_t *in) {
+  switch (src->kind) {
+  case SRC_REGISTRY:
+    src->gen->load(src->state, in);
+    return;
+  case SRC_BULK:
+    for (int i = 0; i < CROMULENT_BULK_LANES; i++) {
+      cromulent_state lane;
+      cromulent_load(&lane, in + 16 * i);
+      src->bulk.s0[i] = lane.s0;
+      src->bulk.s1[i] = lane.s1;
+    }
+    memset(src->bulk.block, 0, sizeof src->bulk.block);
+    src->bulk.pos = sizeof src->bulk.block;
+    return;
+  case SRC_STRONG_BULK:
+    for (int i = 0; i < CROMULENT_BULK_LANES; i++) {
+      src->strong.a[i] = load_le64(in + 16 * i);
+      src->strong.b[i] = load_le64(in + 16 * i + 8);
+    }
+    memset(src->strong.block, 0, sizeof src->strong.block);
+    src->strong.pos = sizeof src->strong.block;
+    return;
+  }
+}
+
+#endif // CROMULENT_TOOL_COMMON_H
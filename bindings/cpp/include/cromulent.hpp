@@ -12,7 +12,15 @@
 // so they interoperate directly with std::uniform_int_distribution,
 // std::uniform_real_distribution, std::shuffle, std::sample, etc.
 //
-// Resource management follows the rule of zero: the state is a pair of value
+// cromulent::bulk_engine is the multi-lane generator behind the C bulk API
+// (cromulent_bulk_init / cromulent_fill_u64): the same words in the same
+// order, generated with AVX-512 when the including translation unit is
+// compiled for it, with AVX2 when it is compiled for it or (GCC and Clang on
+// x86-64) when the CPU has it, and with plain interleaved lanes otherwise.
+// cromulent::simd_engine<N> exposes the same lane kernels for N = 1 to 16
+// lanes, matching the C multi-lane generators block for block.
+//
+// Resource management follows the rule of zero: the state is held in value
 // members, so construction, copy, move, and destruction are all trivially and
 // correctly handled by the compiler. There are no owning pointers, no manual
 // new/delete, and every object is fully initialized by its constructor.
@@ -22,11 +30,44 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <initializer_list>
 #include <istream>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
+
+// AVX2 lane kernels: always used when the translation unit targets AVX2, and
+// on other x86-64 GCC / Clang builds compiled for AVX2 by function attribute
+// and used when the CPU reports it.
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+#define CROMULENT_HPP_AVX512 1
+#endif
+#if defined(__AVX2__)
+#define CROMULENT_HPP_AVX2 1
+#define CROMULENT_HPP_AVX2_TARGET
+#elif defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CROMULENT_HPP_AVX2 2
+#define CROMULENT_HPP_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#if defined(CROMULENT_HPP_AVX2) || defined(CROMULENT_HPP_AVX512)
+#include <immintrin.h>
+#endif
+
+// engine and strong_engine are constexpr from C++17. The multi-lane engines
+// need std::is_constant_evaluated to keep the vector kernels out of constant
+// evaluation, so they are constexpr from C++20.
+#if defined(__cpp_lib_is_constant_evaluated)
+#define CROMULENT_CONSTEXPR20 constexpr
+#else
+#define CROMULENT_CONSTEXPR20
+#endif
 
 namespace cromulent {
 
@@ -35,6 +76,8 @@ namespace detail {
 inline constexpr std::uint64_t C1 = 0x9e3779b97f4a7c15ULL;
 inline constexpr std::uint64_t C2 = 0xbf58476d1ce4e5b9ULL;
 inline constexpr std::uint64_t C3 = 0x94d049bb133111ebULL;
+inline constexpr std::uint64_t C4 = 0xff51afd7ed558ccdULL;
+inline constexpr std::uint64_t C5 = 0xc4ceb9fe1a85ec53ULL;
 inline constexpr std::uint64_t C6 = 0xd1342543de82ef95ULL;
 inline constexpr std::uint64_t MH3 = 0xd6e8feb86659fd93ULL;
 
@@ -49,6 +92,15 @@ inline constexpr std::uint64_t MH3 = 0xd6e8feb86659fd93ULL;
   return x;
 }
 
+[[nodiscard]] constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+  x ^= x >> 33;
+  x *= C4;
+  x ^= x >> 33;
+  x *= C5;
+  x ^= x >> 33;
+  return x;
+}
+
 // SplitMix64-style seed expansion, matching cromulent_init in the C library.
 [[nodiscard]] constexpr std::uint64_t seed_step(std::uint64_t &z) noexcept {
   z += C1;
@@ -57,14 +109,275 @@ inline constexpr std::uint64_t MH3 = 0xd6e8feb86659fd93ULL;
   return z ^ (z >> 31);
 }
 
+// One cromulent128 step: the transition and output function of
+// cromulent_next, shared by the scalar engine and every lane of bulk_engine.
+constexpr std::uint64_t step(std::uint64_t &s0, std::uint64_t &s1) noexcept {
+  const std::uint64_t a = s0;
+  const std::uint64_t b = s1;
+
+  s0 = a * C6 + b;
+  s1 = rotl(b, 31) + mix_fast(a);
+
+  std::uint64_t result = a + rotl(b, 11);
+  result ^= result >> 27;
+  result *= C3;
+  result ^= result >> 27;
+  return result;
+}
+
+[[nodiscard]] constexpr double to_double(std::uint64_t x) noexcept {
+  return static_cast<double>(x >> 11) * 0x1.0p-53;
+}
+
+[[nodiscard]] constexpr float to_float(std::uint32_t x) noexcept {
+  return static_cast<float>(x >> 8) * 0x1.0p-24f;
+}
+
+#if defined(CROMULENT_HPP_AVX2)
+CROMULENT_HPP_AVX2_TARGET inline __m256i rotl_avx2(__m256i x,
+                                                   int k) noexcept {
+  return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+}
+
+// AVX2 has no 64-bit low multiply; build it from three 32x32-bit products.
+CROMULENT_HPP_AVX2_TARGET inline __m256i mullo_avx2(__m256i a,
+                                                    __m256i b) noexcept {
+  const __m256i albl = _mm256_mul_epu32(a, b);
+  const __m256i albh = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+  const __m256i ahbl = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+  return _mm256_add_epi64(
+      albl, _mm256_slli_epi64(_mm256_add_epi64(albh, ahbl), 32));
+}
+
+// step() on four lanes, like cromulent_step_avx2 in the C library.
+CROMULENT_HPP_AVX2_TARGET inline __m256i step_avx2(__m256i &s0,
+                                                   __m256i &s1) noexcept {
+  const __m256i a = s0;
+  const __m256i b = s1;
+  const __m256i mh3 = _mm256_set1_epi64x(static_cast<long long>(MH3));
+
+  __m256i m = _mm256_xor_si256(a, _mm256_srli_epi64(a, 32));
+  m = mullo_avx2(m, mh3);
+  m = _mm256_xor_si256(m, _mm256_srli_epi64(m, 32));
+
+  s0 = _mm256_add_epi64(
+      mullo_avx2(a, _mm256_set1_epi64x(static_cast<long long>(C6))), b);
+  s1 = _mm256_add_epi64(rotl_avx2(b, 31), m);
+
+  __m256i result = _mm256_add_epi64(a, rotl_avx2(b, 11));
+  result = _mm256_xor_si256(result, _mm256_srli_epi64(result, 27));
+  result = mullo_avx2(result, _mm256_set1_epi64x(static_cast<long long>(C3)));
+  return _mm256_xor_si256(result, _mm256_srli_epi64(result, 27));
+}
+#endif
+
+#if defined(CROMULENT_HPP_AVX512)
+// The all-lanes maskz forms: the unmasked shift and rotate intrinsics trip
+// -Wmaybe-uninitialized in GCC 12's C++ headers.
+template <int K> inline __m512i srli_avx512(__m512i x) noexcept {
+  return _mm512_maskz_srli_epi64(0xFF, x, K);
+}
+
+template <int K> inline __m512i rol_avx512(__m512i x) noexcept {
+  return _mm512_maskz_rol_epi64(0xFF, x, K);
+}
+
+// step() on eight lanes with the native 64-bit multiply and rotate.
+inline __m512i step_avx512(__m512i &s0, __m512i &s1) noexcept {
+  const __m512i a = s0;
+  const __m512i b = s1;
+
+  __m512i m = _mm512_xor_si512(a, srli_avx512<32>(a));
+  m = _mm512_mullo_epi64(m, _mm512_set1_epi64(static_cast<long long>(MH3)));
+  m = _mm512_xor_si512(m, srli_avx512<32>(m));
+
+  s0 = _mm512_add_epi64(
+      _mm512_mullo_epi64(a, _mm512_set1_epi64(static_cast<long long>(C6))), b);
+  s1 = _mm512_add_epi64(rol_avx512<31>(b), m);
+
+  __m512i result = _mm512_add_epi64(a, rol_avx512<11>(b));
+  result = _mm512_xor_si512(result, srli_avx512<27>(result));
+  result = _mm512_mullo_epi64(
+      result, _mm512_set1_epi64(static_cast<long long>(C3)));
+  return _mm512_xor_si512(result, srli_avx512<27>(result));
+}
+#endif
+
+#if defined(CROMULENT_HPP_AVX2)
+template <std::size_t Lanes>
+CROMULENT_HPP_AVX2_TARGET void fill_lanes_avx2(std::uint64_t *s0,
+                                               std::uint64_t *s1,
+                                               std::uint64_t *dst,
+                                               std::size_t steps) noexcept {
+  constexpr std::size_t V = Lanes / 4;
+  __m256i a[V], b[V];
+  for (std::size_t v = 0; v < V; ++v) {
+    a[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s0 + 4 * v));
+    b[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s1 + 4 * v));
+  }
+  for (std::size_t i = 0; i < steps; ++i, dst += Lanes)
+    for (std::size_t v = 0; v < V; ++v)
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 4 * v),
+                          step_avx2(a[v], b[v]));
+  for (std::size_t v = 0; v < V; ++v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(s0 + 4 * v), a[v]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(s1 + 4 * v), b[v]);
+  }
+}
+#endif
+
+#if defined(CROMULENT_HPP_AVX512)
+template <std::size_t Lanes>
+inline void fill_lanes_avx512(std::uint64_t *s0, std::uint64_t *s1,
+                              std::uint64_t *dst, std::size_t steps) noexcept {
+  constexpr std::size_t V = Lanes / 8;
+  __m512i a[V], b[V];
+  for (std::size_t v = 0; v < V; ++v) {
+    a[v] = _mm512_loadu_si512(s0 + 8 * v);
+    b[v] = _mm512_loadu_si512(s1 + 8 * v);
+  }
+  for (std::size_t i = 0; i < steps; ++i, dst += Lanes)
+    for (std::size_t v = 0; v < V; ++v)
+      _mm512_storeu_si512(dst + 8 * v, step_avx512(a[v], b[v]));
+  for (std::size_t v = 0; v < V; ++v) {
+    _mm512_storeu_si512(s0 + 8 * v, a[v]);
+    _mm512_storeu_si512(s1 + 8 * v, b[v]);
+  }
+}
+#endif
+
+// The portable lane kernel, also the one constant evaluation uses. Lanes go
+// in pairs held in locals, which is enough to hide the multiply latency, and
+// since each pair revisits the output it is walked in runs that stay in L1.
+template <std::size_t Lanes>
+constexpr void fill_lanes_scalar(std::uint64_t *s0, std::uint64_t *s1,
+                                 std::uint64_t *dst,
+                                 std::size_t steps) noexcept {
+  if constexpr (Lanes == 1) {
+    std::uint64_t a = s0[0], b = s1[0];
+    for (std::size_t i = 0; i < steps; ++i)
+      dst[i] = step(a, b);
+    s0[0] = a;
+    s1[0] = b;
+  } else {
+    static_assert(Lanes % 2 == 0, "lanes are run in pairs");
+    constexpr std::size_t run = 4096 / Lanes;
+    for (std::size_t done = 0; done < steps; done += run) {
+      const std::size_t todo = std::min(run, steps - done);
+      for (std::size_t l = 0; l < Lanes; l += 2) {
+        std::uint64_t a0 = s0[l], a1 = s0[l + 1];
+        std::uint64_t b0 = s1[l], b1 = s1[l + 1];
+        std::uint64_t *out = dst + done * Lanes + l;
+        for (std::size_t i = 0; i < todo; ++i, out += Lanes) {
+          out[0] = step(a0, b0);
+          out[1] = step(a1, b1);
+        }
+        s0[l] = a0;
+        s0[l + 1] = a1;
+        s1[l] = b0;
+        s1[l + 1] = b1;
+      }
+    }
+  }
+}
+
+// Run Lanes independent lanes for `steps` steps, writing steps * Lanes words
+// to dst step-major, like cromulent_lanes_fill. The widest vector kernel
+// available runs all lanes of a step side by side; constant evaluation
+// (C++20) and targets without one use the portable kernel.
+template <std::size_t Lanes>
+CROMULENT_CONSTEXPR20 void fill_lanes(std::uint64_t *s0, std::uint64_t *s1,
+                                      std::uint64_t *dst,
+                                      std::size_t steps) noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+  if (std::is_constant_evaluated()) {
+    fill_lanes_scalar<Lanes>(s0, s1, dst, steps);
+    return;
+  }
+#endif
+#if defined(CROMULENT_HPP_AVX512)
+  if constexpr (Lanes % 8 == 0) {
+    fill_lanes_avx512<Lanes>(s0, s1, dst, steps);
+    return;
+  }
+#endif
+#if defined(CROMULENT_HPP_AVX2)
+  if constexpr (Lanes % 4 == 0) {
+#if CROMULENT_HPP_AVX2 == 2
+    if (__builtin_cpu_supports("avx2"))
+#endif
+    {
+      fill_lanes_avx2<Lanes>(s0, s1, dst, steps);
+      return;
+    }
+  }
+#endif
+  fill_lanes_scalar<Lanes>(s0, s1, dst, steps);
+}
+
+// Range and iterator forms of an engine's pointer-based fills. Derived
+// provides fill, fill_double and fill_float over (pointer, count); these
+// accept any contiguous range with std::data / std::size, such as
+// std::vector, std::array or std::span.
+template <class Derived> class fill_interface {
+public:
+  template <class Range>
+  constexpr auto fill(Range &&r)
+      -> decltype(std::data(r), std::size(r), void()) {
+    static_assert(std::is_same_v<std::remove_cv_t<std::remove_pointer_t<
+                                     decltype(std::data(r))>>,
+                                 std::uint64_t>,
+                  "fill needs a contiguous range of std::uint64_t");
+    self().fill(std::data(r), std::size(r));
+  }
+
+  template <class Range>
+  constexpr auto fill_double(Range &&r)
+      -> decltype(std::data(r), std::size(r), void()) {
+    self().fill_double(std::data(r), std::size(r));
+  }
+
+  template <class Range>
+  constexpr auto fill_float(Range &&r)
+      -> decltype(std::data(r), std::size(r), void()) {
+    self().fill_float(std::data(r), std::size(r));
+  }
+
+  // Assign successive outputs to [first, last), as std::generate with the
+  // engine would. Pointers to std::uint64_t (and, from C++20, any contiguous
+  // iterator over them) take the bulk path.
+  template <class It> constexpr void generate(It first, It last) {
+    using value = typename std::iterator_traits<It>::value_type;
+#if defined(__cpp_lib_concepts)
+    constexpr bool contiguous = std::contiguous_iterator<It>;
+#else
+    constexpr bool contiguous = std::is_pointer_v<It>;
+#endif
+    if constexpr (contiguous && std::is_same_v<value, std::uint64_t>) {
+      if (first != last)
+        self().fill(std::addressof(*first),
+                    static_cast<std::size_t>(last - first));
+    } else {
+      for (; first != last; ++first)
+        *first = static_cast<value>(self()());
+    }
+  }
+
+private:
+  constexpr Derived &self() noexcept { return static_cast<Derived &>(*this); }
+};
+
 } // namespace detail
 
 // The primary Cromulent engine. Equivalent to the scalar C generator:
 // cromulent_init / cromulent_next produce the identical stream for a given
 // 64-bit seed.
-class engine {
+class engine : public detail::fill_interface<engine> {
 public:
   using result_type = std::uint64_t;
+  using detail::fill_interface<engine>::fill;
+  using detail::fill_interface<engine>::fill_double;
+  using detail::fill_interface<engine>::fill_float;
 
   static constexpr result_type default_seed = 0x853c49e6748fea9bULL;
 
@@ -74,7 +387,9 @@ public:
   }
 
   // Seed from a single 64-bit value. Matches cromulent_init exactly.
-  explicit engine(result_type value = default_seed) noexcept { seed(value); }
+  constexpr explicit engine(result_type value = default_seed) noexcept {
+    seed(value);
+  }
 
   // Seed from a standard SeedSequence (e.g. std::seed_seq, std::random_device
   // wrapper). SFINAE keeps this from hijacking the integer-seed constructor.
@@ -87,7 +402,7 @@ public:
     seed(q);
   }
 
-  void seed(result_type value = default_seed) noexcept {
+  constexpr void seed(result_type value = default_seed) noexcept {
     std::uint64_t z = value;
     s0_ = detail::seed_step(z);
     s1_ = detail::seed_step(z);
@@ -107,39 +422,72 @@ public:
 
   // Advance the state and return the next 64-bit output. Mirrors
   // cromulent_next byte-for-byte.
-  result_type operator()() noexcept {
-    const std::uint64_t s0 = s0_;
-    const std::uint64_t s1 = s1_;
+  constexpr result_type operator()() noexcept {
+    return detail::step(s0_, s1_);
+  }
+
+  // The next n outputs, exactly as n calls to operator() would give them, with
+  // the state held in registers for the whole loop. This is one serial chain;
+  // bulk_engine runs sixteen for throughput.
+  constexpr void fill(std::uint64_t *dst, std::size_t n) noexcept {
+    std::uint64_t s0 = s0_, s1 = s1_;
+    for (std::size_t i = 0; i < n; ++i)
+      dst[i] = detail::step(s0, s1);
+    s0_ = s0;
+    s1_ = s1;
+  }
 
-    s0_ = s0 * detail::C6 + s1;
-    s1_ = detail::rotl(s1, 31) + detail::mix_fast(s0);
+  // n calls to next_double() / next_float(), one output each.
+  constexpr void fill_double(double *dst, std::size_t n) noexcept {
+    std::uint64_t s0 = s0_, s1 = s1_;
+    for (std::size_t i = 0; i < n; ++i)
+      dst[i] = detail::to_double(detail::step(s0, s1));
+    s0_ = s0;
+    s1_ = s1;
+  }
+
+  constexpr void fill_float(float *dst, std::size_t n) noexcept {
+    std::uint64_t s0 = s0_, s1 = s1_;
+    for (std::size_t i = 0; i < n; ++i)
+      dst[i] = detail::to_float(
+          static_cast<std::uint32_t>(detail::step(s0, s1) >> 32));
+    s0_ = s0;
+    s1_ = s1;
+  }
 
-    std::uint64_t result = s0 + detail::rotl(s1, 11);
-    result ^= result >> 27;
-    result *= detail::C3;
-    result ^= result >> 27;
-    return result;
+  // Engine for substream `stream` of this one, leaving *this untouched.
+  // Mirrors cromulent_split: distinct ids always give distinct states, so
+  // parallel workers can each take split(rank) of a shared master engine.
+  [[nodiscard]] constexpr engine split(std::uint64_t stream) const noexcept {
+    const std::uint64_t k0 = detail::mix(stream * detail::C1 + detail::C2);
+    const std::uint64_t k1 = detail::mix(k0 ^ detail::C5);
+    engine child;
+    child.s0_ = detail::mix(s0_ ^ k0);
+    child.s1_ = detail::mix(s1_ ^ k1);
+    if ((child.s0_ | child.s1_) == 0)
+      child.s1_ = detail::C1;
+    return child;
   }
 
   // Advance the stream by z steps, discarding the output.
-  void discard(unsigned long long z) noexcept {
+  constexpr void discard(unsigned long long z) noexcept {
     while (z-- != 0)
       (void)(*this)();
   }
 
   // Uniform double in [0, 1) using the top 53 bits.
-  [[nodiscard]] double next_double() noexcept {
-    return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+  [[nodiscard]] constexpr double next_double() noexcept {
+    return detail::to_double((*this)());
   }
 
   // Uniform float in [0, 1) using the top 24 bits.
-  [[nodiscard]] float next_float() noexcept {
-    return static_cast<float>((*this)() >> 40) * 0x1.0p-24f;
+  [[nodiscard]] constexpr float next_float() noexcept {
+    return detail::to_float(static_cast<std::uint32_t>((*this)() >> 32));
   }
 
   // Unbiased uniform integer in [0, n) via Lemire's method. Returns 0 when
   // n == 0. Provided as a fast path; std::uniform_int_distribution also works.
-  [[nodiscard]] result_type bounded(result_type n) noexcept {
+  [[nodiscard]] constexpr result_type bounded(result_type n) noexcept {
     if (n == 0)
       return 0;
     __extension__ using u128 = unsigned __int128;
@@ -157,12 +505,12 @@ public:
     return static_cast<result_type>(m >> 64);
   }
 
-  [[nodiscard]] friend bool operator==(const engine &a,
-                                       const engine &b) noexcept {
+  [[nodiscard]] friend constexpr bool operator==(const engine &a,
+                                                 const engine &b) noexcept {
     return a.s0_ == b.s0_ && a.s1_ == b.s1_;
   }
-  [[nodiscard]] friend bool operator!=(const engine &a,
-                                       const engine &b) noexcept {
+  [[nodiscard]] friend constexpr bool operator!=(const engine &a,
+                                                 const engine &b) noexcept {
     return !(a == b);
   }
 
@@ -202,17 +550,17 @@ public:
     return std::numeric_limits<result_type>::max();
   }
 
-  explicit strong_engine(result_type value = default_seed) noexcept {
+  constexpr explicit strong_engine(result_type value = default_seed) noexcept {
     seed(value);
   }
 
-  void seed(result_type value = default_seed) noexcept {
+  constexpr void seed(result_type value = default_seed) noexcept {
     std::uint64_t z = value;
     a_ = detail::seed_step(z);
     b_ = detail::seed_step(z);
   }
 
-  result_type operator()() noexcept {
+  constexpr result_type operator()() noexcept {
     std::uint64_t a = a_;
     std::uint64_t b = b_;
 
@@ -233,17 +581,17 @@ public:
     return detail::mix_fast(output);
   }
 
-  void discard(unsigned long long z) noexcept {
+  constexpr void discard(unsigned long long z) noexcept {
     while (z-- != 0)
       (void)(*this)();
   }
 
-  [[nodiscard]] friend bool operator==(const strong_engine &x,
-                                       const strong_engine &y) noexcept {
+  [[nodiscard]] friend constexpr bool
+  operator==(const strong_engine &x, const strong_engine &y) noexcept {
     return x.a_ == y.a_ && x.b_ == y.b_;
   }
-  [[nodiscard]] friend bool operator!=(const strong_engine &x,
-                                       const strong_engine &y) noexcept {
+  [[nodiscard]] friend constexpr bool
+  operator!=(const strong_engine &x, const strong_engine &y) noexcept {
     return !(x == y);
   }
 
@@ -269,6 +617,501 @@ private:
   std::uint64_t b_ = 0;
 };
 
+// The multi-lane generator behind the C bulk API. Sixteen cromulent128 lanes
+// are seeded like cromulent_bulk_init and step together; the output is
+// step-major, one word from every lane in lane order. operator() and fill()
+// return the cromulent_fill_u64 stream for the same seed, fill_double() and
+// fill_float() the cromulent_fill_double / cromulent_fill_float values, and
+// mixing calls splits the stream exactly as mixing the C calls does. The
+// words do not depend on the instruction set the header is compiled for.
+class bulk_engine : public detail::fill_interface<bulk_engine> {
+public:
+  using result_type = std::uint64_t;
+  using detail::fill_interface<bulk_engine>::fill;
+  using detail::fill_interface<bulk_engine>::fill_double;
+  using detail::fill_interface<bulk_engine>::fill_float;
+
+  static constexpr std::size_t lanes = 16;
+  static constexpr result_type default_seed = engine::default_seed;
+
+  [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+  [[nodiscard]] static constexpr result_type max() noexcept {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  CROMULENT_CONSTEXPR20 explicit bulk_engine(
+      result_type value = default_seed) noexcept {
+    seed(value);
+  }
+
+  CROMULENT_CONSTEXPR20 void seed(result_type value = default_seed) noexcept {
+    std::uint64_t z = value;
+    for (auto &w : s0_)
+      w = detail::seed_step(z);
+    for (auto &w : s1_)
+      w = detail::seed_step(z);
+    block_.fill(0);
+    pos_ = block_bytes;
+  }
+
+  CROMULENT_CONSTEXPR20 result_type operator()() noexcept {
+    std::size_t word = (pos_ + 7) / 8;
+    if (word == lanes) {
+      refill();
+      word = 0;
+    }
+    pos_ = static_cast<std::uint32_t>((word + 1) * 8);
+    return block_[word];
+  }
+
+  // cromulent_fill_u64: finish the buffered step from the next whole word,
+  // generate whole steps straight into dst, and buffer one more for the tail.
+  CROMULENT_CONSTEXPR20 void fill(std::uint64_t *dst, std::size_t n) noexcept {
+    if (n == 0)
+      return;
+    std::size_t word = (pos_ + 7) / 8;
+    for (; n > 0 && word < lanes; --n)
+      *dst++ = block_[word++];
+    pos_ = static_cast<std::uint32_t>(word * 8);
+
+    const std::size_t full = n / lanes;
+    if (full > 0) {
+      detail::fill_lanes<lanes>(s0_.data(), s1_.data(), dst, full);
+      dst += full * lanes;
+      n -= full * lanes;
+    }
+    if (n > 0) {
+      refill();
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] = block_[i];
+      pos_ = static_cast<std::uint32_t>(n * 8);
+    }
+  }
+
+  // Doubles take whole words like fill(); the words are generated into a
+  // stack chunk and converted with next_double's scaling.
+  CROMULENT_CONSTEXPR20 void fill_double(double *dst, std::size_t n) noexcept {
+    if (n == 0)
+      return;
+    std::size_t word = (pos_ + 7) / 8;
+    for (; n > 0 && word < lanes; --n)
+      *dst++ = detail::to_double(block_[word++]);
+    pos_ = static_cast<std::uint32_t>(word * 8);
+
+    std::uint64_t chunk[chunk_steps * lanes];
+    while (n >= lanes) {
+      const std::size_t steps = std::min(n / lanes, chunk_steps);
+      detail::fill_lanes<lanes>(s0_.data(), s1_.data(), chunk, steps);
+      for (std::size_t i = 0; i < steps * lanes; ++i)
+        dst[i] = detail::to_double(chunk[i]);
+      dst += steps * lanes;
+      n -= steps * lanes;
+    }
+    if (n > 0) {
+      refill();
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] = detail::to_double(block_[i]);
+      pos_ = static_cast<std::uint32_t>(n * 8);
+    }
+  }
+
+  // Floats take 32-bit halves, low half of each word first, so every word
+  // yields two.
+  CROMULENT_CONSTEXPR20 void fill_float(float *dst, std::size_t n) noexcept {
+    if (n == 0)
+      return;
+    constexpr std::size_t halves = 2 * lanes;
+    std::size_t half = (pos_ + 3) / 4;
+    for (; n > 0 && half < halves; --n)
+      *dst++ = detail::to_float(block_half(half++));
+    pos_ = static_cast<std::uint32_t>(half * 4);
+
+    std::uint64_t chunk[chunk_steps * lanes];
+    while (n >= halves) {
+      const std::size_t steps = std::min(n / halves, chunk_steps);
+      detail::fill_lanes<lanes>(s0_.data(), s1_.data(), chunk, steps);
+      for (std::size_t i = 0; i < steps * lanes; ++i) {
+        dst[2 * i] = detail::to_float(static_cast<std::uint32_t>(chunk[i]));
+        dst[2 * i + 1] =
+            detail::to_float(static_cast<std::uint32_t>(chunk[i] >> 32));
+      }
+      dst += steps * halves;
+      n -= steps * halves;
+    }
+    if (n > 0) {
+      refill();
+      for (std::size_t i = 0; i < n; ++i)
+        dst[i] = detail::to_float(block_half(i));
+      pos_ = static_cast<std::uint32_t>(n * 4);
+    }
+  }
+
+  // Advance by z words, as z calls to operator() would.
+  CROMULENT_CONSTEXPR20 void discard(unsigned long long z) noexcept {
+    while (z-- != 0)
+      (void)(*this)();
+  }
+
+  [[nodiscard]] friend CROMULENT_CONSTEXPR20 bool
+  operator==(const bulk_engine &x, const bulk_engine &y) noexcept {
+    return x.s0_ == y.s0_ && x.s1_ == y.s1_ && x.pos_ == y.pos_ &&
+           std::equal(x.block_.begin() + x.pos_ / 8, x.block_.end(),
+                      y.block_.begin() + y.pos_ / 8);
+  }
+  [[nodiscard]] friend CROMULENT_CONSTEXPR20 bool
+  operator!=(const bulk_engine &x, const bulk_engine &y) noexcept {
+    return !(x == y);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &
+  operator<<(std::basic_ostream<CharT, Traits> &os, const bulk_engine &e) {
+    for (std::uint64_t w : e.s0_)
+      os << w << ' ';
+    for (std::uint64_t w : e.s1_)
+      os << w << ' ';
+    for (std::uint64_t w : e.block_)
+      os << w << ' ';
+    return os << e.pos_;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &
+  operator>>(std::basic_istream<CharT, Traits> &is, bulk_engine &e) {
+    bulk_engine t;
+    for (auto *words : {&t.s0_, &t.s1_, &t.block_})
+      for (std::uint64_t &w : *words)
+        is >> w;
+    if (is >> t.pos_ && t.pos_ <= block_bytes)
+      e = t;
+    else
+      is.setstate(std::ios_base::failbit);
+    return is;
+  }
+
+private:
+  static constexpr std::uint32_t block_bytes = lanes * 8;
+  // Steps generated per round when converting through a stack buffer.
+  static constexpr std::size_t chunk_steps = 64;
+
+  CROMULENT_CONSTEXPR20 void refill() noexcept {
+    detail::fill_lanes<lanes>(s0_.data(), s1_.data(), block_.data(), 1);
+  }
+
+  [[nodiscard]] CROMULENT_CONSTEXPR20 std::uint32_t
+  block_half(std::size_t h) const noexcept {
+    return static_cast<std::uint32_t>(block_[h / 2] >> (32 * (h % 2)));
+  }
+
+  std::array<std::uint64_t, lanes> s0_{};
+  std::array<std::uint64_t, lanes> s1_{};
+  std::array<std::uint64_t, lanes> block_{};
+  std::uint32_t pos_ = block_bytes; // bytes of block_ already handed out
+};
+
+// N cromulent128 lanes stepped together, for N = 1, 2, 4, 8 or 16. Lane i is
+// seeded from words i and N + i of the seed expansion, like cromulent_x4_init
+// and cromulent_avx2_init, so simd_engine<1> gives the engine stream,
+// simd_engine<4> the cromulent_avx2_next (and cromulent_x4) stream,
+// simd_engine<8> the cromulent_avx512_next stream and simd_engine<16> the
+// cromulent_fill_u64 stream. next_block() returns one step of every lane in
+// lane order; operator() hands out the same words one at a time from a
+// buffered block, so the engine is a UniformRandomBitGenerator whose stream
+// is the concatenation of the blocks. The lane kernel is picked at compile
+// time from N and the instruction sets available, as for bulk_engine.
+template <std::size_t N>
+class simd_engine : public detail::fill_interface<simd_engine<N>> {
+  static_assert(N == 1 || N == 2 || N == 4 || N == 8 || N == 16,
+                "simd_engine supports 1, 2, 4, 8 or 16 lanes");
+  using base = detail::fill_interface<simd_engine<N>>;
+
+public:
+  using result_type = std::uint64_t;
+  using block_type = std::array<std::uint64_t, N>;
+  using base::fill;
+  using base::fill_double;
+  using base::fill_float;
+
+  static constexpr std::size_t lanes = N;
+  static constexpr result_type default_seed = engine::default_seed;
+
+  [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+  [[nodiscard]] static constexpr result_type max() noexcept {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  CROMULENT_CONSTEXPR20 explicit simd_engine(
+      result_type value = default_seed) noexcept {
+    seed(value);
+  }
+
+  CROMULENT_CONSTEXPR20 void seed(result_type value = default_seed) noexcept {
+    std::uint64_t z = value;
+    for (auto &w : s0_)
+      w = detail::seed_step(z);
+    for (auto &w : s1_)
+      w = detail::seed_step(z);
+    block_.fill(0);
+    pos_ = N;
+  }
+
+  // One step of every lane. Words of the buffered block that operator() has
+  // not handed out yet are skipped.
+  [[nodiscard]] CROMULENT_CONSTEXPR20 block_type next_block() noexcept {
+    block_type out;
+    detail::fill_lanes<N>(s0_.data(), s1_.data(), out.data(), 1);
+    pos_ = N;
+    return out;
+  }
+
+  CROMULENT_CONSTEXPR20 result_type operator()() noexcept {
+    if (pos_ == N) {
+      detail::fill_lanes<N>(s0_.data(), s1_.data(), block_.data(), 1);
+      pos_ = 0;
+    }
+    return block_[pos_++];
+  }
+
+  // The next n words of the stream, as n calls to operator() would give them.
+  CROMULENT_CONSTEXPR20 void fill(std::uint64_t *dst, std::size_t n) noexcept {
+    for (; n > 0 && pos_ < N; --n)
+      *dst++ = block_[pos_++];
+
+    const std::size_t full = n / N;
+    if (full > 0) {
+      detail::fill_lanes<N>(s0_.data(), s1_.data(), dst, full);
+      dst += full * N;
+      n -= full * N;
+    }
+    for (; n > 0; --n)
+      *dst++ = (*this)();
+  }
+
+  // n calls to next_double() / next_float(), one word each.
+  CROMULENT_CONSTEXPR20 void fill_double(double *dst, std::size_t n) noexcept {
+    convert(dst, n, [](std::uint64_t w) { return detail::to_double(w); });
+  }
+
+  CROMULENT_CONSTEXPR20 void fill_float(float *dst, std::size_t n) noexcept {
+    convert(dst, n, [](std::uint64_t w) {
+      return detail::to_float(static_cast<std::uint32_t>(w >> 32));
+    });
+  }
+
+  [[nodiscard]] CROMULENT_CONSTEXPR20 double next_double() noexcept {
+    return detail::to_double((*this)());
+  }
+
+  [[nodiscard]] CROMULENT_CONSTEXPR20 float next_float() noexcept {
+    return detail::to_float(static_cast<std::uint32_t>((*this)() >> 32));
+  }
+
+  CROMULENT_CONSTEXPR20 void discard(unsigned long long z) noexcept {
+    while (z-- != 0)
+      (void)(*this)();
+  }
+
+  [[nodiscard]] friend CROMULENT_CONSTEXPR20 bool
+  operator==(const simd_engine &x, const simd_engine &y) noexcept {
+    return x.s0_ == y.s0_ && x.s1_ == y.s1_ && x.pos_ == y.pos_ &&
+           std::equal(x.block_.begin() + x.pos_, x.block_.end(),
+                      y.block_.begin() + y.pos_);
+  }
+  [[nodiscard]] friend CROMULENT_CONSTEXPR20 bool
+  operator!=(const simd_engine &x, const simd_engine &y) noexcept {
+    return !(x == y);
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_ostream<CharT, Traits> &
+  operator<<(std::basic_ostream<CharT, Traits> &os, const simd_engine &e) {
+    for (std::uint64_t w : e.s0_)
+      os << w << ' ';
+    for (std::uint64_t w : e.s1_)
+      os << w << ' ';
+    for (std::uint64_t w : e.block_)
+      os << w << ' ';
+    return os << e.pos_;
+  }
+
+  template <class CharT, class Traits>
+  friend std::basic_istream<CharT, Traits> &
+  operator>>(std::basic_istream<CharT, Traits> &is, simd_engine &e) {
+    simd_engine t;
+    for (auto *words : {&t.s0_, &t.s1_, &t.block_})
+      for (std::uint64_t &w : *words)
+        is >> w;
+    if (is >> t.pos_ && t.pos_ <= N)
+      e = t;
+    else
+      is.setstate(std::ios_base::failbit);
+    return is;
+  }
+
+private:
+  // Words per conversion round, staged on the stack.
+  static constexpr std::size_t chunk_words = 1024;
+
+  template <class T, class F>
+  CROMULENT_CONSTEXPR20 void convert(T *dst, std::size_t n, F to) {
+    std::uint64_t chunk[chunk_words];
+    while (n > 0) {
+      const std::size_t m = std::min(n, chunk_words);
+      fill(chunk, m);
+      for (std::size_t i = 0; i < m; ++i)
+        dst[i] = to(chunk[i]);
+      dst += m;
+      n -= m;
+    }
+  }
+
+  block_type s0_{};
+  block_type s1_{};
+  block_type block_{};
+  std::size_t pos_ = N; // words of block_ already handed out
+};
+
+// The first N outputs of an Engine seeded with `seed`, in a std::array that
+// can be built at compile time, e.g. for Zobrist keys or hash salts:
+//
+//   constexpr auto zobrist = cromulent::make_table<12 * 64>(0x5EED);
+//
+// engine and strong_engine work from C++17, bulk_engine and simd_engine from
+// C++20. Large tables can hit the compiler's constant-evaluation step limit
+// (-fconstexpr-ops-limit, -fconstexpr-steps).
+template <std::size_t N, class Engine = engine>
+[[nodiscard]] constexpr std::array<typename Engine::result_type, N>
+make_table(typename Engine::result_type seed) noexcept {
+  std::array<typename Engine::result_type, N> table{};
+  Engine e(seed);
+  for (auto &w : table)
+    w = e();
+  return table;
+}
+
+// Walker / Vose alias-table sampler over a fixed set of weights, a drop-in
+// for std::discrete_distribution with O(1) draws. Mirrors
+// cromulent_alias_init / cromulent_alias_sample: the table is built the same
+// way, and each draw takes exactly one 64-bit output of the generator, whose
+// product with size() gives the slot and the coin. Driven by
+// cromulent::engine it returns the same values as the C sampler driven by
+// cromulent_next. The generator must produce full 64-bit words.
+template <class IntType = int> class alias_distribution {
+public:
+  using result_type = IntType;
+
+  // A single category of weight 1, like std::discrete_distribution.
+  alias_distribution() : alias_distribution({1.0}) {}
+
+  template <class InputIt>
+  alias_distribution(InputIt first, InputIt last)
+      : weights_(first, last) {
+    build();
+  }
+
+  alias_distribution(std::initializer_list<double> weights)
+      : weights_(weights) {
+    build();
+  }
+
+  template <class URBG> result_type operator()(URBG &g) {
+    static_assert(URBG::min() == 0 &&
+                      URBG::max() == std::numeric_limits<std::uint64_t>::max(),
+                  "alias_distribution needs a full 64-bit generator");
+    __extension__ using u128 = unsigned __int128;
+    const u128 m = static_cast<u128>(static_cast<std::uint64_t>(g())) *
+                   entries_.size();
+    const std::size_t slot = static_cast<std::size_t>(m >> 64);
+    const entry &e = entries_[slot];
+    // The coin is a fair guess for the branch predictor, so select with a mask.
+    const std::uint64_t keep =
+        0 - static_cast<std::uint64_t>(static_cast<std::uint64_t>(m) <
+                                       e.threshold);
+    return static_cast<result_type>((slot & keep) | (e.alias & ~keep));
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+  [[nodiscard]] result_type min() const noexcept { return 0; }
+  [[nodiscard]] result_type max() const noexcept {
+    return static_cast<result_type>(entries_.size() - 1);
+  }
+
+  // Normalized weights, as std::discrete_distribution::probabilities().
+  [[nodiscard]] std::vector<double> probabilities() const {
+    std::vector<double> p(weights_);
+    for (double &x : p)
+      x /= sum_;
+    return p;
+  }
+
+  void reset() noexcept {}
+
+  [[nodiscard]] friend bool operator==(const alias_distribution &a,
+                                       const alias_distribution &b) {
+    return a.weights_ == b.weights_;
+  }
+  [[nodiscard]] friend bool operator!=(const alias_distribution &a,
+                                       const alias_distribution &b) {
+    return !(a == b);
+  }
+
+private:
+  struct entry {
+    std::uint64_t threshold;
+    std::uint64_t alias;
+  };
+
+  // Vose's method with LIFO worklists, in the order cromulent_alias_init
+  // uses, so both produce the identical table.
+  void build() {
+    const std::size_t n = weights_.size();
+    if (n == 0 || n > std::numeric_limits<std::uint32_t>::max())
+      throw std::invalid_argument("alias_distribution: bad number of weights");
+
+    sum_ = 0;
+    for (double w : weights_) {
+      if (!(w >= 0) || !std::isfinite(w))
+        throw std::invalid_argument("alias_distribution: bad weight");
+      sum_ += w;
+    }
+    if (!(sum_ > 0) || !std::isfinite(sum_))
+      throw std::invalid_argument("alias_distribution: bad total weight");
+
+    const double scale = static_cast<double>(n) / sum_;
+    std::vector<double> p(n);
+    std::vector<std::size_t> small, large;
+    for (std::size_t i = 0; i < n; ++i) {
+      p[i] = weights_[i] * scale;
+      (p[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    entries_.assign(n, entry{0, 0});
+    while (!small.empty() && !large.empty()) {
+      const std::size_t s = small.back();
+      small.pop_back();
+      const std::size_t l = large.back();
+      large.pop_back();
+      p[l] = (p[l] + p[s]) - 1.0;
+      entries_[s].alias = l;
+      (p[l] < 1.0 ? small : large).push_back(l);
+    }
+    for (const auto *rest : {&large, &small})
+      for (std::size_t i : *rest) {
+        p[i] = 1.0;
+        entries_[i].alias = i;
+      }
+
+    for (std::size_t i = 0; i < n; ++i)
+      entries_[i].threshold =
+          p[i] < 1.0 ? static_cast<std::uint64_t>(p[i] * 0x1.0p64)
+                     : std::numeric_limits<std::uint64_t>::max();
+  }
+
+  std::vector<double> weights_;
+  std::vector<entry> entries_;
+  double sum_ = 0;
+};
+
 } // namespace cromulent
 
 #endif // CROMULENT_HPP
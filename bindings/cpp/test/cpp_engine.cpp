@@ -10,11 +10,14 @@ extern "C" {
 }
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstdio>
+#include <list>
 #include <numeric>
 #include <random>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
 #define CHECK(cond, msg)                                                        \
@@ -160,6 +163,410 @@ static int test_discard_equivalence() {
   return 0;
 }
 
+static int test_split_matches_c_reference() {
+  std::printf("Testing split matches cromulent_split... ");
+
+  cromulent::engine parent(0x5151515151515151ULL);
+  parent.discard(3);
+  const cromulent::engine before = parent;
+
+  cromulent_state c_parent;
+  cromulent_init(&c_parent, 0x5151515151515151ULL);
+  for (int i = 0; i < 3; ++i)
+    (void)cromulent_next(&c_parent);
+
+  for (std::uint64_t stream = 0; stream < 64; ++stream) {
+    cromulent::engine child = parent.split(stream);
+    cromulent_state c_child;
+    cromulent_split(&c_parent, stream, &c_child);
+    for (int i = 0; i < 16; ++i)
+      CHECK(child() == cromulent_next(&c_child),
+            "split stream must match cromulent_split");
+  }
+  CHECK(parent == before, "split must not advance the parent");
+
+  std::printf("OK\n");
+  return 0;
+}
+
+static int test_alias_matches_c_reference() {
+  std::printf("Testing alias_distribution matches cromulent_alias... ");
+
+  std::vector<double> weights(300);
+  for (std::size_t i = 0; i < weights.size(); ++i)
+    weights[i] = (i % 5 == 2) ? 0.0 : 0.5 + static_cast<double>(i * 13 % 29);
+  weights[42] = 1000.0;
+
+  std::vector<cromulent_alias_entry> entries(weights.size());
+  cromulent_alias table;
+  CHECK(cromulent_alias_init(&table, entries.data(), weights.data(),
+                             weights.size()) == 0,
+        "C table must build");
+
+  cromulent::alias_distribution<int> dist(weights.begin(), weights.end());
+  CHECK(dist.size() == weights.size(), "size must match the weights");
+  cromulent::engine e(0x0DDBA11ULL);
+  cromulent_state c_state;
+  cromulent_init(&c_state, 0x0DDBA11ULL);
+  for (int i = 0; i < 10000; ++i) {
+    const int v = dist(e);
+    CHECK(v == static_cast<int>(cromulent_alias_sample(&table, &c_state)),
+          "alias draws must match the C sampler");
+    CHECK(weights[static_cast<std::size_t>(v)] > 0,
+          "zero weights must never be drawn");
+  }
+
+  const std::vector<double> p = dist.probabilities();
+  CHECK(p[42] > 0.1 && p[2] == 0, "probabilities must be normalized weights");
+
+  bool threw = false;
+  try {
+    cromulent::alias_distribution<int> bad({1.0, -1.0});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  CHECK(threw, "negative weights must be rejected");
+
+  std::printf("OK\n");
+  return 0;
+}
+
+static int test_engine_fills() {
+  std::printf("Testing engine fill/generate match operator()... ");
+
+  cromulent::engine e(0xF111ULL), ref(0xF111ULL);
+  std::vector<std::uint64_t> words(1001);
+  e.fill(words);
+  for (std::uint64_t w : words)
+    CHECK(w == ref(), "fill must equal successive operator() calls");
+
+  std::vector<double> d(77);
+  std::array<float, 33> f{};
+  e.fill_double(d);
+  e.fill_float(f);
+  for (double x : d)
+    CHECK(x == ref.next_double(), "fill_double must equal next_double");
+  for (float x : f)
+    CHECK(x == ref.next_float(), "fill_float must equal next_float");
+
+  e.generate(words.begin(), words.end());
+  for (std::uint64_t w : words)
+    CHECK(w == ref(), "generate must equal successive operator() calls");
+  std::list<unsigned> small(20);
+  e.generate(small.begin(), small.end());
+  for (unsigned v : small)
+    CHECK(v == static_cast<unsigned>(ref()),
+          "generate must convert like std::generate");
+  CHECK(e == ref, "fills must leave the engine where the calls would");
+
+  std::printf("OK\n");
+  return 0;
+}
+
+static int test_bulk_engine_matches_c_reference() {
+  std::printf("Testing bulk_engine matches the C bulk API... ");
+
+  const std::uint64_t seed = 0xB01CB01CULL;
+  cromulent_bulk_state c;
+  cromulent_bulk_init(&c, seed);
+  cromulent::bulk_engine e(seed);
+
+  // Lengths that start and end mid-step, mixing every kind of fill.
+  const std::size_t sizes[] = {1, 15, 16, 17, 3, 100, 1024, 5, 33, 2};
+  std::vector<std::uint64_t> want, got;
+  std::vector<double> dwant, dgot;
+  std::vector<float> fwant, fgot;
+  for (int round = 0; round < 3; ++round)
+    for (std::size_t n : sizes) {
+      want.resize(n);
+      got.resize(n);
+      cromulent_fill_u64(&c, want.data(), n);
+      e.fill(got);
+      CHECK(want == got, "fill must match cromulent_fill_u64");
+
+      fwant.resize(n + 1);
+      fgot.resize(n + 1);
+      cromulent_fill_float(&c, fwant.data(), n + 1);
+      e.fill_float(fgot);
+      CHECK(fwant == fgot, "fill_float must match cromulent_fill_float");
+
+      dwant.resize(2 * n);
+      dgot.resize(2 * n);
+      cromulent_fill_double(&c, dwant.data(), 2 * n);
+      e.fill_double(dgot);
+      CHECK(dwant == dgot, "fill_double must match cromulent_fill_double");
+
+      std::uint64_t one;
+      cromulent_fill_u64(&c, &one, 1);
+      CHECK(one == e(), "operator() must match a one-word fill");
+    }
+
+  // Copies and round trips resume the same stream.
+  cromulent::bulk_engine copy = e;
+  std::stringstream ss;
+  ss << e;
+  cromulent::bulk_engine restored;
+  ss >> restored;
+  CHECK(copy == e && restored == e, "copies must compare equal");
+  e.discard(21);
+  for (int i = 0; i < 21; ++i)
+    (void)restored();
+  CHECK(restored == e, "discard(n) must equal n calls");
+  for (int i = 0; i < 100; ++i)
+    CHECK(e() == restored(), "restored stream must match original");
+
+  std::uniform_int_distribution<int> die(1, 6);
+  for (int i = 0; i < 1000; ++i) {
+    const int roll = die(copy);
+    CHECK(roll >= 1 && roll <= 6, "bulk_engine must work with <random>");
+  }
+
+  std::printf("OK\n");
+  return 0;
+}
+
+// Checks simd_engine<N> block by block against a C generator's next().
+template <std::size_t N, class State, class Next>
+static int check_blocks(const char *what, std::uint64_t seed, State *c,
+                        Next next_c) {
+  cromulent::simd_engine<N> e(seed);
+  std::uint64_t want[N];
+  for (int i = 0; i < 500; ++i) {
+    next_c(c, want);
+    const auto got = e.next_block();
+    for (std::size_t l = 0; l < N; ++l)
+      CHECK(got[l] == want[l], what);
+  }
+  // operator() and fill continue the same stream, word by word.
+  std::vector<std::uint64_t> words(3 * N + 1);
+  e.fill(words);
+  for (std::size_t i = 0; i < 4 * N; ++i) {
+    if (i % N == 0)
+      next_c(c, want);
+    const std::uint64_t w = i < words.size() ? words[i] : e();
+    CHECK(w == want[i % N], what);
+  }
+  return 0;
+}
+
+static int test_simd_engine_matches_c_reference() {
+  std::printf("Testing simd_engine matches the C multi-lane generators... ");
+
+  const std::uint64_t seed = 0x51D51D51DULL;
+  cromulent_state s1;
+  cromulent_x2_state s2;
+  cromulent_x4_state s4;
+  cromulent_x8_state s8;
+  cromulent_bulk_state s16;
+  cromulent_init(&s1, seed);
+  cromulent_x2_init(&s2, seed);
+  cromulent_x4_init(&s4, seed);
+  cromulent_x8_init(&s8, seed);
+  cromulent_bulk_init(&s16, seed);
+
+  int result = 0;
+  result |= check_blocks<1>(
+      "simd_engine<1> must match cromulent_next", seed, &s1,
+      [](cromulent_state *c, std::uint64_t *out) { *out = cromulent_next(c); });
+  result |= check_blocks<2>("simd_engine<2> must match cromulent_x2",
+                            seed, &s2, cromulent_x2_next);
+  result |= check_blocks<4>("simd_engine<4> must match cromulent_x4",
+                            seed, &s4, cromulent_x4_next);
+  result |= check_blocks<8>("simd_engine<8> must match cromulent_x8",
+                            seed, &s8, cromulent_x8_next);
+  result |= check_blocks<16>(
+      "simd_engine<16> must match cromulent_fill_u64", seed, &s16,
+      [](cromulent_bulk_state *c, std::uint64_t *out) {
+        cromulent_fill_u64(c, out, 16);
+      });
+  if (result)
+    return result;
+
+  // simd_engine<1> is the scalar engine.
+  cromulent::simd_engine<1> one(77);
+  cromulent::engine ref(77);
+  for (int i = 0; i < 100; ++i)
+    CHECK(one() == ref(), "simd_engine<1> must match engine");
+
+  std::printf("OK\n");
+  return 0;
+}
+
+static int test_simd_engine_matches_avx2() {
+#if defined(CROMULENT_TEST_AVX2)
+  std::printf("Testing simd_engine<4> matches cromulent_avx2_next... ");
+  if (!__builtin_cpu_supports("avx2")) {
+    std::printf("skipped (no AVX2)\n");
+    return 0;
+  }
+
+  cromulent_avx2_state c;
+  cromulent_avx2_init(&c, 0xA5A5A5A5ULL);
+  int result = check_blocks<4>(
+      "simd_engine<4> must match cromulent_avx2_next", 0xA5A5A5A5ULL, &c,
+      [](cromulent_avx2_state *st, std::uint64_t *out) {
+#if defined(__AVX2__)
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            cromulent_avx2_next(st));
+#else
+        cromulent_avx2_next_u64(st, out);
+#endif
+      });
+  if (result)
+    return result;
+  std::printf("OK\n");
+#endif
+  return 0;
+}
+
+static int test_simd_engine_matches_avx512() {
+#if defined(CROMULENT_TEST_AVX512)
+  std::printf("Testing simd_engine<8> matches cromulent_avx512_next... ");
+  if (!__builtin_cpu_supports("avx512f") ||
+      !__builtin_cpu_supports("avx512dq") ||
+      !__builtin_cpu_supports("avx512vl")) {
+    std::printf("skipped (no AVX-512)\n");
+    return 0;
+  }
+
+  cromulent_avx512_state c;
+  cromulent_avx512_init(&c, 0xA5A5A5A5ULL);
+  int result = check_blocks<8>(
+      "simd_engine<8> must match cromulent_avx512_next", 0xA5A5A5A5ULL, &c,
+      cromulent_avx512_next_u64);
+  if (result)
+    return result;
+  std::printf("OK\n");
+#endif
+  return 0;
+}
+
+static int test_simd_engine_urbg() {
+  std::printf("Testing simd_engine as a UniformRandomBitGenerator... ");
+
+  static_assert(cromulent::simd_engine<8>::lanes == 8, "lanes must be N");
+  cromulent::simd_engine<4> e(0x5EED);
+  (void)e();
+  std::vector<int> v(100);
+  std::iota(v.begin(), v.end(), 0);
+  std::shuffle(v.begin(), v.end(), e);
+  std::vector<int> sorted = v;
+  std::sort(sorted.begin(), sorted.end());
+  for (int i = 0; i < 100; ++i)
+    CHECK(sorted[i] == i, "shuffle must be a permutation");
+
+  std::stringstream ss;
+  ss << e;
+  cromulent::simd_engine<4> restored;
+  ss >> restored;
+  CHECK(restored == e, "restored engine must equal original");
+  cromulent::simd_engine<4> skipped = e;
+  skipped.discard(10);
+  for (int i = 0; i < 10; ++i)
+    (void)e();
+  CHECK(skipped == e, "discard(n) must equal n calls");
+
+  std::vector<double> d(37);
+  restored.discard(10);
+  e.fill_double(d);
+  for (double x : d)
+    CHECK(x == restored.next_double(), "fill_double must equal next_double");
+
+  std::printf("OK\n");
+  return 0;
+}
+
+// Compile-time evaluation. The known answers are the first outputs of
+// cromulent_next, cromulent_strong_next and cromulent_x4_next for seed 0, so a
+// constexpr stream that drifts from the runtime one fails the build.
+namespace compile_time {
+
+constexpr auto kFast = cromulent::make_table<3>(0);
+static_assert(kFast[0] == 0xf06aeeb1488a2ce1ULL &&
+                  kFast[1] == 0x52d525db14508774ULL &&
+                  kFast[2] == 0xfb297d7b9e7649beULL,
+              "constexpr engine must match cromulent_next");
+
+constexpr auto kStrong = cromulent::make_table<3, cromulent::strong_engine>(0);
+static_assert(kStrong[0] == 0xe2b4bd01c17ebb98ULL &&
+                  kStrong[1] == 0x7ece5a913410ccf7ULL &&
+                  kStrong[2] == 0x52a54daca29ac56bULL,
+              "constexpr strong_engine must match cromulent_strong_next");
+
+static_assert(
+    [] {
+      cromulent::engine e(0);
+      e.discard(2);
+      return e();
+    }() == kFast[2],
+    "constexpr discard must skip outputs");
+
+static_assert(
+    [] {
+      cromulent::engine e(0);
+      std::array<std::uint64_t, 3> words{};
+      e.fill(words);
+      return words[0] == kFast[0] && words[1] == kFast[1] &&
+             words[2] == kFast[2];
+    }(),
+    "constexpr fill must match operator()");
+
+static_assert(
+    [] {
+      cromulent::engine e(7);
+      for (int i = 0; i < 100; ++i)
+        if (e.bounded(10) >= 10)
+          return false;
+      return e.next_double() < 1.0 && e.split(3) != e;
+    }(),
+    "bounded, next_double and split must be constexpr");
+
+#if defined(__cpp_lib_is_constant_evaluated)
+constexpr auto kLanes = cromulent::make_table<8, cromulent::simd_engine<4>>(0);
+static_assert(kLanes[4] == 0xb1ecc7820f62fb46ULL &&
+                  kLanes[5] == 0x53a7792ac53e6625ULL &&
+                  kLanes[6] == 0x4c5cb165326f1c48ULL &&
+                  kLanes[7] == 0x31ea6a6f49d6b185ULL,
+              "constexpr simd_engine<4> must match cromulent_x4_next");
+static_assert(cromulent::make_table<40, cromulent::bulk_engine>(9) ==
+                  cromulent::make_table<40, cromulent::simd_engine<16>>(9),
+              "constexpr bulk_engine must match simd_engine<16>");
+#endif
+
+} // namespace compile_time
+
+static int test_constexpr_tables() {
+  std::printf("Testing make_table matches the runtime stream... ");
+
+  static constexpr auto table = cromulent::make_table<1000>(0xC0FFEEULL);
+  cromulent_state c;
+  cromulent_init(&c, 0xC0FFEEULL);
+  for (std::uint64_t w : table)
+    CHECK(w == cromulent_next(&c), "constexpr table must match cromulent_next");
+
+  static constexpr auto strong =
+      cromulent::make_table<1000, cromulent::strong_engine>(0xC0FFEEULL);
+  cromulent_strong_state cs;
+  cromulent_strong_init(&cs, 0xC0FFEEULL);
+  for (std::uint64_t w : strong)
+    CHECK(w == cromulent_strong_next(&cs),
+          "constexpr table must match cromulent_strong_next");
+
+#if defined(__cpp_lib_is_constant_evaluated)
+  static constexpr auto lanes =
+      cromulent::make_table<1000, cromulent::bulk_engine>(0xC0FFEEULL);
+  cromulent_bulk_state cb;
+  cromulent_bulk_init(&cb, 0xC0FFEEULL);
+  std::uint64_t want[1000];
+  cromulent_fill_u64(&cb, want, 1000);
+  for (std::size_t i = 0; i < 1000; ++i)
+    CHECK(lanes[i] == want[i], "constexpr table must match cromulent_fill_u64");
+#endif
+
+  std::printf("OK\n");
+  return 0;
+}
+
 int main() {
   std::printf("Running Cromulent C++ engine tests\n");
 
@@ -171,6 +578,15 @@ int main() {
   result |= test_seed_seq();
   result |= test_bounded();
   result |= test_discard_equivalence();
+  result |= test_split_matches_c_reference();
+  result |= test_alias_matches_c_reference();
+  result |= test_engine_fills();
+  result |= test_bulk_engine_matches_c_reference();
+  result |= test_simd_engine_matches_c_reference();
+  result |= test_simd_engine_matches_avx2();
+  result |= test_simd_engine_matches_avx512();
+  result |= test_simd_engine_urbg();
+  result |= test_constexpr_tables();
 
   if (result == 0) {
     std::printf("All C++ engine tests passed successfully!\n");
@@ -12,6 +12,12 @@
 extern "C" {
 #endif
 
+// The declarations below are the library's exported API. The shared library
+// is built with hidden visibility, so everything else stays internal to it.
+#if defined(__GNUC__)
+#pragma GCC visibility push(default)
+#endif
+
 typedef struct cromulent_state {
   uint64_t s0;
   uint64_t s1;
@@ -21,28 +27,199 @@ typedef struct cromulent_strong_state {
   uint64_t a, b;
 } cromulent_strong_state;
 
+// Portable N-lane generators in plain C. Lane i starts from words i and N + i
+// of the seed expansion, exactly like cromulent_avx2_init (N = 4) and
+// cromulent_avx512_init (N = 8), and next() stores the lanes in order, so
+// cromulent_x4 reproduces the AVX2 stream and cromulent_x8 the AVX-512 one on
+// any target. fill() writes `steps` consecutive next() results.
+typedef struct {
+  uint64_t s0[2], s1[2];
+} cromulent_x2_state;
+
+typedef struct {
+  uint64_t s0[4], s1[4];
+} cromulent_x4_state;
+
+typedef struct {
+  uint64_t s0[8], s1[8];
+} cromulent_x8_state;
+
+#define CROMULENT_BULK_LANES 16
+
+// State behind the bulk fill API. Lane i runs the cromulent128 transition on
+// (s0[i], s1[i]); the lanes are seeded like cromulent_avx2_init, extended to
+// CROMULENT_BULK_LANES lanes. The output stream is step-major: one word from
+// every lane in lane order, then the next step. block[] buffers the last step
+// so that fills of arbitrary length split the stream without losing words.
+typedef struct cromulent_bulk_state {
+  uint64_t s0[CROMULENT_BULK_LANES];
+  uint64_t s1[CROMULENT_BULK_LANES];
+  uint64_t block[CROMULENT_BULK_LANES];
+  uint32_t pos; // bytes of block[] already handed out
+} cromulent_bulk_state;
+
+// Multi-lane cromulent_strong behind cromulent_strong_fill_u64. Lane i runs
+// cromulent_strong_next on (a[i], b[i]) and is seeded like the bulk lanes: from
+// words i and CROMULENT_BULK_LANES + i of the cromulent_strong_init seed
+// expansion. The stream is step-major and buffered like cromulent_bulk_state.
+typedef struct cromulent_strong_bulk_state {
+  uint64_t a[CROMULENT_BULK_LANES];
+  uint64_t b[CROMULENT_BULK_LANES];
+  uint64_t block[CROMULENT_BULK_LANES];
+  uint32_t pos; // bytes of block[] already handed out
+} cromulent_strong_bulk_state;
+
+// Cursor over a counter-based stream (see cromulent_at): the next word is
+// word `counter` of the stream, and assigning counter seeks. k0 and k1 hold
+// the expanded key, so stepping costs no more than cromulent_at_range.
+typedef struct cromulent_at_state {
+  uint64_t k0, k1;
+  uint64_t counter;
+} cromulent_at_state;
+
+// Walker / Vose alias table for sampling from a fixed discrete distribution.
+// The caller owns the n entries; the table only points at them.
+typedef struct cromulent_alias {
+  const cromulent_alias_entry *entries;
+  uint32_t n;
+} cromulent_alias;
+
 typedef struct {
   const char *name;
   void (*init)(uint64_t);
   uint64_t (*next)(void);
 } CromulentPRNG;
 
-#if defined(__AVX2__)
+// Re-entrant registry entry. The caller owns the state: allocate state_size
+// bytes (suitably aligned for uint64_t) per instance, so any number of
+// instances can run side by side or on different threads. fill() writes n
+// consecutive next() results. save() writes state_size bytes, the state words
+// in little-endian order, and load() reads them back.
+typedef struct {
+  const char *name;
+  size_t state_size;
+  void (*init)(void *state, uint64_t seed);
+  uint64_t (*next)(void *state);
+  void (*fill)(void *state, uint64_t *dst, size_t n);
+  void (*save)(const void *state, uint8_t *buffer);
+  void (*load)(void *state, const uint8_t *buffer);
+} CromulentPRNG2;
+
+// An open pool file (see cromulent_pool_open). data points at the payload in
+// the file mapping; the checkpoints are the saved generator state at the start
+// of each chunk, state_size bytes each, in the generator's save() format.
+typedef struct cromulent_pool {
+  const uint8_t *data;
+  uint64_t size;        // payload bytes
+  uint64_t seed;
+  uint64_t chunk_bytes; // payload bytes per checkpoint
+  uint64_t chunks;
+  uint32_t lanes;       // interleaved lanes in the word stream (1: serial)
+  uint32_t state_size;
+  char generator[32];   // NUL-terminated generator name
+  const uint8_t *checkpoints;
+  void *map;
+  size_t map_bytes;
+} cromulent_pool;
+
+// State of the reference generators
+typedef struct {
+  uint64_t x;
+} splitmix64_state;
+
+typedef struct {
+  uint64_t state, inc;
+} pcg64_state;
+
+typedef struct {
+  uint64_t s[4];
+} xoshiro256_state;
+
+// Instruction-set backends for the bulk API. The values are part of the ABI.
+typedef enum cromulent_backend {
+  CROMULENT_BACKEND_SCALAR = 0,
+  CROMULENT_BACKEND_AVX2 = 1,
+  CROMULENT_BACKEND_AVX512 = 2,
+  CROMULENT_BACKEND_NEON = 3,
+} cromulent_backend;
+
+#if defined(__x86_64__) || defined(_M_X64)
 typedef struct {
   __m256i s0, s1;
 } cromulent_avx2_state;
 
-// Callers must only dispatch to the AVX2 entry points when the CPU reports
-// support for the instruction set; the scalar implementations remain the
-// baseline fall-back.
+// Callers must only use the AVX2 entry points when
+// cromulent_backend_supported(CROMULENT_BACKEND_AVX2) is true; the scalar
+// implementations remain the baseline fall-back. cromulent_avx2_next_u64 needs
+// no AVX2 code generation in the caller and stores the four lanes in order.
 void cromulent_avx2_init(cromulent_avx2_state *state, uint64_t seed);
+void cromulent_avx2_next_u64(cromulent_avx2_state *state, uint64_t out[4]);
+#if defined(__AVX2__)
 __m256i cromulent_avx2_next(cromulent_avx2_state *state);
 #endif
 
+typedef struct {
+  __m512i s0, s1;
+} cromulent_avx512_state;
+
+// Eight-lane AVX-512 generator, seeded like cromulent_avx2_init extended to
+// eight lanes: lane i starts from words i and 8 + i of the seed expansion.
+// Requires cromulent_backend_supported(CROMULENT_BACKEND_AVX512).
+void cromulent_avx512_init(cromulent_avx512_state *state, uint64_t seed);
+void cromulent_avx512_next_u64(cromulent_avx512_state *state, uint64_t out[8]);
+#if defined(__AVX512F__)
+__m512i cromulent_avx512_next(cromulent_avx512_state *state);
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(CROMULENT_NEON_EMULATION)
+// Four-lane NEON generator producing exactly the cromulent_avx2_init /
+// cromulent_avx2_next stream. The state is kept in memory so the header does
+// not depend on <arm_neon.h>; lanes are stored in order by next_u64.
+typedef struct {
+  uint64_t s0[4], s1[4];
+} cromulent_neon_state;
+
+void cromulent_neon_init(cromulent_neon_state *state, uint64_t seed);
+void cromulent_neon_next_u64(cromulent_neon_state *state, uint64_t out[4]);
+#endif
+
 void cromulent_init(cromulent_state *state, uint64_t seed);
 void cromulent_strong_init(cromulent_strong_state *st, uint64_t seed);
 uint64_t cromulent_strong_next(cromulent_strong_state *state);
+// Write n consecutive cromulent_strong_next results to dst
+void cromulent_strong_fill(cromulent_strong_state *state, uint64_t *dst,
+                           size_t n);
+// Bulk cromulent_strong: n words of the multi-lane stream, from the SIMD
+// kernels where the CPU has them. Identical on every backend and for any way
+// of splitting it across calls; it is not the cromulent_strong_next stream.
+void cromulent_strong_bulk_init(cromulent_strong_bulk_state *state,
+                                uint64_t seed);
+void cromulent_strong_fill_u64(cromulent_strong_bulk_state *state,
+                               uint64_t *dst, size_t n);
+// Counter-based generation: cromulent_at(key, i) is word i of key's stream,
+// computed directly from the two, with no state to carry. For a fixed key the
+// words of a stream are a permutation of the 64-bit values, so no two
+// counters give the same word. cromulent_at_range writes words start,
+// start + 1, ... (mod 2^64) using the SIMD kernels, so threads can fill
+// disjoint slices of one array without coordinating. cromulent_at_init
+// starts a cursor at counter 0; next and fill then walk the same stream.
+uint64_t cromulent_at(uint64_t key, uint64_t counter);
+void cromulent_at_range(uint64_t key, uint64_t start, uint64_t *dst, size_t n);
+void cromulent_at_init(cromulent_at_state *state, uint64_t key);
+uint64_t cromulent_at_next(cromulent_at_state *state);
+void cromulent_at_fill(cromulent_at_state *state, uint64_t *dst, size_t n);
 uint64_t cromulent_next(cromulent_state *state);
+// Derive the generator for substream `stream` of `parent` without advancing
+// the parent. Distinct ids always yield distinct states; child may alias
+// parent. See README.md for the overlap bound.
+void cromulent_split(const cromulent_state *parent, uint64_t stream,
+                     cromulent_state *child);
+// Seed for substream `stream` of `seed`: seed itself for stream 0, otherwise
+// the first cromulent_next output of cromulent_split(init(seed), stream).
+// Pool files and the command-line tools seed their chunks and workers this
+// way.
+uint64_t cromulent_split_seed(uint64_t seed, uint64_t stream);
 double cromulent_double(cromulent_state *state);
 float cromulent_float(cromulent_state *state);
 uint64_t cromulent_range(cromulent_state *state, uint64_t n);
@@ -50,10 +227,160 @@ uint64_t cromulent_range(cromulent_state *state, uint64_t n);
 void cromulent_save(const cromulent_state *state, uint8_t *buffer);
 // Load the state from a 16-byte buffer written by cromulent_save
 void cromulent_load(cromulent_state *state, const uint8_t *buffer);
+
+// Thread-local default generator, safe to call from any thread without locks.
+// On first use a thread takes the next free stream id (0, 1, 2, ...) and runs
+// cromulent_split(init(master seed), id). cromulent_tls_seed sets the master
+// seed, restarts id assignment at 0 and reseeds the calling thread on its next
+// call; threads that already drew keep their streams, so seed before spawning
+// workers. cromulent_tls_bind pins the calling thread to a fixed stream id for
+// results that do not depend on thread start order.
+void cromulent_tls_seed(uint64_t seed);
+void cromulent_tls_bind(uint64_t stream);
+uint64_t cromulent_tls_next(void);
+double cromulent_tls_double(void);
+float cromulent_tls_float(void);
+uint64_t cromulent_tls_range(uint64_t n);
+
+void cromulent_x2_init(cromulent_x2_state *state, uint64_t seed);
+void cromulent_x2_next(cromulent_x2_state *state, uint64_t out[2]);
+void cromulent_x2_fill(cromulent_x2_state *state, uint64_t *dst, size_t steps);
+void cromulent_x4_init(cromulent_x4_state *state, uint64_t seed);
+void cromulent_x4_next(cromulent_x4_state *state, uint64_t out[4]);
+void cromulent_x4_fill(cromulent_x4_state *state, uint64_t *dst, size_t steps);
+void cromulent_x8_init(cromulent_x8_state *state, uint64_t seed);
+void cromulent_x8_next(cromulent_x8_state *state, uint64_t out[8]);
+void cromulent_x8_fill(cromulent_x8_state *state, uint64_t *dst, size_t steps);
+
+// Bulk generation. The stream depends only on the seed: it is identical for
+// every backend and for any way of splitting it across calls. Bytes are the
+// little-endian encoding of the 64-bit words; cromulent_fill_u64 always starts
+// on a word boundary, skipping the rest of a word partly used by
+// cromulent_fill_bytes.
+void cromulent_bulk_init(cromulent_bulk_state *state, uint64_t seed);
+void cromulent_fill_u64(cromulent_bulk_state *state, uint64_t *dst, size_t n);
+void cromulent_fill_bytes(cromulent_bulk_state *state, void *dst, size_t n);
+// Uniform floating-point fills from the same stream, converted in the SIMD
+// kernels. A double uses the top 53 bits of a whole word (starting on a word
+// boundary, like fill_u64); a float uses the top 24 bits of a 32-bit half, so
+// every word yields two floats, low half first. The plain variants return
+// [0, 1) and the _oc variants (0, 1]. Results are bit-identical on every
+// backend and equal to cromulent_double's conversion of the same word.
+void cromulent_fill_double(cromulent_bulk_state *state, double *dst, size_t n);
+void cromulent_fill_double_oc(cromulent_bulk_state *state, double *dst,
+                              size_t n);
+void cromulent_fill_float(cromulent_bulk_state *state, float *dst, size_t n);
+void cromulent_fill_float_oc(cromulent_bulk_state *state, float *dst, size_t n);
+// Fill dst with count uniform integers in [0, n), unbiased, from the same
+// stream. Bounds below 2^32 use one 32-bit half per draw (like
+// cromulent_fill_float), larger bounds one whole word (like cromulent_fill_u64);
+// rejected draws are skipped. Results are identical on every backend. n == 0
+// fills zeros without advancing the stream, matching cromulent_range.
+void cromulent_fill_range(cromulent_bulk_state *state, uint64_t n,
+                          uint64_t *dst, size_t count);
+
+// Standard normal (mean 0, variance 1) and exponential (rate 1) variates by
+// the 256-layer ziggurat method. Most variates take one 64-bit draw; about
+// 1.5% (normal) or 2.2% (exponential) take more from the same stream, so
+// the draws consumed depend only on the stream. The bulk forms read whole
+// words of the cromulent_fill_u64 stream and give the same values on every
+// backend.
+double cromulent_normal(cromulent_state *state);
+double cromulent_exponential(cromulent_state *state);
+void cromulent_fill_normal(cromulent_bulk_state *state, double *dst, size_t n);
+void cromulent_fill_exponential(cromulent_bulk_state *state, double *dst,
+                                size_t n);
+
+// Build an alias table over weights[0..n) in entries[0..n). Category i is
+// drawn with probability weights[i] / sum(weights), quantized to 2^-64 per
+// slot. Returns 0 on success, or -1 if n is 0 or above UINT32_MAX, a weight
+// is negative or not finite, or the weights do not have a finite positive
+// sum. Each sample takes exactly one 64-bit draw: its product with n gives
+// the slot and the coin. The bulk form reads whole words of the
+// cromulent_fill_u64 stream and gives the same values on every backend.
+int cromulent_alias_init(cromulent_alias *table, cromulent_alias_entry *entries,
+                         const double *weights, size_t n);
+uint32_t cromulent_alias_sample(const cromulent_alias *table,
+                                cromulent_state *state);
+void cromulent_alias_fill(const cromulent_alias *table,
+                          cromulent_bulk_state *state, uint32_t *dst,
+                          size_t count);
+
+// Shuffle n elements of `size` bytes at base in place (Fisher-Yates). Swap
+// partners are drawn two per cromulent_next word while n <= 2^32 and
+// prefetched in batches, so the permutation depends only on the state and n.
+void cromulent_shuffle(cromulent_state *state, void *base, size_t n,
+                       size_t size);
+// Write k distinct uniform indices from [0, n) to dst, in no particular order
+// (shuffle dst for a random order). Reservoir sampling with geometric skips:
+// O(k (1 + log(n / k))) draws and no memory beyond dst. Returns 0, or -1 if
+// k > n.
+int cromulent_sample_k(cromulent_state *state, uint64_t n, uint64_t *dst,
+                       size_t k);
+// Shuffle for arrays larger than the last-level cache: elements are scattered
+// into cache-sized buckets, which are then shuffled independently, using up
+// to `threads` threads for both passes. The result is a uniform permutation
+// that depends only on the state, n and size, not on the thread count; it is
+// a different permutation from cromulent_shuffle's. The caller provides
+// cromulent_shuffle_large_workspace(n, size) bytes of workspace, aligned like
+// malloc's, about n * size plus a small table. The state advances by one draw.
+size_t cromulent_shuffle_large_workspace(size_t n, size_t size);
+void cromulent_shuffle_large(cromulent_state *state, void *base, size_t n,
+                             size_t size, void *workspace, unsigned threads);
+
+// Backend selection. The best backend the CPU and OS support is chosen when the
+// library loads, unless the CROMULENT_BACKEND environment variable names
+// another supported one ("scalar", "avx2", "avx512", "neon").
+// cromulent_backend_select returns 0 on success and -1 if the backend is not
+// available on this CPU or was not compiled in. It may be called while other
+// threads are filling: every call after it returns uses the new backend, and
+// a call already running finishes on the old one.
+cromulent_backend cromulent_backend_active(void);
+int cromulent_backend_supported(cromulent_backend backend);
+int cromulent_backend_select(cromulent_backend backend);
+const char *cromulent_backend_name(cromulent_backend backend);
+
+// The v1 and v2 tables hold "xoshiro256", "cromulent128", "splitmix64",
+// "pcg64", "cromulent_strong" and "cromulent_at" (the cromulent_at_init
+// cursor, keyed by the seed), followed by "cromulent128_avx2" when the CPU
+// supports AVX2. cromulent128_avx2 is the cromulent_avx2_init / cromulent_x4
+// stream, lanes in order. The v2 "cromulent128" is seeded by cromulent_init
+// and saves in the cromulent_save format; the v1 entry keeps its own seeding.
 const CromulentPRNG *cromulent_registry_find(const char *name);
 const CromulentPRNG *cromulent_registry_all(size_t *count_out);
+const CromulentPRNG2 *cromulent_registry_v2_find(const char *name);
+const CromulentPRNG2 *cromulent_registry_v2_all(size_t *count_out);
+
+// Pre-generated pool files (POSIX only). A pool holds `size` bytes of one
+// generator's output, the little-endian encoding of its 64-bit words, split
+// into chunks of chunk_bytes (a multiple of 8). Chunk 0 starts from the
+// generator seeded with cromulent_split_seed(seed, c), so a single-chunk
+// pool is the plain stream. `generator` is a v2 registry name or
+// "cromulent_bulk" (the cromulent_fill_u64 stream). The file does not depend
+// on `threads`. All functions return 0 on success and -1 with errno set on
+// failure.
+int cromulent_pool_write(const char *path, const char *generator,
+                         uint64_t seed, uint64_t size, uint64_t chunk_bytes,
+                         unsigned threads);
+// Map a pool file read-only; pool->data[offset] is payload byte `offset`, with
+// no copy. Rejects files that are truncated or were not completely written.
+int cromulent_pool_open(cromulent_pool *pool, const char *path);
+void cromulent_pool_close(cromulent_pool *pool);
+// Recompute payload bytes [offset, offset + n) from the checkpoints instead of
+// reading them. The cost grows with the distance from the chunk start. Fails
+// with ENOTSUP if the generator is not available on this host.
+int cromulent_pool_regenerate(const cromulent_pool *pool, uint64_t offset,
+                              void *dst, size_t n);
+
+// Reference implementations, state-passing form
+void splitmix64_init(splitmix64_state *state, uint64_t seed);
+uint64_t splitmix64_next(splitmix64_state *state);
+void pcg64_init(pcg64_state *state, uint64_t seed);
+uint64_t pcg64_next(pcg64_state *state);
+void xoshiro256_init(xoshiro256_state *state, uint64_t seed);
+uint64_t xoshiro256_next(xoshiro256_state *state);
 
-// Reference implementations
+// Reference implementations on one process-global instance (v1 registry)
 void init_splitmix64(uint64_t seed);
 uint64_t splitmix64pp(void);
 void init_pcg64(uint64_t seed);
@@ -62,6 +389,14 @@ void init_xoshiro(uint64_t seed);
 uint64_t xoshiro256pp(void);
 void init_cromulent(uint64_t seed);
 uint64_t cromulent128pp(void);
+void init_cromulent_strong(uint64_t seed);
+uint64_t cromulent_strongpp(void);
+void init_cromulent_at(uint64_t seed);
+uint64_t cromulent_atpp(void);
+
+#if defined(__GNUC__)
+#pragma GCC visibility pop
+#endif
 
 #ifdef __cplusplus
 } // extern "C"
@@ -0,0 +1,53 @@
+// include/cromulent_inline.h
+//
+// Opt-in inline forms of the scalar draws. The library's cromulent_next,
+// cromulent_double, cromulent_float, cromulent_range and cromulent_at are
+// defined as calls to these, so the two forms give the same values. Inlined,
+// the compiler can keep the state in registers for a whole loop and overlap the
+// generator's multiplies with the caller's work, instead of making a call per
+// draw.
+
+#ifndef CROMULENT_INLINE_H
+#define CROMULENT_INLINE_H
+
+#include "cromulent.h"
+
+static inline uint64_t cromulent_next_inline(cromulent_state *state) {
+  return cromulent_step(&state->s0, &state->s1);
+}
+
+// Uniform double in [0, 1)
+static inline double cromulent_double_inline(cromulent_state *state) {
+  return cromulent_to_double(cromulent_next_inline(state), 0);
+}
+
+// Uniform float in [0, 1), from the top 24 bits of a draw
+static inline float cromulent_float_inline(cromulent_state *state) {
+  return (cromulent_next_inline(state) >> 40) * 0x1.0p-24f;
+}
+
+// Uniform integer in [0, n) by Lemire's multiply-shift with rejection; 0 when
+// n is 0, without advancing the state.
+static inline uint64_t cromulent_range_inline(cromulent_state *state,
+                                              uint64_t n) {
+  if (n == 0)
+    return 0;
+  uint64_t hi, lo;
+  cromulent_mul_u64(cromulent_next_inline(state), n, &hi, &lo);
+  if (lo < n) {
+    const uint64_t t = (-n) % n;
+    while (lo < t)
+      cromulent_mul_u64(cromulent_next_inline(state), n, &hi, &lo);
+  }
+  return hi;
+}
+
+// Word `counter` of key's counter-based stream. With the key fixed in a loop
+// the compiler hoists the key expansion, leaving four multiplies per word.
+static inline uint64_t cromulent_at_inline(uint64_t key, uint64_t counter) {
+  uint64_t k0, k1;
+  cromulent_at_key(key, &k0, &k1);
+  return cromulent_at_word(k0, k1, counter);
+}
+
+#endif // CROMULENT_INLINE_H
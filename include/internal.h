@@ -3,7 +3,9 @@
 #ifndef CROMULENT_INTERNAL
 #define CROMULENT_INTERNAL
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #if defined(__x86_64__) || defined(_M_X64)
 #include <immintrin.h>
 #endif
@@ -40,6 +42,135 @@ static inline __m256i mix_fast_avx2(__m256i x) {
   x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
   return x;
 }
+
+// One cromulent128 step on four independent lanes; the vector form of
+// cromulent_step() below.
+static inline __m256i cromulent_step_avx2(__m256i *s0, __m256i *s1) {
+  const __m256i a = *s0;
+  const __m256i b = *s1;
+
+  *s0 = _mm256_add_epi64(mullo_epi64_avx2(a, _mm256_set1_epi64x(C6)), b);
+  *s1 = _mm256_add_epi64(rotl_avx2(b, 31), mix_fast_avx2(a));
+
+  __m256i result = _mm256_add_epi64(a, rotl_avx2(b, 11));
+  result = _mm256_xor_si256(result, _mm256_srli_epi64(result, 27));
+  result = mullo_epi64_avx2(result, _mm256_set1_epi64x(C3));
+  result = _mm256_xor_si256(result, _mm256_srli_epi64(result, 27));
+  return result;
+}
+
+// One cromulent_strong step on four independent lanes; the vector form of
+// cromulent_strong_step() below.
+static inline __m256i cromulent_strong_step_avx2(__m256i *sa, __m256i *sb) {
+  __m256i a = *sa;
+  __m256i b = *sb;
+
+  b = _mm256_add_epi64(b, rotl_avx2(a, 13));
+  a = _mm256_add_epi64(
+      mullo_epi64_avx2(rotl_avx2(a, 29), _mm256_set1_epi64x((long long)C1)), b);
+  b = _mm256_xor_si256(rotl_avx2(b, 17), a);
+  a = _mm256_add_epi64(
+      a, rotl_avx2(mullo_epi64_avx2(b, _mm256_set1_epi64x((long long)C2)), 31));
+  b = _mm256_add_epi64(b, rotl_avx2(a, 23));
+  a = rotl_avx2(_mm256_xor_si256(a, b), 52);
+
+  const __m256i output = _mm256_add_epi64(a, rotl_avx2(b, 41));
+  *sa = _mm256_add_epi64(a, _mm256_set1_epi64x((long long)C1));
+  *sb = _mm256_xor_si256(b, _mm256_srli_epi64(a, 17));
+  return mix_fast_avx2(output);
+}
+
+// Counter-based output on four lanes: the vector form of cromulent_at_word()
+// below, taking x = counter * C6 + k0 and kd = rotl(k1 * C2, 31), the key's
+// half of diffuse(), so a kernel can step x by a constant and hoist kd.
+static inline __m256i cromulent_at_avx2(__m256i x, __m256i kd) {
+  x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 33));
+  x = mullo_epi64_avx2(x, _mm256_set1_epi64x((long long)C4));
+  x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 33));
+  x = mullo_epi64_avx2(x, _mm256_set1_epi64x((long long)C5));
+  x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 33));
+  x = _mm256_add_epi64(
+      rotl_avx2(mullo_epi64_avx2(x, _mm256_set1_epi64x((long long)C1)), 23),
+      kd);
+  return mix_fast_avx2(x);
+}
+
+// Exact conversion of integers below 2^53 to double. AVX2 has no 64-bit
+// integer convert, so the 32-bit halves go into the mantissas of 2^52 and
+// 2^84 and are recombined with one exact subtraction and one exact addition.
+static inline __m256d u53_to_double_avx2(__m256i x) {
+  const __m256i lo = _mm256_blend_epi32(
+      x, _mm256_castpd_si256(_mm256_set1_pd(0x1.0p52)), 0xAA);
+  const __m256i hi = _mm256_or_si256(
+      _mm256_srli_epi64(x, 32), _mm256_castpd_si256(_mm256_set1_pd(0x1.0p84)));
+  const __m256d h = _mm256_sub_pd(_mm256_castsi256_pd(hi),
+                                  _mm256_set1_pd(0x1.0p84 + 0x1.0p52));
+  return _mm256_add_pd(h, _mm256_castsi256_pd(lo));
+}
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+// AVX-512DQ has a native 64-bit low multiply and AVX-512F a native rotate, so
+// the eight-lane step needs none of the emulation the AVX2 path carries.
+static inline __m512i mix_fast_avx512(__m512i x) {
+  x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+  x = _mm512_mullo_epi64(x, _mm512_set1_epi64((long long)MH3));
+  x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+  return x;
+}
+
+// One cromulent128 step on eight independent lanes.
+static inline __m512i cromulent_step_avx512(__m512i *s0, __m512i *s1) {
+  const __m512i a = *s0;
+  const __m512i b = *s1;
+
+  *s0 = _mm512_add_epi64(_mm512_mullo_epi64(a, _mm512_set1_epi64((long long)C6)),
+                         b);
+  *s1 = _mm512_add_epi64(_mm512_rol_epi64(b, 31), mix_fast_avx512(a));
+
+  __m512i result = _mm512_add_epi64(a, _mm512_rol_epi64(b, 11));
+  result = _mm512_xor_si512(result, _mm512_srli_epi64(result, 27));
+  result = _mm512_mullo_epi64(result, _mm512_set1_epi64((long long)C3));
+  result = _mm512_xor_si512(result, _mm512_srli_epi64(result, 27));
+  return result;
+}
+
+// One cromulent_strong step on eight independent lanes.
+static inline __m512i cromulent_strong_step_avx512(__m512i *sa, __m512i *sb) {
+  __m512i a = *sa;
+  __m512i b = *sb;
+
+  b = _mm512_add_epi64(b, _mm512_rol_epi64(a, 13));
+  a = _mm512_add_epi64(_mm512_mullo_epi64(_mm512_rol_epi64(a, 29),
+                                          _mm512_set1_epi64((long long)C1)),
+                       b);
+  b = _mm512_xor_si512(_mm512_rol_epi64(b, 17), a);
+  a = _mm512_add_epi64(
+      a, _mm512_rol_epi64(
+             _mm512_mullo_epi64(b, _mm512_set1_epi64((long long)C2)), 31));
+  b = _mm512_add_epi64(b, _mm512_rol_epi64(a, 23));
+  a = _mm512_rol_epi64(_mm512_xor_si512(a, b), 52);
+
+  const __m512i output = _mm512_add_epi64(a, _mm512_rol_epi64(b, 41));
+  *sa = _mm512_add_epi64(a, _mm512_set1_epi64((long long)C1));
+  *sb = _mm512_xor_si512(b, _mm512_srli_epi64(a, 17));
+  return mix_fast_avx512(output);
+}
+
+// Counter-based output on eight lanes, with the arguments of
+// cromulent_at_avx2().
+static inline __m512i cromulent_at_avx512(__m512i x, __m512i kd) {
+  x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 33));
+  x = _mm512_mullo_epi64(x, _mm512_set1_epi64((long long)C4));
+  x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 33));
+  x = _mm512_mullo_epi64(x, _mm512_set1_epi64((long long)C5));
+  x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 33));
+  x = _mm512_add_epi64(
+      _mm512_rol_epi64(_mm512_mullo_epi64(x, _mm512_set1_epi64((long long)C1)),
+                       23),
+      kd);
+  return mix_fast_avx512(x);
+}
 #endif
 
 static inline uint64_t rotl(const uint64_t x, int k) {
@@ -70,6 +201,108 @@ static inline uint64_t mix_fast(uint64_t x) {
   return x;
 }
 
+// One cromulent128 step on a single lane: the transition and output function
+// of cromulent_next, shared by cromulent_inline.h and the multi-lane scalar
+// kernels.
+static inline uint64_t cromulent_step(uint64_t *s0, uint64_t *s1) {
+  const uint64_t a = *s0;
+  const uint64_t b = *s1;
+
+  *s0 = a * C6 + b;
+  *s1 = rotl(b, 31) + mix_fast(a);
+
+  uint64_t result = a + rotl(b, 11);
+  result ^= result >> 27;
+  result *= C3;
+  result ^= result >> 27;
+  return result;
+}
+
+// One cromulent_strong step on a single lane: the body of
+// cromulent_strong_next, shared with the multi-lane scalar kernel.
+static inline uint64_t cromulent_strong_step(uint64_t *sa, uint64_t *sb) {
+  uint64_t a = *sa;
+  uint64_t b = *sb;
+
+  b += rotl(a, 13);
+  a = rotl(a, 29) * C1 + b;
+
+  b = rotl(b, 17) ^ a;
+  a += rotl(b * C2, 31);
+
+  b += rotl(a, 23);
+  a = rotl(a ^ b, 52);
+
+  const uint64_t output = a + rotl(b, 41);
+
+  *sa = a + C1;
+  *sb = b ^ (a >> 17);
+
+  return mix_fast(output);
+}
+
+// Run `lanes` independent cromulent128 lanes for `steps` steps, writing
+// steps * lanes words to dst step-major. Lanes are walked in pairs held in
+// locals: two chains are enough to hide the multiply latency, and locals keep
+// the compiler from interchanging the loops into one serial chain per lane.
+// lanes must be even.
+static inline void cromulent_lanes_fill(uint64_t *s0, uint64_t *s1, int lanes,
+                                        uint64_t *dst, size_t steps) {
+  for (int l = 0; l < lanes; l += 2) {
+    uint64_t a0 = s0[l], a1 = s0[l + 1];
+    uint64_t b0 = s1[l], b1 = s1[l + 1];
+    uint64_t *out = dst + l;
+
+    for (size_t i = 0; i < steps; ++i, out += lanes) {
+      out[0] = cromulent_step(&a0, &b0);
+      out[1] = cromulent_step(&a1, &b1);
+    }
+
+    s0[l] = a0;
+    s0[l + 1] = a1;
+    s1[l] = b0;
+    s1[l + 1] = b1;
+  }
+}
+
+// Uniform conversions shared by every backend. bias is 0 for [0, 1) and 1 for
+// (0, 1]. The biased integer is exact in the target type and the scale is a
+// power of two, so no rounding happens and the SIMD kernels match these
+// bit-for-bit. Floats use 24 bits of a 32-bit half word.
+static inline double cromulent_to_double(uint64_t x, uint64_t bias) {
+  return (double)((x >> 11) + bias) * 0x1.0p-53;
+}
+
+static inline float cromulent_to_float(uint32_t x, uint32_t bias) {
+  return (float)((x >> 8) + bias) * 0x1.0p-24f;
+}
+
+// SplitMix64-style seed expansion, matching cromulent_init: the mixed value is
+// carried forward in *z, so successive calls yield the seeding words in order.
+static inline uint64_t cromulent_seed_step(uint64_t *z) {
+  uint64_t x = *z + C1;
+  x = (x ^ (x >> 30)) * C2;
+  x = (x ^ (x >> 27)) * C3;
+  *z = x;
+  return x ^ (x >> 31);
+}
+
+// Counter-based output (cromulent_at): word `counter` of the stream whose key
+// expands to k0, k1. For a fixed key every stage is a bijection -- an affine
+// map with an odd multiplier, the murmur finalizer, diffuse() with its second
+// argument fixed, and mix_fast -- so the 2^64 words of a stream are distinct.
+static inline uint64_t cromulent_at_word(uint64_t k0, uint64_t k1,
+                                         uint64_t counter) {
+  return mix_fast(diffuse(mix(counter * C6 + k0), k1));
+}
+
+// Key expansion for cromulent_at_word: the first two seeding words of the key,
+// so that related keys give unrelated streams.
+static inline void cromulent_at_key(uint64_t key, uint64_t *k0, uint64_t *k1) {
+  *k0 = cromulent_seed_step(&key);
+  *k1 = cromulent_seed_step(&key);
+}
+
 static inline void cromulent_mul_u64_fallback(uint64_t a, uint64_t b,
                                               uint64_t *hi, uint64_t *lo) {
   const uint64_t mask32 = 0xffffffffULL;
@@ -101,4 +334,212 @@ static inline void cromulent_mul_u64_fallback(uint64_t a, uint64_t b,
   *hi = p3 + (p1 >> 32) + (p2 >> 32) + carry;
 }
 
+// 64x64->128 multiply: the compiler's 128-bit product where available, else
+// cromulent_mul_u64_fallback.
+static inline void cromulent_mul_u64(uint64_t a, uint64_t b, uint64_t *hi,
+                                     uint64_t *lo) {
+#ifdef __SIZEOF_INT128__
+  const __uint128_t m = (__uint128_t)a * b;
+  *hi = (uint64_t)(m >> 64);
+  *lo = (uint64_t)m;
+#else
+  cromulent_mul_u64_fallback(a, b, hi, lo);
+#endif
+}
+
+// Lemire's multiply-shift on 32-bit draws: the halves of words[0..nwords) in
+// stream order (low half first) each map to (x * n) >> 32, kept unless the low
+// half of the product is below the rejection threshold t = 2^32 mod n. Writes
+// the kept values to dst in order and returns how many there were. Every draw
+// is stored and the output pointer advanced only when it is kept, so dst needs
+// room for 2 * nwords values, but no branch depends on the random data.
+static inline size_t cromulent_range32_words(const uint64_t *words,
+                                             size_t nwords, uint32_t n,
+                                             uint32_t t, uint64_t *dst) {
+  uint64_t *out = dst;
+
+  for (size_t i = 0; i < nwords; ++i) {
+    const uint64_t lo = (uint64_t)(uint32_t)words[i] * n;
+    const uint64_t hi = (words[i] >> 32) * n;
+    *out = lo >> 32;
+    out += (uint32_t)lo >= t;
+    *out = hi >> 32;
+    out += (uint32_t)hi >= t;
+  }
+  return (size_t)(out - dst);
+}
+
+// 256-layer ziggurat tables (src/scalar/cromulent_ziggurat_tables.c). A word
+// w picks layer i = w & 0xff; the normal sampler takes its sign from bit 8,
+// and bits 11..63 give m = w >> 11. The fast path returns x = m * w[i] when
+// m < k[i], which puts x strictly inside the next layer's width, so most
+// draws cost one table lookup, one compare and one multiply. f[] holds the
+// density at the layer edges: layer i spans f[i]..f[i + 1], f[0] = 0 and
+// f[256] = 1. r is where the tail beyond the base layer starts.
+typedef struct cromulent_zig_table {
+  uint64_t k[256];
+  double w[256];
+  double f[257];
+  double r;
+} cromulent_zig_table;
+
+extern const cromulent_zig_table cromulent_zig_normal;
+extern const cromulent_zig_table cromulent_zig_exponential;
+
+// Ziggurat fast path shared by every backend: stores the variate for word w
+// and returns 1, or returns 0 when w needs the slow path. symmetric selects
+// the sign bit (normal) or none (exponential). The sign is a coin flip, so it
+// is xored into the result rather than branched on.
+static inline int cromulent_zig_fast(const cromulent_zig_table *t, uint64_t w,
+                                     int symmetric, double *out) {
+  const unsigned i = (unsigned)(w & 0xff);
+  const uint64_t m = w >> 11;
+  const double x = (double)(int64_t)m * t->w[i];
+  uint64_t bits;
+
+  memcpy(&bits, &x, sizeof bits);
+  bits ^= symmetric ? (w & 0x100) << 55 : 0;
+  memcpy(out, &bits, sizeof bits);
+  return m < t->k[i];
+}
+
+// One slot of a Walker / Vose alias table (cromulent_alias_init). A draw
+// lands in slot i and keeps i if its coin is below threshold, else takes
+// alias. Both fields are 64-bit so the SIMD kernels gather them alike.
+typedef struct cromulent_alias_entry {
+  uint64_t threshold;
+  uint64_t alias;
+} cromulent_alias_entry;
+
+// Alias-table draw shared by every backend: the 128-bit product w * n splits
+// one word into the slot (high half, uniform in [0, n)) and the coin (low
+// half). n < 2^32, so the SIMD kernels rebuild the same product from two
+// 32x32-bit multiplies.
+static inline uint32_t cromulent_alias_pick(const cromulent_alias_entry *e,
+                                            uint32_t n, uint64_t w) {
+  uint64_t slot, coin;
+  cromulent_mul_u64(w, n, &slot, &coin);
+  // The coin is a fair guess for the branch predictor, so select with a mask.
+  const uint64_t keep = 0 - (uint64_t)(coin < e[slot].threshold);
+  return (uint32_t)((slot & keep) | (e[slot].alias & ~keep));
+}
+
+// Bulk kernels behind cromulent_fill_u64. Each advances the
+// CROMULENT_BULK_LANES lanes held in s0[] / s1[] by nblocks steps and writes
+// nblocks * CROMULENT_BULK_LANES words to dst, step-major and lane-minor. All
+// kernels produce the identical stream; they differ only in instruction set.
+void cromulent_bulk_blocks_scalar(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                  size_t nblocks);
+// The doubles / floats kernels run the same lanes and write the conversions
+// instead: nblocks * CROMULENT_BULK_LANES doubles, or twice as many floats
+// (low half of each word first), using cromulent_to_double / _to_float.
+void cromulent_bulk_doubles_scalar(uint64_t *s0, uint64_t *s1, double *dst,
+                                   size_t nblocks, uint64_t bias);
+void cromulent_bulk_floats_scalar(uint64_t *s0, uint64_t *s1, float *dst,
+                                  size_t nblocks, uint32_t bias);
+// Range kernels behind cromulent_fill_range for n < 2^32: the vectorized form
+// of cromulent_range32_words. nwords is a multiple of CROMULENT_BULK_LANES.
+size_t cromulent_bulk_range32_scalar(const uint64_t *words, size_t nwords,
+                                     uint32_t n, uint32_t t, uint64_t *dst);
+// Ziggurat kernels behind cromulent_fill_normal / _exponential: run
+// cromulent_zig_fast over words[0..nwords) into dst[0..nwords) and return the
+// index of the first word that needs the slow path (nwords if none). Entries
+// of dst from that index on are unspecified.
+size_t cromulent_bulk_ziggurat_scalar(const uint64_t *words, size_t nwords,
+                                      const cromulent_zig_table *t,
+                                      int symmetric, double *dst);
+// Alias kernels behind cromulent_alias_fill: dst[i] = cromulent_alias_pick of
+// words[i], for every word.
+void cromulent_bulk_alias_scalar(const uint64_t *words, size_t nwords,
+                                 const cromulent_alias_entry *e, uint32_t n,
+                                 uint32_t *dst);
+// Strong kernels behind cromulent_strong_fill_u64: the bulk kernels' contract
+// with the cromulent_strong step on the lanes in a[] / b[].
+void cromulent_strong_blocks_scalar(uint64_t *a, uint64_t *b, uint64_t *dst,
+                                    size_t nblocks);
+// Counter kernels behind cromulent_at_range: dst[i] = cromulent_at_word(k0,
+// k1, start + i) for i < n, any n.
+void cromulent_counter_words_scalar(uint64_t k0, uint64_t k1, uint64_t start,
+                                    uint64_t *dst, size_t n);
+#if defined(CROMULENT_HAVE_AVX2)
+size_t cromulent_bulk_range32_avx2(const uint64_t *words, size_t nwords,
+                                   uint32_t n, uint32_t t, uint64_t *dst);
+size_t cromulent_bulk_ziggurat_avx2(const uint64_t *words, size_t nwords,
+                                    const cromulent_zig_table *t,
+                                    int symmetric, double *dst);
+void cromulent_bulk_alias_avx2(const uint64_t *words, size_t nwords,
+                               const cromulent_alias_entry *e, uint32_t n,
+                               uint32_t *dst);
+void cromulent_bulk_doubles_avx2(uint64_t *s0, uint64_t *s1, double *dst,
+                                 size_t nblocks, uint64_t bias);
+void cromulent_bulk_floats_avx2(uint64_t *s0, uint64_t *s1, float *dst,
+                                size_t nblocks, uint32_t bias);
+void cromulent_bulk_blocks_avx2(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                size_t nblocks);
+// Four-lane AVX2 generator on lanes held in memory (the cromulent_x4 layout),
+// behind the cromulent128_avx2 registry entries. Writes steps * 4 words.
+void cromulent_avx2_fill_lanes(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                               size_t steps);
+void cromulent_strong_blocks_avx2(uint64_t *a, uint64_t *b, uint64_t *dst,
+                                  size_t nblocks);
+void cromulent_counter_words_avx2(uint64_t k0, uint64_t k1, uint64_t start,
+                                  uint64_t *dst, size_t n);
+#endif
+#if defined(CROMULENT_HAVE_AVX512)
+void cromulent_bulk_blocks_avx512(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                  size_t nblocks);
+void cromulent_bulk_doubles_avx512(uint64_t *s0, uint64_t *s1, double *dst,
+                                   size_t nblocks, uint64_t bias);
+void cromulent_bulk_floats_avx512(uint64_t *s0, uint64_t *s1, float *dst,
+                                  size_t nblocks, uint32_t bias);
+size_t cromulent_bulk_range32_avx512(const uint64_t *words, size_t nwords,
+                                     uint32_t n, uint32_t t, uint64_t *dst);
+size_t cromulent_bulk_ziggurat_avx512(const uint64_t *words, size_t nwords,
+                                      const cromulent_zig_table *t,
+                                      int symmetric, double *dst);
+void cromulent_bulk_alias_avx512(const uint64_t *words, size_t nwords,
+                                 const cromulent_alias_entry *e, uint32_t n,
+                                 uint32_t *dst);
+void cromulent_strong_blocks_avx512(uint64_t *a, uint64_t *b, uint64_t *dst,
+                                    size_t nblocks);
+void cromulent_counter_words_avx512(uint64_t k0, uint64_t k1, uint64_t start,
+                                    uint64_t *dst, size_t n);
+#endif
+#if defined(CROMULENT_HAVE_NEON) || defined(CROMULENT_NEON_EMULATION)
+void cromulent_bulk_blocks_neon(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                size_t nblocks);
+void cromulent_bulk_doubles_neon(uint64_t *s0, uint64_t *s1, double *dst,
+                                 size_t nblocks, uint64_t bias);
+void cromulent_bulk_floats_neon(uint64_t *s0, uint64_t *s1, float *dst,
+                                size_t nblocks, uint32_t bias);
+size_t cromulent_bulk_range32_neon(const uint64_t *words, size_t nwords,
+                                   uint32_t n, uint32_t t, uint64_t *dst);
+#endif
+
+// Kernel table selected at run time by src/cromulent_dispatch.c. backend holds
+// the cromulent_backend the table belongs to.
+typedef struct cromulent_kernels {
+  int backend;
+  void (*bulk_blocks)(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                      size_t nblocks);
+  void (*bulk_doubles)(uint64_t *s0, uint64_t *s1, double *dst,
+                       size_t nblocks, uint64_t bias);
+  void (*bulk_floats)(uint64_t *s0, uint64_t *s1, float *dst, size_t nblocks,
+                      uint32_t bias);
+  size_t (*bulk_range32)(const uint64_t *words, size_t nwords, uint32_t n,
+                         uint32_t t, uint64_t *dst);
+  size_t (*bulk_ziggurat)(const uint64_t *words, size_t nwords,
+                          const cromulent_zig_table *t, int symmetric,
+                          double *dst);
+  void (*bulk_alias)(const uint64_t *words, size_t nwords,
+                     const cromulent_alias_entry *e, uint32_t n,
+                     uint32_t *dst);
+  void (*strong_blocks)(uint64_t *a, uint64_t *b, uint64_t *dst,
+                        size_t nblocks);
+  void (*counter_words)(uint64_t k0, uint64_t k1, uint64_t start,
+                        uint64_t *dst, size_t n);
+} cromulent_kernels;
+
+const cromulent_kernels *cromulent_kernels_active(void);
+
 #endif // CROMULENT_INTERNAL
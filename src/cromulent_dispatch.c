@@ -0,0 +1,260 @@
+// src/cromulent_dispatch.c
+//
+// Runtime CPU dispatch for the bulk kernels. The library is built with every
+// kernel the compiler can emit; on first use (or at load time where the
+// toolchain supports constructors) the best one the CPU and OS can run is
+// chosen. Setting CROMULENT_BACKEND=scalar|avx2|avx512|neon in the environment
+// forces a backend, which is handy for benchmarking.
+
+#include "cromulent.h"
+#include <stdlib.h>
+#include <string.h>
+
+// The active table is read by every fill and may be switched by
+// cromulent_backend_select on another thread, so it is accessed atomically.
+// Relaxed ordering is enough: the tables are constants.
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <windows.h>
+typedef const cromulent_kernels *volatile active_kernels;
+static const cromulent_kernels *active_load(active_kernels *a) {
+  return (const cromulent_kernels *)InterlockedCompareExchangePointer(
+      (PVOID volatile *)a, NULL, NULL);
+}
+static void active_store(active_kernels *a, const cromulent_kernels *k) {
+  InterlockedExchangePointer((PVOID volatile *)a, (PVOID)k);
+}
+#else
+#include <stdatomic.h>
+typedef const cromulent_kernels *_Atomic active_kernels;
+static const cromulent_kernels *active_load(active_kernels *a) {
+  return atomic_load_explicit(a, memory_order_relaxed);
+}
+static void active_store(active_kernels *a, const cromulent_kernels *k) {
+  atomic_store_explicit(a, k, memory_order_relaxed);
+}
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+static const cromulent_kernels kernels_scalar = {
+    CROMULENT_BACKEND_SCALAR,
+    cromulent_bulk_blocks_scalar,
+    cromulent_bulk_doubles_scalar,
+    cromulent_bulk_floats_scalar,
+    cromulent_bulk_range32_scalar,
+    cromulent_bulk_ziggurat_scalar,
+    cromulent_bulk_alias_scalar,
+    cromulent_strong_blocks_scalar,
+    cromulent_counter_words_scalar,
+};
+
+#if defined(CROMULENT_HAVE_AVX2)
+static const cromulent_kernels kernels_avx2 = {
+    CROMULENT_BACKEND_AVX2,
+    cromulent_bulk_blocks_avx2,
+    cromulent_bulk_doubles_avx2,
+    cromulent_bulk_floats_avx2,
+    cromulent_bulk_range32_avx2,
+    cromulent_bulk_ziggurat_avx2,
+    cromulent_bulk_alias_avx2,
+    cromulent_strong_blocks_avx2,
+    cromulent_counter_words_avx2,
+};
+#endif
+
+#if defined(CROMULENT_HAVE_AVX512)
+static const cromulent_kernels kernels_avx512 = {
+    CROMULENT_BACKEND_AVX512,
+    cromulent_bulk_blocks_avx512,
+    cromulent_bulk_doubles_avx512,
+    cromulent_bulk_floats_avx512,
+    cromulent_bulk_range32_avx512,
+    cromulent_bulk_ziggurat_avx512,
+    cromulent_bulk_alias_avx512,
+    cromulent_strong_blocks_avx512,
+    cromulent_counter_words_avx512,
+};
+#endif
+
+#if defined(CROMULENT_HAVE_NEON)
+static const cromulent_kernels kernels_neon = {
+    CROMULENT_BACKEND_NEON,
+    cromulent_bulk_blocks_neon,
+    cromulent_bulk_doubles_neon,
+    cromulent_bulk_floats_neon,
+    cromulent_bulk_range32_neon,
+    // NEON has no gather, so the table lookups stay scalar, and no 64-bit
+    // multiply, so cromulent_strong and the counter mode do too
+    cromulent_bulk_ziggurat_scalar,
+    cromulent_bulk_alias_scalar,
+    cromulent_strong_blocks_scalar,
+    cromulent_counter_words_scalar,
+};
+#endif
+
+static const char *const backend_names[] = {"scalar", "avx2", "avx512",
+                                            "neon"};
+
+#define BACKEND_COUNT (sizeof(backend_names) / sizeof(backend_names[0]))
+
+#if defined(__x86_64__) || defined(_M_X64)
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, (int)leaf, (int)subleaf);
+  for (int i = 0; i < 4; ++i)
+    regs[i] = (uint32_t)r[i];
+#else
+  if (!__get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2],
+                         &regs[3]))
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+}
+
+// XCR0: which register files the OS saves across context switches.
+static uint64_t xgetbv0(void) {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+static int cpu_supports(cromulent_backend backend) {
+  uint32_t r[4];
+
+  cpuid(0, 0, r);
+  const uint32_t max_leaf = r[0];
+  if (max_leaf < 7)
+    return 0;
+
+  cpuid(1, 0, r);
+  const int osxsave = (r[2] >> 27) & 1;
+  const int avx = (r[2] >> 28) & 1;
+  if (!osxsave || !avx)
+    return 0;
+
+  const uint64_t xcr0 = xgetbv0();
+  const int ymm_enabled = (xcr0 & 0x06) == 0x06;
+  const int zmm_enabled = (xcr0 & 0xe6) == 0xe6;
+
+  cpuid(7, 0, r);
+  const int avx2 = (r[1] >> 5) & 1;
+  const int avx512f = (r[1] >> 16) & 1;
+  const int avx512dq = (r[1] >> 17) & 1;
+  const int avx512vl = (r[1] >> 31) & 1;
+
+  switch (backend) {
+  case CROMULENT_BACKEND_AVX2:
+    return ymm_enabled && avx2;
+  case CROMULENT_BACKEND_AVX512:
+    return zmm_enabled && avx512f && avx512dq && avx512vl;
+  default:
+    return 0;
+  }
+}
+#else
+// NEON is part of the AArch64 base architecture.
+static int cpu_supports(cromulent_backend backend) {
+#if defined(__aarch64__) && defined(__ARM_NEON)
+  return backend == CROMULENT_BACKEND_NEON;
+#else
+  (void)backend;
+  return 0;
+#endif
+}
+#endif
+
+static const cromulent_kernels *kernels_for(cromulent_backend backend) {
+  if (backend != CROMULENT_BACKEND_SCALAR && !cpu_supports(backend))
+    return NULL;
+
+  switch (backend) {
+  case CROMULENT_BACKEND_SCALAR:
+    return &kernels_scalar;
+#if defined(CROMULENT_HAVE_AVX2)
+  case CROMULENT_BACKEND_AVX2:
+    return &kernels_avx2;
+#endif
+#if defined(CROMULENT_HAVE_AVX512)
+  case CROMULENT_BACKEND_AVX512:
+    return &kernels_avx512;
+#endif
+#if defined(CROMULENT_HAVE_NEON)
+  case CROMULENT_BACKEND_NEON:
+    return &kernels_neon;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+static const cromulent_kernels *resolve(void) {
+  const char *forced = getenv("CROMULENT_BACKEND");
+  if (forced) {
+    for (size_t i = 0; i < BACKEND_COUNT; ++i) {
+      if (strcmp(forced, backend_names[i]) == 0) {
+        const cromulent_kernels *k = kernels_for((cromulent_backend)i);
+        if (k)
+          return k;
+      }
+    }
+  }
+
+  for (size_t i = BACKEND_COUNT; i-- > 0;) {
+    const cromulent_kernels *k = kernels_for((cromulent_backend)i);
+    if (k)
+      return k;
+  }
+  return &kernels_scalar;
+}
+
+// Every resolver computes the same answer, so a racing first use from two
+// threads only stores the same pointer twice.
+static active_kernels active;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor)) static void resolve_at_load(void) {
+  if (!active_load(&active))
+    active_store(&active, resolve());
+}
+#endif
+
+const cromulent_kernels *cromulent_kernels_active(void) {
+  const cromulent_kernels *k = active_load(&active);
+  if (!k) {
+    k = resolve();
+    active_store(&active, k);
+  }
+  return k;
+}
+
+cromulent_backend cromulent_backend_active(void) {
+  return (cromulent_backend)cromulent_kernels_active()->backend;
+}
+
+int cromulent_backend_supported(cromulent_backend backend) {
+  return kernels_for(backend) != NULL;
+}
+
+int cromulent_backend_select(cromulent_backend backend) {
+  const cromulent_kernels *k = kernels_for(backend);
+  if (!k)
+    return -1;
+  active_store(&active, k);
+  return 0;
+}
+
+const char *cromulent_backend_name(cromulent_backend backend) {
+  if ((size_t)backend >= BACKEND_COUNT)
+    return NULL;
+  return backend_names[backend];
+}
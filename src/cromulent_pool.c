@@ -0,0 +1,462 @@
+// src/cromulent_pool.c
+//
+// Pool files: pre-generated output plus the generator state at the start of
+// every chunk, so readers can map the payload and read any offset in place, or
+// recompute a range from the nearest checkpoint. Chunks are independent
+// substreams, which is what lets the writer fill them in parallel: the
+// cromulent transition has no jump-ahead.
+//
+// Layout, all integers little-endian:
+//
+//   0    char[8]   "CROMPOOL", written last so interrupted writes are rejected
+//   8    u32       version (1)
+//   12   u32       header bytes (128)
+//   16   char[32]  generator name, NUL-padded
+//   48   u64       seed, payload size, chunk bytes, chunk count
+//   80   u32       lanes, state size
+//   88   u64       checkpoint table offset, payload offset
+//   104  reserved, zero
+//
+// The checkpoint table holds chunks * state_size bytes. The payload starts on
+// a 64 KiB boundary, so it is page-aligned in the mapping on every common page
+// size.
+
+#define _FILE_OFFSET_BITS 64
+
+#include "cromulent.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(CROMULENT_HAVE_PTHREADS)
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+#define MAGIC "CROMPOOL"
+#define VERSION 1
+#define HEADER_BYTES 128
+#define NAME_BYTES 32
+#define DATA_ALIGN 65536
+#define BULK_NAME "cromulent_bulk"
+#define BULK_STATE_BYTES (2 * CROMULENT_BULK_LANES * sizeof(uint64_t))
+
+// Words generated per call while writing, and while skipping or copying in
+// cromulent_pool_regenerate.
+#define WRITE_WORDS (1 << 17)
+#define REGEN_WORDS 512
+
+static void store_le32(uint8_t *out, uint32_t x) {
+  for (int i = 0; i < 4; i++)
+    out[i] = (uint8_t)(x >> (8 * i));
+}
+
+static void store_le64(uint8_t *out, uint64_t x) {
+  for (int i = 0; i < 8; i++)
+    out[i] = (uint8_t)(x >> (8 * i));
+}
+
+static uint32_t load_le32(const uint8_t *in) {
+  uint32_t x = 0;
+  for (int i = 0; i < 4; i++)
+    x |= (uint32_t)in[i] << (8 * i);
+  return x;
+}
+
+static uint64_t load_le64(const uint8_t *in) {
+  uint64_t x = 0;
+  for (int i = 0; i < 8; i++)
+    x |= (uint64_t)in[i] << (8 * i);
+  return x;
+}
+
+// Put generated words into payload byte order.
+static void words_to_le(uint64_t *w, size_t n) {
+  const union {
+    uint16_t u;
+    uint8_t b[2];
+  } probe = {1};
+  if (probe.b[0])
+    return;
+  for (size_t i = 0; i < n; i++)
+    store_le64((uint8_t *)&w[i], w[i]);
+}
+
+// One generator instance: a v2 registry state, or a bulk state when gen is
+// NULL.
+typedef struct {
+  const CromulentPRNG2 *gen;
+  void *state;
+  cromulent_bulk_state bulk;
+  size_t state_size;
+} source;
+
+static int source_open(source *src, const char *name) {
+  src->gen = NULL;
+  src->state = NULL;
+  src->state_size = BULK_STATE_BYTES;
+  if (strcmp(name, BULK_NAME) == 0)
+    return 0;
+  src->gen = cromulent_registry_v2_find(name);
+  if (!src->gen) {
+    errno = ENOTSUP;
+    return -1;
+  }
+  src->state_size = src->gen->state_size;
+  src->state = malloc(src->state_size);
+  return src->state ? 0 : -1;
+}
+
+static void source_close(source *src) { free(src->state); }
+
+static void source_seed(source *src, uint64_t seed) {
+  if (src->gen)
+    src->gen->init(src->state, seed);
+  else
+    cromulent_bulk_init(&src->bulk, seed);
+}
+
+// Checkpoints are only taken at chunk starts, where a bulk state has no
+// buffered step, so its lanes are all there is to save.
+static void source_save(const source *src, uint8_t *out) {
+  if (src->gen) {
+    src->gen->save(src->state, out);
+    return;
+  }
+  for (int i = 0; i < CROMULENT_BULK_LANES; i++) {
+    store_le64(out + 8 * i, src->bulk.s0[i]);
+    store_le64(out + 8 * (CROMULENT_BULK_LANES + i), src->bulk.s1[i]);
+  }
+}
+
+static void source_load(source *src, const uint8_t *in) {
+  if (src->gen) {
+    src->gen->load(src->state, in);
+    return;
+  }
+  for (int i = 0; i < CROMULENT_BULK_LANES; i++) {
+    src->bulk.s0[i] = load_le64(in + 8 * i);
+    src->bulk.s1[i] = load_le64(in + 8 * (CROMULENT_BULK_LANES + i));
+  }
+  memset(src->bulk.block, 0, sizeof src->bulk.block);
+  src->bulk.pos = sizeof src->bulk.block;
+}
+
+static void source_fill(source *src, uint64_t *dst, size_t n) {
+  if (src->gen)
+    src->gen->fill(src->state, dst, n);
+  else
+    cromulent_fill_u64(&src->bulk, dst, n);
+  words_to_le(dst, n);
+}
+
+static uint32_t generator_lanes(const char *name) {
+  if (strcmp(name, BULK_NAME) == 0)
+    return CROMULENT_BULK_LANES;
+  if (strcmp(name, "cromulent128_avx2") == 0)
+    return 4;
+  return 1;
+}
+
+static int pwrite_all(int fd, const void *buf, size_t n, uint64_t offset) {
+  const uint8_t *p = buf;
+  while (n > 0) {
+    const ssize_t w = pwrite(fd, p, n, (off_t)offset);
+    if (w < 0) {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    p += w;
+    n -= (size_t)w;
+    offset += (uint64_t)w;
+  }
+  return 0;
+}
+
+typedef struct {
+  int fd;
+  const char *generator;
+  const uint8_t *table;
+  size_t state_size;
+  uint64_t size, chunk_bytes, chunks, data_offset;
+#if defined(CROMULENT_HAVE_PTHREADS)
+  atomic_uint_fast64_t next;
+  atomic_int error;
+#else
+  uint64_t next;
+  int error;
+#endif
+} write_job;
+
+// Generate chunks from their checkpoints until none are left, so the payload
+// is by construction what cromulent_pool_regenerate recomputes.
+static void *write_worker(void *arg) {
+  write_job *job = arg;
+  source src;
+  uint64_t *buf = NULL;
+
+  if (source_open(&src, job->generator) != 0 ||
+      !(buf = malloc(WRITE_WORDS * sizeof *buf))) {
+    job->error = errno;
+    source_close(&src);
+    return NULL;
+  }
+  for (;;) {
+#if defined(CROMULENT_HAVE_PTHREADS)
+    const uint64_t c =
+        atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed);
+#else
+    const uint64_t c = job->next++;
+#endif
+    if (c >= job->chunks || job->error)
+      break;
+    uint64_t at = c * job->chunk_bytes;
+    uint64_t left = job->size - at;
+    if (left > job->chunk_bytes)
+      left = job->chunk_bytes;
+    source_load(&src, job->table + c * job->state_size);
+    while (left > 0) {
+      const size_t bytes =
+          left < WRITE_WORDS * sizeof *buf ? (size_t)left
+                                           : WRITE_WORDS * sizeof *buf;
+      source_fill(&src, buf, (bytes + 7) / 8);
+      if (pwrite_all(job->fd, buf, bytes, job->data_offset + at) != 0) {
+        job->error = errno;
+        break;
+      }
+      at += bytes;
+      left -= bytes;
+    }
+  }
+  free(buf);
+  source_close(&src);
+  return NULL;
+}
+
+#if defined(CROMULENT_HAVE_PTHREADS)
+static void run_writers(write_job *job, unsigned threads) {
+  pthread_t helpers[63];
+  unsigned started = 0;
+
+  if (threads > job->chunks)
+    threads = (unsigned)job->chunks;
+  if (threads > 64)
+    threads = 64;
+  while (started + 1 < threads &&
+         pthread_create(&helpers[started], NULL, write_worker, job) == 0)
+    ++started;
+  write_worker(job);
+  for (unsigned t = 0; t < started; ++t)
+    pthread_join(helpers[t], NULL);
+}
+#else
+static void run_writers(write_job *job, unsigned threads) {
+  (void)threads;
+  write_worker(job);
+}
+#endif
+
+static uint64_t align_data(uint64_t x) {
+  return (x + DATA_ALIGN - 1) / DATA_ALIGN * DATA_ALIGN;
+}
+
+int cromulent_pool_write(const char *path, const char *generator,
+                         uint64_t seed, uint64_t size, uint64_t chunk_bytes,
+                         unsigned threads) {
+  if (!path || !generator || strlen(generator) >= NAME_BYTES ||
+      chunk_bytes == 0 || chunk_bytes % 8 != 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  source src;
+  if (source_open(&src, generator) != 0)
+    return -1;
+  const uint64_t chunks = size / chunk_bytes + (size % chunk_bytes != 0);
+  const size_t state_size = src.state_size;
+  if (chunks > SIZE_MAX / state_size) {
+    source_close(&src);
+    errno = EFBIG;
+    return -1;
+  }
+  const size_t table_bytes = (size_t)chunks * state_size;
+  const uint64_t data_offset = align_data(HEADER_BYTES + (uint64_t)table_bytes);
+  if (size > UINT64_MAX - data_offset) {
+    source_close(&src);
+    errno = EFBIG;
+    return -1;
+  }
+
+  uint8_t *table = malloc(table_bytes ? table_bytes : 1);
+  if (!table) {
+    source_close(&src);
+    return -1;
+  }
+  for (uint64_t c = 0; c < chunks; c++) {
+    source_seed(&src, cromulent_split_seed(seed, c));
+    source_save(&src, table + c * state_size);
+  }
+  source_close(&src);
+
+  const int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    free(table);
+    return -1;
+  }
+  write_job job = {fd, generator, table, state_size, size, chunk_bytes,
+                   chunks, data_offset, 0, 0};
+  if (pwrite_all(fd, table, table_bytes, HEADER_BYTES) != 0 ||
+      ftruncate(fd, (off_t)(data_offset + size)) != 0)
+    job.error = errno;
+  else
+    run_writers(&job, threads ? threads : 1);
+  free(table);
+
+  uint8_t header[HEADER_BYTES] = {0};
+  memcpy(header, MAGIC, 8);
+  store_le32(header + 8, VERSION);
+  store_le32(header + 12, HEADER_BYTES);
+  memcpy(header + 16, generator, strlen(generator));
+  store_le64(header + 48, seed);
+  store_le64(header + 56, size);
+  store_le64(header + 64, chunk_bytes);
+  store_le64(header + 72, chunks);
+  store_le32(header + 80, generator_lanes(generator));
+  store_le32(header + 84, (uint32_t)state_size);
+  store_le64(header + 88, HEADER_BYTES);
+  store_le64(header + 96, data_offset);
+
+  int error = job.error;
+  if (!error && pwrite_all(fd, header, sizeof header, 0) != 0)
+    error = errno;
+  if (close(fd) != 0 && !error)
+    error = errno;
+  if (error) {
+    unlink(path);
+    errno = error;
+    return -1;
+  }
+  return 0;
+}
+
+int cromulent_pool_open(cromulent_pool *pool, const char *path) {
+  memset(pool, 0, sizeof *pool);
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return -1;
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return -1;
+  }
+  if (st.st_size < HEADER_BYTES || (uint64_t)st.st_size > SIZE_MAX) {
+    close(fd);
+    errno = st.st_size < HEADER_BYTES ? EINVAL : EFBIG;
+    return -1;
+  }
+  const size_t file_bytes = (size_t)st.st_size;
+  void *map = mmap(NULL, file_bytes, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return -1;
+
+  const uint8_t *h = map;
+  const uint64_t size = load_le64(h + 56);
+  const uint64_t chunk_bytes = load_le64(h + 64);
+  const uint64_t chunks = load_le64(h + 72);
+  const uint32_t state_size = load_le32(h + 84);
+  const uint64_t table = load_le64(h + 88);
+  const uint64_t data = load_le64(h + 96);
+  const int valid =
+      memcmp(h, MAGIC, 8) == 0 && load_le32(h + 8) == VERSION &&
+      load_le32(h + 12) == HEADER_BYTES &&
+      memchr(h + 16, 0, NAME_BYTES) != NULL && chunk_bytes != 0 &&
+      chunk_bytes % 8 == 0 &&
+      chunks == size / chunk_bytes + (size % chunk_bytes != 0) &&
+      state_size != 0 && table >= HEADER_BYTES && table <= data &&
+      chunks <= (data - table) / state_size && data <= file_bytes &&
+      size <= file_bytes - data;
+  if (!valid) {
+    munmap(map, file_bytes);
+    errno = EINVAL;
+    return -1;
+  }
+
+  pool->data = h + data;
+  pool->size = size;
+  pool->seed = load_le64(h + 48);
+  pool->chunk_bytes = chunk_bytes;
+  pool->chunks = chunks;
+  pool->lanes = load_le32(h + 80);
+  pool->state_size = state_size;
+  memcpy(pool->generator, h + 16, NAME_BYTES);
+  pool->checkpoints = h + table;
+  pool->map = map;
+  pool->map_bytes = file_bytes;
+  return 0;
+}
+
+void cromulent_pool_close(cromulent_pool *pool) {
+  if (pool->map)
+    munmap(pool->map, pool->map_bytes);
+  memset(pool, 0, sizeof *pool);
+}
+
+int cromulent_pool_regenerate(const cromulent_pool *pool, uint64_t offset,
+                              void *dst, size_t n) {
+  if (offset > pool->size || n > pool->size - offset) {
+    errno = EINVAL;
+    return -1;
+  }
+  if (n == 0)
+    return 0;
+
+  source src;
+  if (source_open(&src, pool->generator) != 0)
+    return -1;
+  if (src.state_size != pool->state_size) {
+    source_close(&src);
+    errno = ENOTSUP;
+    return -1;
+  }
+
+  uint64_t buf[REGEN_WORDS];
+  uint8_t *out = dst;
+  while (n > 0) {
+    const uint64_t c = offset / pool->chunk_bytes;
+    const uint64_t in = offset - c * pool->chunk_bytes;
+    uint64_t take = pool->chunk_bytes - in;
+    if (take > n)
+      take = n;
+    source_load(&src, pool->checkpoints + c * pool->state_size);
+
+    for (uint64_t skip = in / 8; skip > 0;) {
+      const size_t k = skip < REGEN_WORDS ? (size_t)skip : REGEN_WORDS;
+      source_fill(&src, buf, k);
+      skip -= k;
+    }
+    // Bytes of the first word that lie before offset
+    size_t lead = (size_t)(in % 8);
+    n -= (size_t)take;
+    offset += take;
+    while (take > 0) {
+      size_t words = (size_t)((lead + take + 7) / 8);
+      if (words > REGEN_WORDS)
+        words = REGEN_WORDS;
+      source_fill(&src, buf, words);
+      size_t bytes = words * 8 - lead;
+      if (bytes > take)
+        bytes = (size_t)take;
+      memcpy(out, (const uint8_t *)buf + lead, bytes);
+      out += bytes;
+      take -= bytes;
+      lead = 0;
+    }
+  }
+  source_close(&src);
+  return 0;
+}
@@ -3,22 +3,81 @@
 // A super-light “registry” that maps a short string to the
 //   (init, next) function pair for each generator.
 // It lets tools/tests pick a PRNG at run-time without if/else ladders.
+// The v2 table does the same for the state-passing entry points.
 
 #include "cromulent.h"
 #include <stddef.h>
 #include <string.h>
 
+#if defined(CROMULENT_HAVE_AVX2)
+// cromulent128_avx2: four AVX2 lanes in the cromulent_x4 layout plus one
+// buffered step, so that next() hands out the lanes in order.
+typedef struct {
+  cromulent_x4_state lanes;
+  uint64_t block[4];
+  uint64_t pos; // words of block[] already handed out
+} avx2_state;
+
+static void avx2_init(avx2_state *st, uint64_t seed) {
+  cromulent_x4_init(&st->lanes, seed);
+  st->pos = 4;
+}
+
+static uint64_t avx2_next(avx2_state *st) {
+  if (st->pos >= 4) {
+    cromulent_avx2_fill_lanes(st->lanes.s0, st->lanes.s1, st->block, 1);
+    st->pos = 0;
+  }
+  return st->block[st->pos++];
+}
+
+static void avx2_fill(avx2_state *st, uint64_t *dst, size_t n) {
+  size_t i = 0;
+  while (i < n && st->pos < 4)
+    dst[i++] = st->block[st->pos++];
+
+  const size_t steps = (n - i) / 4;
+  cromulent_avx2_fill_lanes(st->lanes.s0, st->lanes.s1, dst + i, steps);
+  i += steps * 4;
+
+  while (i < n)
+    dst[i++] = avx2_next(st);
+}
+
+static avx2_state global_avx2;
+
+static void init_avx2(uint64_t seed) { avx2_init(&global_avx2, seed); }
+
+static uint64_t avx2pp(void) { return avx2_next(&global_avx2); }
+#endif
+
 static const CromulentPRNG registry[] = {
     {"xoshiro256", init_xoshiro, xoshiro256pp},
     {"cromulent128", init_cromulent, cromulent128pp},
     {"splitmix64", init_splitmix64, splitmix64pp},
     {"pcg64", init_pcg64, pcg64pp},
+    {"cromulent_strong", init_cromulent_strong, cromulent_strongpp},
+    {"cromulent_at", init_cromulent_at, cromulent_atpp},
+#if defined(CROMULENT_HAVE_AVX2)
+    {"cromulent128_avx2", init_avx2, avx2pp}, // keep last, see visible()
+#endif
 };
 
 #define REGISTRY_COUNT (sizeof(registry) / sizeof(registry[0]))
 
+// The AVX2 entries sit at the end of both tables, so hiding them on CPUs
+// without AVX2 only shortens the visible part.
+static size_t visible(size_t count) {
+#if defined(CROMULENT_HAVE_AVX2)
+  if (!cromulent_backend_supported(CROMULENT_BACKEND_AVX2))
+    return count - 1;
+#endif
+  return count;
+}
+
 const CromulentPRNG *cromulent_registry_find(const char *name) {
-  for (size_t i = 0; i < REGISTRY_COUNT; ++i)
+  const size_t count = visible(REGISTRY_COUNT);
+  for (size_t i = 0; i < count; ++i)
     if (strcmp(registry[i].name, name) == 0)
       return &registry[i];
   return NULL; // not found
@@ -26,6 +85,106 @@ const CromulentPRNG *cromulent_registry_find(const char *name) {
 
 const CromulentPRNG *cromulent_registry_all(size_t *count_out) {
   if (count_out)
-    *count_out = REGISTRY_COUNT;
+    *count_out = visible(REGISTRY_COUNT);
   return registry;
 }
+
+// v2 adapters. Every state is a plain array of uint64_t words, so save/load
+// serialize word by word in little-endian order.
+static void save_words(const void *state, uint8_t *buffer, size_t words) {
+  const uint64_t *w = state;
+  for (size_t i = 0; i < words; i++)
+    for (int b = 0; b < 8; b++)
+      buffer[8 * i + b] = (uint8_t)(w[i] >> (8 * b));
+}
+
+static void load_words(void *state, const uint8_t *buffer, size_t words) {
+  uint64_t *w = state;
+  for (size_t i = 0; i < words; i++) {
+    uint64_t x = 0;
+    for (int b = 0; b < 8; b++)
+      x |= (uint64_t)buffer[8 * i + b] << (8 * b);
+    w[i] = x;
+  }
+}
+
+#define DEFINE_V2_ADAPTERS(prefix, type, init_fn, next_fn, fill_fn)            \
+  static void prefix##_init_v2(void *state, uint64_t seed) {                  \
+    init_fn((type *)state, seed);                                              \
+  }                                                                            \
+  static uint64_t prefix##_next_v2(void *state) {                              \
+    return next_fn((type *)state);                                             \
+  }                                                                            \
+  static void prefix##_fill_v2(void *state, uint64_t *dst, size_t n) {         \
+    fill_fn((type *)state, dst, n);                                            \
+  }                                                                            \
+  static void prefix##_save_v2(const void *state, uint8_t *buffer) {           \
+    save_words(state, buffer, sizeof(type) / sizeof(uint64_t));                \
+  }                                                                            \
+  static void prefix##_load_v2(void *state, const uint8_t *buffer) {           \
+    load_words(state, buffer, sizeof(type) / sizeof(uint64_t));                \
+  }
+
+// fill() for generators without a batch entry point
+#define DEFINE_FILL_LOOP(name, type, next_fn)                                  \
+  static void name(type *state, uint64_t *dst, size_t n) {                     \
+    for (size_t i = 0; i < n; i++)                                             \
+      dst[i] = next_fn(state);                                                 \
+  }
+
+#define V2_ENTRY(name, prefix, type)                                           \
+  {name,                                                                       \
+   sizeof(type),                                                               \
+   prefix##_init_v2,                                                           \
+   prefix##_next_v2,                                                           \
+   prefix##_fill_v2,                                                           \
+   prefix##_save_v2,                                                           \
+   prefix##_load_v2}
+
+DEFINE_FILL_LOOP(xoshiro256_fill, xoshiro256_state, xoshiro256_next)
+DEFINE_FILL_LOOP(cromulent128_fill, cromulent_state, cromulent_next)
+DEFINE_FILL_LOOP(splitmix64_fill, splitmix64_state, splitmix64_next)
+DEFINE_FILL_LOOP(pcg64_fill, pcg64_state, pcg64_next)
+
+DEFINE_V2_ADAPTERS(xoshiro, xoshiro256_state, xoshiro256_init, xoshiro256_next,
+                   xoshiro256_fill)
+DEFINE_V2_ADAPTERS(cromulent, cromulent_state, cromulent_init, cromulent_next,
+                   cromulent128_fill)
+DEFINE_V2_ADAPTERS(splitmix, splitmix64_state, splitmix64_init,
+                   splitmix64_next, splitmix64_fill)
+DEFINE_V2_ADAPTERS(pcg, pcg64_state, pcg64_init, pcg64_next, pcg64_fill)
+DEFINE_V2_ADAPTERS(strong, cromulent_strong_state, cromulent_strong_init,
+                   cromulent_strong_next, cromulent_strong_fill)
+DEFINE_V2_ADAPTERS(at, cromulent_at_state, cromulent_at_init, cromulent_at_next,
+                   cromulent_at_fill)
+#if defined(CROMULENT_HAVE_AVX2)
+DEFINE_V2_ADAPTERS(avx2, avx2_state, avx2_init, avx2_next, avx2_fill)
+#endif
+
+static const CromulentPRNG2 registry_v2[] = {
+    V2_ENTRY("xoshiro256", xoshiro, xoshiro256_state),
+    V2_ENTRY("cromulent128", cromulent, cromulent_state),
+    V2_ENTRY("splitmix64", splitmix, splitmix64_state),
+    V2_ENTRY("pcg64", pcg, pcg64_state),
+    V2_ENTRY("cromulent_strong", strong, cromulent_strong_state),
+    V2_ENTRY("cromulent_at", at, cromulent_at_state),
+#if defined(CROMULENT_HAVE_AVX2)
+    V2_ENTRY("cromulent128_avx2", avx2, avx2_state), // keep last
+#endif
+};
+
+#define REGISTRY_V2_COUNT (sizeof(registry_v2) / sizeof(registry_v2[0]))
+
+const CromulentPRNG2 *cromulent_registry_v2_find(const char *name) {
+  const size_t count = visible(REGISTRY_V2_COUNT);
+  for (size_t i = 0; i < count; ++i)
+    if (strcmp(registry_v2[i].name, name) == 0)
+      return &registry_v2[i];
+  return NULL; // not found
+}
+
+const CromulentPRNG2 *cromulent_registry_v2_all(size_t *count_out) {
+  if (count_out)
+    *count_out = visible(REGISTRY_V2_COUNT);
+  return registry_v2;
+}
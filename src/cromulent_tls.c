@@ -0,0 +1,77 @@
+// src/cromulent_tls.c
+//
+// Thread-local default generator. Every thread owns a private cromulent_state,
+// seeded on first use with its own substream of a shared master seed, so the
+// hot path is a plain cromulent_next on thread-local memory: no locks and no
+// shared cache lines.
+
+#include "cromulent.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <windows.h>
+#define CROMULENT_THREAD_LOCAL __declspec(thread)
+typedef volatile LONG64 tls_counter;
+static uint64_t counter_take(tls_counter *c) {
+  return (uint64_t)InterlockedIncrement64(c) - 1;
+}
+static void counter_store(tls_counter *c, uint64_t v) {
+  InterlockedExchange64(c, (LONG64)v);
+}
+static uint64_t counter_load(tls_counter *c) {
+  return (uint64_t)InterlockedCompareExchange64(c, 0, 0);
+}
+#else
+#include <stdatomic.h>
+#define CROMULENT_THREAD_LOCAL _Thread_local
+typedef _Atomic uint64_t tls_counter;
+static uint64_t counter_take(tls_counter *c) {
+  return atomic_fetch_add_explicit(c, 1, memory_order_relaxed);
+}
+static void counter_store(tls_counter *c, uint64_t v) {
+  atomic_store_explicit(c, v, memory_order_relaxed);
+}
+static uint64_t counter_load(tls_counter *c) {
+  return atomic_load_explicit(c, memory_order_relaxed);
+}
+#endif
+
+#define DEFAULT_MASTER_SEED 0x853c49e6748fea9bULL
+
+static tls_counter master_seed = DEFAULT_MASTER_SEED;
+static tls_counter next_ordinal;
+
+static CROMULENT_THREAD_LOCAL cromulent_state tls_state;
+static CROMULENT_THREAD_LOCAL int tls_seeded;
+
+static void bind_stream(uint64_t stream) {
+  cromulent_state master;
+  cromulent_init(&master, counter_load(&master_seed));
+  cromulent_split(&master, stream, &tls_state);
+  tls_seeded = 1;
+}
+
+static cromulent_state *state_for_thread(void) {
+  if (!tls_seeded)
+    bind_stream(counter_take(&next_ordinal));
+  return &tls_state;
+}
+
+void cromulent_tls_seed(uint64_t seed) {
+  counter_store(&master_seed, seed);
+  counter_store(&next_ordinal, 0);
+  tls_seeded = 0;
+}
+
+void cromulent_tls_bind(uint64_t stream) { bind_stream(stream); }
+
+uint64_t cromulent_tls_next(void) { return cromulent_next(state_for_thread()); }
+
+double cromulent_tls_double(void) {
+  return cromulent_double(state_for_thread());
+}
+
+float cromulent_tls_float(void) { return cromulent_float(state_for_thread()); }
+
+uint64_t cromulent_tls_range(uint64_t n) {
+  return cromulent_range(state_for_thread(), n);
+}
@@ -1,9 +1,8 @@
 // xoshiro.c
 #include "cromulent.h"
 
-static uint64_t s[4];
-
-uint64_t xoshiro256pp(void) {
+uint64_t xoshiro256_next(xoshiro256_state *state) {
+  uint64_t *s = state->s;
   const uint64_t result = rotl(s[0] + s[3], 23) + s[0];
   const uint64_t t = s[1] << 17;
 
@@ -16,7 +15,14 @@ uint64_t xoshiro256pp(void) {
   return result;
 }
 
-void init_xoshiro(uint64_t seed) {
+void xoshiro256_init(xoshiro256_state *state, uint64_t seed) {
   for (int i = 0; i < 4; ++i)
-    s[i] = seed ^ (i * C1);
+    state->s[i] = seed ^ (i * C1);
 }
+
+// Process-global instance behind the v1 registry entry
+static xoshiro256_state xs;
+
+uint64_t xoshiro256pp(void) { return xoshiro256_next(&xs); }
+
+void init_xoshiro(uint64_t seed) { xoshiro256_init(&xs, seed); }
@@ -0,0 +1,97 @@
+// src/scalar/cromulent_alias.c
+//
+// Walker / Vose alias tables: O(n) construction from a weight array and O(1)
+// sampling from one 64-bit draw. The library does not allocate, so the build
+// keeps Vose's two worklists as stacks linked through the alias fields and
+// the scaled probabilities in the threshold fields of the caller's entries.
+
+#include "cromulent.h"
+#include <math.h>
+
+#define NIL UINT64_MAX
+
+static double get_p(const cromulent_alias_entry *e) {
+  double p;
+  memcpy(&p, &e->threshold, sizeof p);
+  return p;
+}
+
+static void set_p(cromulent_alias_entry *e, double p) {
+  memcpy(&e->threshold, &p, sizeof p);
+}
+
+static void push(cromulent_alias_entry *entries, uint64_t *head, uint64_t i,
+                 double p) {
+  set_p(&entries[i], p);
+  entries[i].alias = *head;
+  *head = i;
+}
+
+static uint64_t pop(cromulent_alias_entry *entries, uint64_t *head) {
+  const uint64_t i = *head;
+  *head = entries[i].alias;
+  return i;
+}
+
+int cromulent_alias_init(cromulent_alias *table, cromulent_alias_entry *entries,
+                         const double *weights, size_t n) {
+  if (n == 0 || n > UINT32_MAX)
+    return -1;
+
+  double sum = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (!(weights[i] >= 0) || !isfinite(weights[i]))
+      return -1;
+    sum += weights[i];
+  }
+  if (!(sum > 0) || !isfinite(sum))
+    return -1;
+
+  // Scale to mean 1: slot i then holds p_i of its own category.
+  const double scale = (double)n / sum;
+  uint64_t small = NIL, large = NIL;
+  for (size_t i = 0; i < n; ++i) {
+    const double p = weights[i] * scale;
+    push(entries, p < 1.0 ? &small : &large, i, p);
+  }
+
+  // Fill each under-full slot from an over-full category. A finished slot
+  // keeps its probability and takes its alias for good.
+  while (small != NIL && large != NIL) {
+    const uint64_t s = pop(entries, &small);
+    const uint64_t l = pop(entries, &large);
+    const double ps = get_p(&entries[s]);
+    const double pl = (get_p(&entries[l]) + ps) - 1.0;
+
+    entries[s].alias = l;
+    push(entries, pl < 1.0 ? &small : &large, l, pl);
+  }
+
+  // Whatever is left is full up to rounding.
+  while (large != NIL) {
+    const uint64_t i = pop(entries, &large);
+    set_p(&entries[i], 1.0);
+    entries[i].alias = i;
+  }
+  while (small != NIL) {
+    const uint64_t i = pop(entries, &small);
+    set_p(&entries[i], 1.0);
+    entries[i].alias = i;
+  }
+
+  // p < 1 scales exactly into [0, 2^64); a full slot aliases itself, so its
+  // coin does not matter.
+  for (size_t i = 0; i < n; ++i) {
+    const double p = get_p(&entries[i]);
+    entries[i].threshold = p < 1.0 ? (uint64_t)(p * 0x1.0p64) : UINT64_MAX;
+  }
+
+  table->entries = entries;
+  table->n = (uint32_t)n;
+  return 0;
+}
+
+uint32_t cromulent_alias_sample(const cromulent_alias *table,
+                                cromulent_state *state) {
+  return cromulent_alias_pick(table->entries, table->n, cromulent_next(state));
+}
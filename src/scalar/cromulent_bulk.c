@@ -0,0 +1,392 @@
+// src/scalar/cromulent_bulk.c
+//
+// Bulk fill API: a CROMULENT_BULK_LANES-lane generator whose inner loop runs in
+// the kernel chosen by src/cromulent_dispatch.c, plus the buffering that lets
+// callers request any number of words or bytes.
+
+#include "cromulent.h"
+
+#define BLOCK_WORDS CROMULENT_BULK_LANES
+#define BLOCK_BYTES (BLOCK_WORDS * sizeof(uint64_t))
+
+// Blocks generated per kernel call when staging through a local buffer.
+#define CHUNK_BLOCKS 64
+
+void cromulent_bulk_blocks_scalar(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                  size_t nblocks) {
+  cromulent_lanes_fill(s0, s1, BLOCK_WORDS, dst, nblocks);
+}
+
+void cromulent_bulk_doubles_scalar(uint64_t *s0, uint64_t *s1, double *dst,
+                                   size_t nblocks, uint64_t bias) {
+  uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+
+  while (nblocks > 0) {
+    const size_t blocks = nblocks < CHUNK_BLOCKS ? nblocks : CHUNK_BLOCKS;
+    cromulent_lanes_fill(s0, s1, BLOCK_WORDS, chunk, blocks);
+    for (size_t i = 0; i < blocks * BLOCK_WORDS; ++i)
+      dst[i] = cromulent_to_double(chunk[i], bias);
+    dst += blocks * BLOCK_WORDS;
+    nblocks -= blocks;
+  }
+}
+
+void cromulent_bulk_floats_scalar(uint64_t *s0, uint64_t *s1, float *dst,
+                                  size_t nblocks, uint32_t bias) {
+  uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+
+  while (nblocks > 0) {
+    const size_t blocks = nblocks < CHUNK_BLOCKS ? nblocks : CHUNK_BLOCKS;
+    cromulent_lanes_fill(s0, s1, BLOCK_WORDS, chunk, blocks);
+    for (size_t i = 0; i < blocks * BLOCK_WORDS; ++i) {
+      dst[2 * i] = cromulent_to_float((uint32_t)chunk[i], bias);
+      dst[2 * i + 1] = cromulent_to_float((uint32_t)(chunk[i] >> 32), bias);
+    }
+    dst += 2 * blocks * BLOCK_WORDS;
+    nblocks -= blocks;
+  }
+}
+
+size_t cromulent_bulk_range32_scalar(const uint64_t *words, size_t nwords,
+                                     uint32_t n, uint32_t t, uint64_t *dst) {
+  return cromulent_range32_words(words, nwords, n, t, dst);
+}
+
+void cromulent_bulk_alias_scalar(const uint64_t *words, size_t nwords,
+                                 const cromulent_alias_entry *e, uint32_t n,
+                                 uint32_t *dst) {
+  for (size_t i = 0; i < nwords; ++i)
+    dst[i] = cromulent_alias_pick(e, n, words[i]);
+}
+
+static void run_blocks(cromulent_bulk_state *state, uint64_t *dst,
+                       size_t nblocks) {
+  cromulent_kernels_active()->bulk_blocks(state->s0, state->s1, dst, nblocks);
+}
+
+static int little_endian(void) {
+  const uint16_t probe = 1;
+  uint8_t first;
+  memcpy(&first, &probe, 1);
+  return first == 1;
+}
+
+// Copy words as their little-endian byte encoding.
+static void store_le_words(uint8_t *out, const uint64_t *words, size_t n) {
+  if (little_endian()) {
+    memcpy(out, words, n * sizeof(uint64_t));
+    return;
+  }
+  for (size_t i = 0; i < n; ++i)
+    for (int b = 0; b < 8; ++b)
+      *out++ = (uint8_t)(words[i] >> (8 * b));
+}
+
+void cromulent_bulk_init(cromulent_bulk_state *state, uint64_t seed) {
+  uint64_t z = seed;
+
+  for (int i = 0; i < BLOCK_WORDS; ++i)
+    state->s0[i] = cromulent_seed_step(&z);
+  for (int i = 0; i < BLOCK_WORDS; ++i)
+    state->s1[i] = cromulent_seed_step(&z);
+
+  memset(state->block, 0, sizeof state->block);
+  state->pos = BLOCK_BYTES;
+}
+
+void cromulent_fill_u64(cromulent_bulk_state *state, uint64_t *dst, size_t n) {
+  if (n == 0)
+    return;
+
+  // Drain the buffered step, starting at the next whole word.
+  size_t word = (state->pos + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  while (n > 0 && word < BLOCK_WORDS) {
+    *dst++ = state->block[word++];
+    --n;
+  }
+  state->pos = (uint32_t)(word * sizeof(uint64_t));
+
+  const size_t full = n / BLOCK_WORDS;
+  if (full > 0) {
+    run_blocks(state, dst, full);
+    dst += full * BLOCK_WORDS;
+    n -= full * BLOCK_WORDS;
+  }
+
+  if (n > 0) {
+    run_blocks(state, state->block, 1);
+    memcpy(dst, state->block, n * sizeof(uint64_t));
+    state->pos = (uint32_t)(n * sizeof(uint64_t));
+  }
+}
+
+void cromulent_fill_bytes(cromulent_bulk_state *state, void *dst, size_t n) {
+  uint8_t *out = dst;
+
+  if (state->pos < BLOCK_BYTES && n > 0) {
+    uint8_t tail[BLOCK_BYTES];
+    store_le_words(tail, state->block, BLOCK_WORDS);
+    size_t take = BLOCK_BYTES - state->pos;
+    if (take > n)
+      take = n;
+    memcpy(out, tail + state->pos, take);
+    state->pos += (uint32_t)take;
+    out += take;
+    n -= take;
+  }
+
+  if (little_endian() && ((uintptr_t)out % sizeof(uint64_t)) == 0) {
+    const size_t full = n / BLOCK_BYTES;
+    if (full > 0) {
+      run_blocks(state, (uint64_t *)(void *)out, full);
+      out += full * BLOCK_BYTES;
+      n -= full * BLOCK_BYTES;
+    }
+  } else {
+    uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+    while (n >= BLOCK_BYTES) {
+      size_t blocks = n / BLOCK_BYTES;
+      if (blocks > CHUNK_BLOCKS)
+        blocks = CHUNK_BLOCKS;
+      run_blocks(state, chunk, blocks);
+      store_le_words(out, chunk, blocks * BLOCK_WORDS);
+      out += blocks * BLOCK_BYTES;
+      n -= blocks * BLOCK_BYTES;
+    }
+  }
+
+  if (n > 0) {
+    uint8_t tail[BLOCK_BYTES];
+    run_blocks(state, state->block, 1);
+    store_le_words(tail, state->block, BLOCK_WORDS);
+    memcpy(out, tail, n);
+    state->pos = (uint32_t)n;
+  }
+}
+
+// Doubles take whole words, like cromulent_fill_u64.
+static void fill_doubles(cromulent_bulk_state *state, double *dst, size_t n,
+                         uint64_t bias) {
+  if (n == 0)
+    return;
+
+  size_t word = (state->pos + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  while (n > 0 && word < BLOCK_WORDS) {
+    *dst++ = cromulent_to_double(state->block[word++], bias);
+    --n;
+  }
+  state->pos = (uint32_t)(word * sizeof(uint64_t));
+
+  const size_t full = n / BLOCK_WORDS;
+  if (full > 0) {
+    cromulent_kernels_active()->bulk_doubles(state->s0, state->s1, dst, full,
+                                             bias);
+    dst += full * BLOCK_WORDS;
+    n -= full * BLOCK_WORDS;
+  }
+
+  if (n > 0) {
+    run_blocks(state, state->block, 1);
+    for (size_t i = 0; i < n; ++i)
+      dst[i] = cromulent_to_double(state->block[i], bias);
+    state->pos = (uint32_t)(n * sizeof(uint64_t));
+  }
+}
+
+// Floats take 32-bit halves, i.e. four bytes of the fill_bytes stream each.
+#define BLOCK_HALVES (2 * BLOCK_WORDS)
+
+static uint32_t block_half(const cromulent_bulk_state *state, size_t h) {
+  return (uint32_t)(state->block[h / 2] >> (32 * (h % 2)));
+}
+
+static void fill_floats(cromulent_bulk_state *state, float *dst, size_t n,
+                        uint32_t bias) {
+  if (n == 0)
+    return;
+
+  size_t half = (state->pos + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+  while (n > 0 && half < BLOCK_HALVES) {
+    *dst++ = cromulent_to_float(block_half(state, half++), bias);
+    --n;
+  }
+  state->pos = (uint32_t)(half * sizeof(uint32_t));
+
+  const size_t full = n / BLOCK_HALVES;
+  if (full > 0) {
+    cromulent_kernels_active()->bulk_floats(state->s0, state->s1, dst, full,
+                                            bias);
+    dst += full * BLOCK_HALVES;
+    n -= full * BLOCK_HALVES;
+  }
+
+  if (n > 0) {
+    run_blocks(state, state->block, 1);
+    for (size_t i = 0; i < n; ++i)
+      dst[i] = cromulent_to_float(block_half(state, i), bias);
+    state->pos = (uint32_t)(n * sizeof(uint32_t));
+  }
+}
+
+void cromulent_fill_double(cromulent_bulk_state *state, double *dst,
+                           size_t n) {
+  fill_doubles(state, dst, n, 0);
+}
+
+void cromulent_fill_double_oc(cromulent_bulk_state *state, double *dst,
+                              size_t n) {
+  fill_doubles(state, dst, n, 1);
+}
+
+void cromulent_fill_float(cromulent_bulk_state *state, float *dst, size_t n) {
+  fill_floats(state, dst, n, 0);
+}
+
+void cromulent_fill_float_oc(cromulent_bulk_state *state, float *dst,
+                             size_t n) {
+  fill_floats(state, dst, n, 1);
+}
+
+// Bounded integers use Lemire's multiply-shift with the rejection threshold
+// computed once per call. A block of the stream yields at most one value per
+// draw, so whole blocks can go straight to the kernels while count allows and
+// the tail is served from the buffered block.
+
+// Bounds below 2^32 take 32-bit halves, like floats.
+static void fill_range32(cromulent_bulk_state *state, uint32_t n,
+                         uint64_t *dst, size_t count) {
+  const uint32_t t = (uint32_t)(0u - n) % n;
+  uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+
+  for (;;) {
+    size_t half = (state->pos + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    while (count > 0 && half < BLOCK_HALVES) {
+      const uint64_t m = (uint64_t)block_half(state, half++) * n;
+      if ((uint32_t)m >= t) {
+        *dst++ = m >> 32;
+        --count;
+      }
+    }
+    state->pos = (uint32_t)(half * sizeof(uint32_t));
+    if (count == 0)
+      return;
+
+    size_t blocks = count / BLOCK_HALVES;
+    if (blocks > 0) {
+      if (blocks > CHUNK_BLOCKS)
+        blocks = CHUNK_BLOCKS;
+      run_blocks(state, chunk, blocks);
+      const size_t kept = cromulent_kernels_active()->bulk_range32(
+          chunk, blocks * BLOCK_WORDS, n, t, dst);
+      dst += kept;
+      count -= kept;
+    } else {
+      run_blocks(state, state->block, 1);
+      state->pos = 0;
+    }
+  }
+}
+
+// Larger bounds take whole words, like fill_u64. No SIMD unit has a 64-bit
+// high multiply, so this path stays scalar. Near n = 2^63 half of all draws
+// are rejected, so the loop stores every draw and advances conditionally
+// instead of branching; dst needs room for nwords values.
+static size_t range64_words(const uint64_t *words, size_t nwords, uint64_t n,
+                            uint64_t t, uint64_t *dst) {
+  uint64_t *out = dst;
+
+  for (size_t i = 0; i < nwords; ++i) {
+    uint64_t hi, lo;
+    cromulent_mul_u64(words[i], n, &hi, &lo);
+    *out = hi;
+    out += lo >= t;
+  }
+  return (size_t)(out - dst);
+}
+
+static void fill_range64(cromulent_bulk_state *state, uint64_t n,
+                         uint64_t *dst, size_t count) {
+  const uint64_t t = (0 - n) % n;
+  uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+
+  for (;;) {
+    size_t word = (state->pos + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    while (count > 0 && word < BLOCK_WORDS) {
+      uint64_t hi, lo;
+      cromulent_mul_u64(state->block[word++], n, &hi, &lo);
+      if (lo >= t) {
+        *dst++ = hi;
+        --count;
+      }
+    }
+    state->pos = (uint32_t)(word * sizeof(uint64_t));
+    if (count == 0)
+      return;
+
+    size_t blocks = count / BLOCK_WORDS;
+    if (blocks > 0) {
+      if (blocks > CHUNK_BLOCKS)
+        blocks = CHUNK_BLOCKS;
+      run_blocks(state, chunk, blocks);
+      const size_t kept =
+          range64_words(chunk, blocks * BLOCK_WORDS, n, t, dst);
+      dst += kept;
+      count -= kept;
+    } else {
+      run_blocks(state, state->block, 1);
+      state->pos = 0;
+    }
+  }
+}
+
+void cromulent_fill_range(cromulent_bulk_state *state, uint64_t n,
+                          uint64_t *dst, size_t count) {
+  if (count == 0)
+    return;
+  if (n == 0) {
+    memset(dst, 0, count * sizeof(uint64_t));
+    return;
+  }
+
+  if (n <= UINT32_MAX)
+    fill_range32(state, (uint32_t)n, dst, count);
+  else
+    fill_range64(state, n, dst, count);
+}
+
+// Alias samples take whole words, one each, like fill_u64; whole blocks are
+// staged and run through the kernel.
+void cromulent_alias_fill(const cromulent_alias *table,
+                          cromulent_bulk_state *state, uint32_t *dst,
+                          size_t count) {
+  if (count == 0)
+    return;
+
+  const cromulent_alias_entry *e = table->entries;
+  const uint32_t n = table->n;
+  size_t word = (state->pos + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  while (count > 0 && word < BLOCK_WORDS) {
+    *dst++ = cromulent_alias_pick(e, n, state->block[word++]);
+    --count;
+  }
+  state->pos = (uint32_t)(word * sizeof(uint64_t));
+
+  uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+  while (count >= BLOCK_WORDS) {
+    size_t blocks = count / BLOCK_WORDS;
+    if (blocks > CHUNK_BLOCKS)
+      blocks = CHUNK_BLOCKS;
+    run_blocks(state, chunk, blocks);
+    cromulent_kernels_active()->bulk_alias(chunk, blocks * BLOCK_WORDS, e, n,
+                                           dst);
+    dst += blocks * BLOCK_WORDS;
+    count -= blocks * BLOCK_WORDS;
+  }
+
+  if (count > 0) {
+    run_blocks(state, state->block, 1);
+    for (size_t i = 0; i < count; ++i)
+      dst[i] = cromulent_alias_pick(e, n, state->block[i]);
+    state->pos = (uint32_t)(count * sizeof(uint64_t));
+  }
+}
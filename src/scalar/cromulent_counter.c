@@ -0,0 +1,44 @@
+// src/scalar/cromulent_counter.c
+
+#include "cromulent_inline.h"
+
+uint64_t cromulent_at(uint64_t key, uint64_t counter) {
+  return cromulent_at_inline(key, counter);
+}
+
+// Every word is independent of the others, so the out-of-order core overlaps
+// consecutive words without any help; the SIMD kernels do the same per lane.
+void cromulent_counter_words_scalar(uint64_t k0, uint64_t k1, uint64_t start,
+                                    uint64_t *dst, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    dst[i] = cromulent_at_word(k0, k1, start + i);
+}
+
+void cromulent_at_range(uint64_t key, uint64_t start, uint64_t *dst,
+                        size_t n) {
+  uint64_t k0, k1;
+  cromulent_at_key(key, &k0, &k1);
+  cromulent_kernels_active()->counter_words(k0, k1, start, dst, n);
+}
+
+void cromulent_at_init(cromulent_at_state *state, uint64_t key) {
+  cromulent_at_key(key, &state->k0, &state->k1);
+  state->counter = 0;
+}
+
+uint64_t cromulent_at_next(cromulent_at_state *state) {
+  return cromulent_at_word(state->k0, state->k1, state->counter++);
+}
+
+void cromulent_at_fill(cromulent_at_state *state, uint64_t *dst, size_t n) {
+  cromulent_kernels_active()->counter_words(state->k0, state->k1,
+                                            state->counter, dst, n);
+  state->counter += n;
+}
+
+// Process-global instance behind the v1 registry entry
+static cromulent_at_state global_at;
+
+void init_cromulent_at(uint64_t seed) { cromulent_at_init(&global_at, seed); }
+
+uint64_t cromulent_atpp(void) { return cromulent_at_next(&global_at); }
@@ -1,6 +1,6 @@
 // src/scalar/cromulent_scalar.c
 
-#include "cromulent.h"
+#include "cromulent_inline.h"
 
 static void store_le64(uint8_t *out, uint64_t x) {
   for (int i = 0; i < 8; i++) {
@@ -32,22 +32,38 @@ void cromulent_init(cromulent_state *state, const uint64_t seed) {
 }
 
 uint64_t cromulent_next(cromulent_state *state) {
-  const uint64_t s0 = state->s0;
-  const uint64_t s1 = state->s1;
-
-  state->s0 = s0 * C6 + s1;
-  state->s1 = rotl(s1, 31) + mix_fast(s0);
+  return cromulent_next_inline(state);
+}
 
-  uint64_t result = s0 + rotl(s1, 11);
-  result ^= result >> 27;
-  result *= C3;
-  result ^= result >> 27;
+void cromulent_split(const cromulent_state *parent, uint64_t stream,
+                     cromulent_state *child) {
+  // stream * C1 + C2 and mix() are bijections, so distinct stream ids give
+  // distinct keys and therefore distinct child states.
+  const uint64_t k0 = mix(stream * C1 + C2);
+  const uint64_t k1 = mix(k0 ^ C5);
+  const uint64_t s0 = mix(parent->s0 ^ k0);
+  const uint64_t s1 = mix(parent->s1 ^ k1);
+
+  child->s0 = s0;
+  // All-zero is a fixed point of the transition.
+  child->s1 = (s0 | s1) ? s1 : C1;
+}
 
-  return result;
+uint64_t cromulent_split_seed(uint64_t seed, uint64_t stream) {
+  if (stream == 0)
+    return seed;
+  cromulent_state root, child;
+  cromulent_init(&root, seed);
+  cromulent_split(&root, stream, &child);
+  return cromulent_next(&child);
 }
 
-static uint64_t t[2];
+// Process-global instance behind the v1 registry entry. It keeps its original
+// seed expansion, which differs from cromulent_init.
+static cromulent_state global_state;
+
 void init_cromulent(uint64_t seed) {
+  uint64_t t[2];
   t[0] = seed;
   t[0] = (t[0] ^ (t[0] >> 30)) * C2;
   t[0] = (t[0] ^ (t[0] >> 27)) * C3;
@@ -60,76 +76,24 @@ void init_cromulent(uint64_t seed) {
   t[1] = (t[1] ^ (t[1] >> 27)) * C3;
 
   t[1] = (t[1] ^ (t[1] >> 31));
-}
-
-uint64_t cromulent128pp(void) {
-  uint64_t a = t[0];
-  uint64_t b = t[1];
-  t[0] = a * C6 + b;
-  t[1] = rotl(b, 31) + mix_fast(a);
 
-  uint64_t result = a + rotl(b, 11);
-  result ^= result >> 27;
-  result *= C3;
-  result ^= result >> 27;
-
-  return result;
+  global_state.s0 = t[0];
+  global_state.s1 = t[1];
 }
 
+uint64_t cromulent128pp(void) { return cromulent_next(&global_state); }
+
 double cromulent_double(cromulent_state *state) {
-  // Generate uniform double in [0, 1)
-  return (cromulent_next(state) >> 11) * 0x1.0p-53;
+  return cromulent_double_inline(state);
 }
 
 float cromulent_float(cromulent_state *state) {
-  // Generate uniform float in [0, 1)
-  return (cromulent_next(state) >> 40) * 0x1.0p-24f;
+  return cromulent_float_inline(state);
 }
 
-#ifdef __SIZEOF_INT128__
 uint64_t cromulent_range(cromulent_state *state, uint64_t n) {
-  // Generate a uniform random number in [0, n). Returns 0 when n is 0.
-  if (n == 0)
-    return 0;
-  uint64_t x = cromulent_next(state);
-  __uint128_t m = (__uint128_t)x * n;
-  uint64_t l = (uint64_t)m;
-
-  if (l < n) {
-    uint64_t t = (-n) % n;
-    while (l < t) {
-      x = cromulent_next(state);
-      m = (__uint128_t)x * n;
-      l = (uint64_t)m;
-    }
-  }
-
-  return m >> 64;
-}
-#else
-static void mul_u64(uint64_t a, uint64_t b, uint64_t *hi, uint64_t *lo) {
-  cromulent_mul_u64_fallback(a, b, hi, lo);
-}
-
-uint64_t cromulent_range(cromulent_state *state, uint64_t n) {
-  // Generate a uniform random number in [0, n). Returns 0 when n is 0.
-  if (n == 0)
-    return 0;
-  uint64_t x = cromulent_next(state);
-  uint64_t hi, lo;
-  mul_u64(x, n, &hi, &lo);
-
-  if (lo < n) {
-    uint64_t t = (-n) % n;
-    while (lo < t) {
-      x = cromulent_next(state);
-      mul_u64(x, n, &hi, &lo);
-    }
-  }
-
-  return hi;
+  return cromulent_range_inline(state, n);
 }
-#endif
 
 void cromulent_save(const cromulent_state *state, uint8_t *buffer) {
   store_le64(buffer, state->s0);
@@ -0,0 +1,365 @@
+// src/scalar/cromulent_shuffle.c
+//
+// Fisher-Yates shuffles and sampling without replacement. The in-place
+// shuffle draws its swap partners two per 64-bit word where the bounds allow
+// (Brackett-Rozinsky & Lemire's batched ranged integers) and prefetches a
+// batch of partners before swapping, so arrays beyond the caches overlap their
+// misses. cromulent_shuffle_large is a Rao-Sandelius shuffle for arrays much
+// bigger than the last-level cache: a scatter into cache-sized buckets and an
+// independent Fisher-Yates per bucket, both split across threads.
+
+#include "cromulent.h"
+#include <math.h>
+
+#if defined(CROMULENT_HAVE_PTHREADS)
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+// Swap partners drawn and prefetched ahead of the swaps.
+#define BATCH 64
+
+// Two bounded draws from one word need r1 * r2 to fit in 64 bits.
+#define PAIR_LIMIT (1ULL << 32)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(p) __builtin_prefetch(p, 1)
+#else
+#define PREFETCH(p) ((void)(p))
+#endif
+
+// Unbiased j1 in [0, r1) and j2 in [0, r2) from one word where possible: w * r1
+// gives j1 and a leftover, the leftover times r2 gives j2, and the draw is
+// rejected only if the final leftover falls below 2^64 mod (r1 * r2).
+static void bounded_pair(cromulent_state *state, uint64_t r1, uint64_t r2,
+                         uint64_t *j1, uint64_t *j2) {
+  const uint64_t bound = r1 * r2;
+  uint64_t lo;
+
+  cromulent_mul_u64(cromulent_next(state), r1, j1, &lo);
+  cromulent_mul_u64(lo, r2, j2, &lo);
+  if (lo < bound) {
+    const uint64_t t = (0 - bound) % bound;
+    while (lo < t) {
+      cromulent_mul_u64(cromulent_next(state), r1, j1, &lo);
+      cromulent_mul_u64(lo, r2, j2, &lo);
+    }
+  }
+}
+
+static inline void swap_elems(unsigned char *x, unsigned char *y,
+                              size_t size) {
+  if (size == 8) {
+    uint64_t a, b;
+    memcpy(&a, x, 8);
+    memcpy(&b, y, 8);
+    memcpy(x, &b, 8);
+    memcpy(y, &a, 8);
+    return;
+  }
+  if (size == 4) {
+    uint32_t a, b;
+    memcpy(&a, x, 4);
+    memcpy(&b, y, 4);
+    memcpy(x, &b, 4);
+    memcpy(y, &a, 4);
+    return;
+  }
+  if (x == y)
+    return;
+
+  unsigned char tmp[64];
+  while (size > 0) {
+    const size_t part = size < sizeof tmp ? size : sizeof tmp;
+    memcpy(tmp, x, part);
+    memcpy(x, y, part);
+    memcpy(y, tmp, part);
+    x += part;
+    y += part;
+    size -= part;
+  }
+}
+
+// Position i - 1 swaps with a uniform partner in [0, i), for i = n down to 2.
+// Inlined with a constant size for the common element widths.
+static inline void fisher_yates(cromulent_state *state, unsigned char *a,
+                                uint64_t n, size_t size) {
+  uint64_t j[BATCH];
+  uint64_t i = n;
+
+  while (i > 1) {
+    const uint64_t top = i;
+    size_t m = 0;
+    while (m + 2 <= BATCH && i > 1) {
+      if (i <= PAIR_LIMIT) {
+        bounded_pair(state, i, i - 1, &j[m], &j[m + 1]);
+        m += 2;
+        i -= 2;
+      } else {
+        j[m++] = cromulent_range(state, i);
+        i -= 1;
+      }
+    }
+
+    for (size_t k = 0; k < m; ++k)
+      PREFETCH(a + j[k] * size);
+    for (size_t k = 0; k < m; ++k)
+      swap_elems(a + (top - 1 - k) * size, a + j[k] * size, size);
+  }
+}
+
+void cromulent_shuffle(cromulent_state *state, void *base, size_t n,
+                       size_t size) {
+  if (size == 8)
+    fisher_yates(state, base, n, 8);
+  else if (size == 4)
+    fisher_yates(state, base, n, 4);
+  else
+    fisher_yates(state, base, n, size);
+}
+
+// Uniform in (0, 1), never 0 or 1, so both logs below are finite.
+static double open_unit(cromulent_state *state) {
+  return ((double)(cromulent_next(state) >> 11) + 0.5) * 0x1.0p-53;
+}
+
+// Li's Algorithm L: reservoir sampling of [0, n) that skips ahead by a
+// geometric number of indices between replacements, so the work is
+// O(k (1 + log(n / k))) rather than O(n).
+int cromulent_sample_k(cromulent_state *state, uint64_t n, uint64_t *dst,
+                       size_t k) {
+  if (k > n)
+    return -1;
+  for (size_t i = 0; i < k; ++i)
+    dst[i] = i;
+  if (k == 0 || k == n)
+    return 0;
+
+  double w = exp(log(open_unit(state)) / (double)k);
+  uint64_t i = k - 1;
+  for (;;) {
+    const double skip = floor(log(open_unit(state)) / log1p(-w));
+    if (!(skip < (double)(n - 1 - i)))
+      return 0;
+    i += (uint64_t)skip + 1;
+    dst[cromulent_range(state, k)] = i;
+    w *= exp(log(open_unit(state)) / (double)k);
+  }
+}
+
+// Rao-Sandelius. Every element goes to a uniformly random bucket, buckets are
+// laid out in order in the scratch area, and each is shuffled on its own, which
+// gives a uniform permutation. Bucket draws come from one substream per chunk
+// of the input and the bucket shuffles from one substream per bucket, so the
+// result does not depend on the number of threads.
+
+// Aim for buckets that fit in L2 while the scatter pass keeps few enough
+// output streams open for the TLB and write-combining buffers.
+#define BUCKET_BYTES (256 * 1024)
+#define MAX_BUCKET_BITS 10
+#define CHUNK_ELEMS ((size_t)1 << 20)
+#define BUCKET_STREAM (1ULL << 63)
+#define BUCKET_BATCH 4096
+
+typedef struct {
+  cromulent_state root;
+  unsigned char *base, *scratch;
+  size_t n, size, nchunks;
+  unsigned bits;
+  size_t *offsets; // nchunks x buckets, then buckets + 1 bucket starts
+} large_job;
+
+static unsigned bucket_bits(size_t n, size_t size) {
+  const size_t bytes = n * size;
+  unsigned bits = 0;
+  while (bits < MAX_BUCKET_BITS && ((size_t)BUCKET_BYTES << bits) < bytes)
+    ++bits;
+  return bits;
+}
+
+static size_t *bucket_starts(const large_job *job) {
+  return job->offsets + (job->nchunks << job->bits);
+}
+
+static size_t chunk_end(const large_job *job, size_t c) {
+  const size_t end = (c + 1) * CHUNK_ELEMS;
+  return end < job->n ? end : job->n;
+}
+
+// Bucket ids for count elements from the chunk's substream: the top bits of
+// each word, as many per word as fit. count is a multiple of 64 / bits except
+// at the end of the chunk. The word stays in a local so that the loop does
+// not reload it from the escaped state.
+static void draw_buckets(cromulent_state *state, unsigned bits,
+                         uint16_t *out, size_t count) {
+  const unsigned per_word = 64 / bits;
+
+  for (size_t e = 0; e < count;) {
+    uint64_t w = cromulent_next(state);
+    const size_t stop = count - e < per_word ? count : e + per_word;
+    for (; e < stop; ++e, w <<= bits)
+      out[e] = (uint16_t)(w >> (64 - bits));
+  }
+}
+
+// Elements per draw_buckets call: a whole number of words.
+static size_t bucket_batch(unsigned bits) {
+  const size_t per_word = 64 / bits;
+  return BUCKET_BATCH / per_word * per_word;
+}
+
+static void count_chunk(large_job *job, size_t c) {
+  size_t *counts = job->offsets + (c << job->bits);
+  const size_t batch = bucket_batch(job->bits);
+  uint16_t ids[BUCKET_BATCH];
+  cromulent_state st;
+
+  memset(counts, 0, sizeof(size_t) << job->bits);
+  cromulent_split(&job->root, c, &st);
+  for (size_t e = c * CHUNK_ELEMS, end = chunk_end(job, c); e < end;) {
+    const size_t m = end - e < batch ? end - e : batch;
+    draw_buckets(&st, job->bits, ids, m);
+    for (size_t k = 0; k < m; ++k)
+      counts[ids[k]]++;
+    e += m;
+  }
+}
+
+// Replays the chunk's bucket draws and copies each element to its slot.
+static inline void scatter_elems(large_job *job, size_t c, size_t size) {
+  size_t *next = job->offsets + (c << job->bits);
+  const size_t batch = bucket_batch(job->bits);
+  uint16_t ids[BUCKET_BATCH];
+  cromulent_state st;
+
+  cromulent_split(&job->root, c, &st);
+  for (size_t e = c * CHUNK_ELEMS, end = chunk_end(job, c); e < end;) {
+    const size_t m = end - e < batch ? end - e : batch;
+    draw_buckets(&st, job->bits, ids, m);
+    for (size_t k = 0; k < m; ++k)
+      memcpy(job->scratch + next[ids[k]]++ * size,
+             job->base + (e + k) * size, size);
+    e += m;
+  }
+}
+
+static void scatter_chunk(large_job *job, size_t c) {
+  if (job->size == 8)
+    scatter_elems(job, c, 8);
+  else if (job->size == 4)
+    scatter_elems(job, c, 4);
+  else
+    scatter_elems(job, c, job->size);
+}
+
+static void shuffle_bucket(large_job *job, size_t b) {
+  const size_t *starts = bucket_starts(job);
+  const size_t first = starts[b] * job->size;
+  const size_t bytes = starts[b + 1] * job->size - first;
+  cromulent_state st;
+
+  cromulent_split(&job->root, BUCKET_STREAM | b, &st);
+  cromulent_shuffle(&st, job->scratch + first, starts[b + 1] - starts[b],
+                    job->size);
+  memcpy(job->base + first, job->scratch + first, bytes);
+}
+
+typedef void (*large_task)(large_job *job, size_t task);
+
+#if defined(CROMULENT_HAVE_PTHREADS)
+typedef struct {
+  large_job *job;
+  large_task fn;
+  size_t tasks;
+  atomic_size_t next;
+} task_pool;
+
+static void *pool_worker(void *arg) {
+  task_pool *pool = arg;
+  for (;;) {
+    const size_t t =
+        atomic_fetch_add_explicit(&pool->next, 1, memory_order_relaxed);
+    if (t >= pool->tasks)
+      return NULL;
+    pool->fn(pool->job, t);
+  }
+}
+
+static void run_tasks(large_job *job, large_task fn, size_t tasks,
+                      unsigned threads) {
+  task_pool pool = {job, fn, tasks, 0};
+  pthread_t helpers[63];
+  unsigned started = 0;
+
+  if (threads > tasks)
+    threads = (unsigned)tasks;
+  if (threads > 64)
+    threads = 64;
+  while (started + 1 < threads &&
+         pthread_create(&helpers[started], NULL, pool_worker, &pool) == 0)
+    ++started;
+  pool_worker(&pool);
+  for (unsigned t = 0; t < started; ++t)
+    pthread_join(helpers[t], NULL);
+}
+#else
+static void run_tasks(large_job *job, large_task fn, size_t tasks,
+                      unsigned threads) {
+  (void)threads;
+  for (size_t t = 0; t < tasks; ++t)
+    fn(job, t);
+}
+#endif
+
+static size_t align_up(size_t x) { return (x + 63) & ~(size_t)63; }
+
+size_t cromulent_shuffle_large_workspace(size_t n, size_t size) {
+  const size_t nchunks = (n + CHUNK_ELEMS - 1) / CHUNK_ELEMS;
+  const size_t buckets = (size_t)1 << bucket_bits(n, size);
+  return align_up((nchunks * buckets + buckets + 1) * sizeof(size_t)) +
+         n * size;
+}
+
+void cromulent_shuffle_large(cromulent_state *state, void *base, size_t n,
+                             size_t size, void *workspace, unsigned threads) {
+  large_job job;
+  job.root = *state;
+  job.base = base;
+  job.n = n;
+  job.size = size;
+  job.nchunks = (n + CHUNK_ELEMS - 1) / CHUNK_ELEMS;
+  job.bits = bucket_bits(n, size);
+  job.offsets = workspace;
+  (void)cromulent_next(state);
+
+  const size_t buckets = (size_t)1 << job.bits;
+  size_t *starts = bucket_starts(&job);
+  if (job.bits == 0) {
+    // One bucket: the scatter would be a plain copy, so shuffle in place.
+    cromulent_state st;
+    cromulent_split(&job.root, BUCKET_STREAM, &st);
+    cromulent_shuffle(&st, base, n, size);
+    return;
+  }
+  job.scratch = (unsigned char *)workspace +
+                align_up((job.nchunks * buckets + buckets + 1) *
+                         sizeof(size_t));
+
+  run_tasks(&job, count_chunk, job.nchunks, threads);
+
+  // Counts become scatter offsets: bucket-major, then chunk order.
+  size_t total = 0;
+  for (size_t b = 0; b < buckets; ++b) {
+    starts[b] = total;
+    for (size_t c = 0; c < job.nchunks; ++c) {
+      size_t *slot = &job.offsets[(c << job.bits) + b];
+      const size_t count = *slot;
+      *slot = total;
+      total += count;
+    }
+  }
+  starts[buckets] = total;
+
+  run_tasks(&job, scatter_chunk, job.nchunks, threads);
+  run_tasks(&job, shuffle_bucket, buckets, threads);
+}
@@ -2,25 +2,10 @@
 
 #include "cromulent.h"
 
-uint64_t cromulent_strong_next(cromulent_strong_state *state) {
-  uint64_t a = state->a;
-  uint64_t b = state->b;
-
-  b += rotl(a, 13);
-  a = rotl(a, 29) * C1 + b;
-
-  b = rotl(b, 17) ^ a;
-  a += rotl(b * C2, 31);
-
-  b += rotl(a, 23);
-  a = rotl(a ^ b, 52);
+#define BLOCK_WORDS CROMULENT_BULK_LANES
 
-  const uint64_t output = a + rotl(b, 41);
-
-  state->a = a + C1;
-  state->b = b ^ (a >> 17);
-
-  return mix_fast(output);
+uint64_t cromulent_strong_next(cromulent_strong_state *state) {
+  return cromulent_strong_step(&state->a, &state->b);
 }
 
 void cromulent_strong_init(cromulent_strong_state *st, uint64_t seed) {
@@ -36,3 +21,89 @@ void cromulent_strong_init(cromulent_strong_state *st, uint64_t seed) {
   z = (z ^ (z >> 27)) * C3;
   st->b = z ^ (z >> 31);
 }
+
+void cromulent_strong_fill(cromulent_strong_state *state, uint64_t *dst,
+                           size_t n) {
+  cromulent_strong_state st = *state;
+  for (size_t i = 0; i < n; i++)
+    dst[i] = cromulent_strong_next(&st);
+  *state = st;
+}
+
+// The step is one long dependency chain, so four lanes run side by side in
+// locals for the out-of-order core to overlap.
+void cromulent_strong_blocks_scalar(uint64_t *a, uint64_t *b, uint64_t *dst,
+                                    size_t nblocks) {
+  for (int l = 0; l < BLOCK_WORDS; l += 4) {
+    uint64_t a0 = a[l], a1 = a[l + 1], a2 = a[l + 2], a3 = a[l + 3];
+    uint64_t b0 = b[l], b1 = b[l + 1], b2 = b[l + 2], b3 = b[l + 3];
+    uint64_t *out = dst + l;
+
+    for (size_t i = 0; i < nblocks; ++i, out += BLOCK_WORDS) {
+      out[0] = cromulent_strong_step(&a0, &b0);
+      out[1] = cromulent_strong_step(&a1, &b1);
+      out[2] = cromulent_strong_step(&a2, &b2);
+      out[3] = cromulent_strong_step(&a3, &b3);
+    }
+
+    a[l] = a0;
+    a[l + 1] = a1;
+    a[l + 2] = a2;
+    a[l + 3] = a3;
+    b[l] = b0;
+    b[l + 1] = b1;
+    b[l + 2] = b2;
+    b[l + 3] = b3;
+  }
+}
+
+void cromulent_strong_bulk_init(cromulent_strong_bulk_state *state,
+                                uint64_t seed) {
+  uint64_t z = seed;
+
+  for (int i = 0; i < BLOCK_WORDS; ++i)
+    state->a[i] = cromulent_seed_step(&z);
+  for (int i = 0; i < BLOCK_WORDS; ++i)
+    state->b[i] = cromulent_seed_step(&z);
+
+  memset(state->block, 0, sizeof state->block);
+  state->pos = sizeof state->block;
+}
+
+void cromulent_strong_fill_u64(cromulent_strong_bulk_state *state,
+                               uint64_t *dst, size_t n) {
+  if (n == 0)
+    return;
+
+  const cromulent_kernels *k = cromulent_kernels_active();
+  size_t word = (state->pos + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+  while (n > 0 && word < BLOCK_WORDS) {
+    *dst++ = state->block[word++];
+    --n;
+  }
+  state->pos = (uint32_t)(word * sizeof(uint64_t));
+
+  const size_t full = n / BLOCK_WORDS;
+  if (full > 0) {
+    k->strong_blocks(state->a, state->b, dst, full);
+    dst += full * BLOCK_WORDS;
+    n -= full * BLOCK_WORDS;
+  }
+
+  if (n > 0) {
+    k->strong_blocks(state->a, state->b, state->block, 1);
+    memcpy(dst, state->block, n * sizeof(uint64_t));
+    state->pos = (uint32_t)(n * sizeof(uint64_t));
+  }
+}
+
+// Process-global instance behind the v1 registry entry
+static cromulent_strong_state global_strong;
+
+void init_cromulent_strong(uint64_t seed) {
+  cromulent_strong_init(&global_strong, seed);
+}
+
+uint64_t cromulent_strongpp(void) {
+  return cromulent_strong_next(&global_strong);
+}
@@ -0,0 +1,52 @@
+// src/scalar/cromulent_wide.c
+//
+// Portable N-lane generators. Independent lanes break the serial dependency
+// chain of cromulent_next, so even without SIMD the CPU overlaps several
+// steps; compilers that can vectorize 64-bit multiplies do so as well.
+
+#include "cromulent.h"
+
+static void wide_init(uint64_t *s0, uint64_t *s1, int lanes, uint64_t seed) {
+  uint64_t z = seed;
+
+  for (int i = 0; i < lanes; ++i)
+    s0[i] = cromulent_seed_step(&z);
+  for (int i = 0; i < lanes; ++i)
+    s1[i] = cromulent_seed_step(&z);
+}
+
+void cromulent_x2_init(cromulent_x2_state *state, uint64_t seed) {
+  wide_init(state->s0, state->s1, 2, seed);
+}
+
+void cromulent_x2_next(cromulent_x2_state *state, uint64_t out[2]) {
+  cromulent_lanes_fill(state->s0, state->s1, 2, out, 1);
+}
+
+void cromulent_x2_fill(cromulent_x2_state *state, uint64_t *dst, size_t steps) {
+  cromulent_lanes_fill(state->s0, state->s1, 2, dst, steps);
+}
+
+void cromulent_x4_init(cromulent_x4_state *state, uint64_t seed) {
+  wide_init(state->s0, state->s1, 4, seed);
+}
+
+void cromulent_x4_next(cromulent_x4_state *state, uint64_t out[4]) {
+  cromulent_lanes_fill(state->s0, state->s1, 4, out, 1);
+}
+
+void cromulent_x4_fill(cromulent_x4_state *state, uint64_t *dst, size_t steps) {
+  cromulent_lanes_fill(state->s0, state->s1, 4, dst, steps);
+}
+
+void cromulent_x8_init(cromulent_x8_state *state, uint64_t seed) {
+  wide_init(state->s0, state->s1, 8, seed);
+}
+
+void cromulent_x8_next(cromulent_x8_state *state, uint64_t out[8]) {
+  cromulent_lanes_fill(state->s0, state->s1, 8, out, 1);
+}
+
+void cromulent_x8_fill(cromulent_x8_state *state, uint64_t *dst, size_t steps) {
+  cromulent_lanes_fill(state->s0, state->s1, 8, dst, steps);
+}
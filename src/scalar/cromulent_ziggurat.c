@@ -0,0 +1,167 @@
+// src/scalar/cromulent_ziggurat.c
+//
+// Normal and exponential variates by the 256-layer ziggurat method
+// (Marsaglia & Tsang), for the scalar generator and the bulk stream. Every
+// variate starts from one word; the rare draws that miss the fast path read
+// further words from the same stream, so the words consumed depend only on
+// the stream. The tables are literal constants and this file is built without
+// floating-point contraction, so the results are the same on every platform
+// whose libm agrees on exp() and log() for the slow path.
+
+#include "cromulent.h"
+#include <math.h>
+
+#define BLOCK_WORDS CROMULENT_BULK_LANES
+
+// Blocks generated per kernel call when staging through a local buffer.
+#define CHUNK_BLOCKS 64
+
+// Where the slow path reads its extra words: first the rest of a staged
+// chunk, then the generator itself.
+typedef struct {
+  const uint64_t *p, *end;
+  cromulent_state *state;
+  cromulent_bulk_state *bulk;
+} word_source;
+
+static uint64_t next_word(word_source *src) {
+  if (src->p < src->end)
+    return *src->p++;
+  if (src->state)
+    return cromulent_next(src->state);
+
+  uint64_t w;
+  cromulent_fill_u64(src->bulk, &w, 1);
+  return w;
+}
+
+// Uniform in (0, 1], safe for log()
+static double next_open(word_source *src) {
+  return (double)((next_word(src) >> 11) + 1) * 0x1.0p-53;
+}
+
+// Marsaglia's tail method for the normal beyond r
+static double normal_tail(double r, word_source *src) {
+  for (;;) {
+    const double x = -log(next_open(src)) / r;
+    const double y = -log(next_open(src));
+    if (y + y >= x * x)
+      return r + x;
+  }
+}
+
+// The exponential is memoryless: its tail is r plus another exponential.
+static double exponential_tail(double r, word_source *src) {
+  return r - log(next_open(src));
+}
+
+// The full sampler, starting from word w, which has usually already missed
+// the fast path.
+static double zig_sample(const cromulent_zig_table *t, int symmetric,
+                         uint64_t w, word_source *src) {
+  for (;;) {
+    double x;
+    if (cromulent_zig_fast(t, w, symmetric, &x))
+      return x;
+
+    const unsigned i = (unsigned)(w & 0xff);
+    if (i == 0) {
+      x = symmetric ? normal_tail(t->r, src) : exponential_tail(t->r, src);
+      return symmetric && (w & 0x100) ? -x : x;
+    }
+
+    // Wedge: accept if a uniform height within the layer is under the curve.
+    const double u = (double)(next_word(src) >> 11) * 0x1.0p-53;
+    const double y = t->f[i] + u * (t->f[i + 1] - t->f[i]);
+    const double a = fabs(x);
+    if (y < (symmetric ? exp(-0.5 * a * a) : exp(-a)))
+      return x;
+
+    w = next_word(src);
+  }
+}
+
+static double sample(cromulent_state *state, const cromulent_zig_table *t,
+                     int symmetric) {
+  const uint64_t w = cromulent_next(state);
+  double x;
+  if (cromulent_zig_fast(t, w, symmetric, &x))
+    return x;
+
+  word_source src = {NULL, NULL, state, NULL};
+  return zig_sample(t, symmetric, w, &src);
+}
+
+double cromulent_normal(cromulent_state *state) {
+  return sample(state, &cromulent_zig_normal, 1);
+}
+
+double cromulent_exponential(cromulent_state *state) {
+  return sample(state, &cromulent_zig_exponential, 0);
+}
+
+size_t cromulent_bulk_ziggurat_scalar(const uint64_t *words, size_t nwords,
+                                      const cromulent_zig_table *t,
+                                      int symmetric, double *dst) {
+  for (size_t i = 0; i < nwords; ++i)
+    if (!cromulent_zig_fast(t, words[i], symmetric, &dst[i]))
+      return i;
+  return nwords;
+}
+
+// Whole blocks of words are staged and run through the kernel, which stops at
+// the first word that needs the slow path. That variate is finished here,
+// reading on through the chunk and past it into the stream as needed, and
+// the kernel resumes after the last word consumed. Each variate takes at
+// least one word, so dst always has room for the kernel's output.
+static void fill_ziggurat(cromulent_bulk_state *state,
+                          const cromulent_zig_table *t, int symmetric,
+                          double *dst, size_t n) {
+  uint64_t chunk[CHUNK_BLOCKS * BLOCK_WORDS];
+  word_source src = {NULL, NULL, NULL, state};
+
+  while (n > 0) {
+    const size_t buffered_word =
+        (state->pos + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    if (buffered_word < BLOCK_WORDS || n < BLOCK_WORDS) {
+      src.p = src.end = NULL;
+      *dst++ = zig_sample(t, symmetric, next_word(&src), &src);
+      --n;
+      continue;
+    }
+
+    size_t blocks = n / BLOCK_WORDS;
+    if (blocks > CHUNK_BLOCKS)
+      blocks = CHUNK_BLOCKS;
+    const cromulent_kernels *k = cromulent_kernels_active();
+    k->bulk_blocks(state->s0, state->s1, chunk, blocks);
+
+    const size_t nwords = blocks * BLOCK_WORDS;
+    size_t j = 0;
+    while (j < nwords) {
+      const size_t fast =
+          k->bulk_ziggurat(chunk + j, nwords - j, t, symmetric, dst);
+      dst += fast;
+      n -= fast;
+      j += fast;
+      if (j == nwords)
+        break;
+
+      src.p = chunk + j + 1;
+      src.end = chunk + nwords;
+      *dst++ = zig_sample(t, symmetric, chunk[j], &src);
+      --n;
+      j = (size_t)(src.p - chunk);
+    }
+  }
+}
+
+void cromulent_fill_normal(cromulent_bulk_state *state, double *dst,
+                           size_t n) {
+  fill_ziggurat(state, &cromulent_zig_normal, 1, dst, n);
+}
+
+void cromulent_fill_exponential(cromulent_bulk_state *state, double *dst,
+                                size_t n) {
+  fill_ziggurat(state, &cromulent_zig_exponential, 0, dst, n);
+}
@@ -0,0 +1,669 @@
+// src/scalar/cromulent_ziggurat_tables.c
+//
+// Generated by src/scalar/gen_ziggurat_tables.py; do not edit.
+
+#include "cromulent.h"
+
+// exp(-x^2 / 2), tail from r = 3.6541528853610092
+const cromulent_zig_table cromulent_zig_normal = {
+    {
+        0x001de67b004bdecbULL, 0x001e34b496663894ULL, 0x001ecd8befe06059ULL, 0x001f13f491483bf9ULL,
+        0x001f3d2e3c028b2fULL, 0x001f5880b05450e8ULL, 0x001f6c0d8800a867ULL, 0x001f7acb03817075ULL,
+        0x001f86565e3c45daULL, 0x001f8fa4dd9a5a46ULL, 0x001f9751b0bc2364ULL, 0x001f9dc408ec3f3eULL,
+        0x001fa3434f698f5aULL, 0x001fa80293c5e025ULL, 0x001fac275b7aca18ULL, 0x001fafcdde919e09ULL,
+        0x001fb30bc36574eaULL, 0x001fb5f1f05c0506ULL, 0x001fb88dca537e26ULL, 0x001fbaea138c77faULL,
+        0x001fbd0f8afdfd55ULL, 0x001fbf056056e354ULL, 0x001fc0d189dccf5fULL, 0x001fc27904f10628ULL,
+        0x001fc4000732aaaeULL, 0x001fc56a245fc9faULL, 0x001fc6ba6bdd6338ULL, 0x001fc7f37ffa3c6fULL,
+        0x001fc917a86de8b0ULL, 0x001fca28e12ee501ULL, 0x001fcb28e671ee85ULL, 0x001fcc193e7060fdULL,
+        0x001fccfb416d57b2ULL, 0x001fcdd020554403ULL, 0x001fce98ea3ed54aULL, 0x001fcf569104677fULL,
+        0x001fd009ed215281ULL, 0x001fd0b3c0f563d6ULL, 0x001fd154bb89d1ccULL, 0x001fd1ed7aed8badULL,
+        0x001fd27e8e3a8e52ULL, 0x001fd30877528f47ULL, 0x001fd38bac5eac75ULL, 0x001fd408991bb3edULL,
+        0x001fd47f9ffae7cbULL, 0x001fd4f11b1dc64dULL, 0x001fd55d5d3244afULL, 0x001fd5c4b23405d2ULL,
+        0x001fd62760165a96ULL, 0x001fd685a75a3f3cULL, 0x001fd6dfc3930a85ULL, 0x001fd735ebdc19b8ULL,
+        0x001fd78853416d24ULL, 0x001fd7d7291cdfa2ULL, 0x001fd8229969666bULL, 0x001fd86acd0d92c4ULL,
+        0x001fd8afea1e63feULL, 0x001fd8f2141b52f1ULL, 0x001fd9316c246182ULL, 0x001fd96e112add69ULL,
+        0x001fd9a8201d6f71ULL, 0x001fd9dfb40ffc68ULL, 0x001fda14e65fcc87ULL, 0x001fda47ced45fafULL,
+        0x001fda7883bd4845ULL, 0x001fdaa71a0d5c00ULL, 0x001fdad3a5738056ULL, 0x001fdafe3871506dULL,
+        0x001fdb26e46fd31aULL, 0x001fdb4db9d27193ULL, 0x001fdb72c80859e8ULL, 0x001fdb961d9c73a7ULL,
+        0x001fdbb7c84408fcULL, 0x001fdbd7d4ec42d9ULL, 0x001fdbf64fc69398ULL, 0x001fdc134454288eULL,
+        0x001fdc2ebd7078b5ULL, 0x001fdc48c55b040bULL, 0x001fdc6165c055afULL, 0x001fdc78a7c258a0ULL,
+        0x001fdc8e94000d9eULL, 0x001fdca3329caf6dULL, 0x001fdcb68b465112ULL, 0x001fdcc8a53c00feULL,
+        0x001fdcd987537abdULL, 0x001fdce937fe6fffULL, 0x001fdcf7bd4f7111ULL, 0x001fdd051cfe7bfaULL,
+        0x001fdd115c6d38f4ULL, 0x001fdd1c80aaea2bULL, 0x001fdd268e781472ULL, 0x001fdd2f8a49e5c7ULL,
+        0x001fdd37784d5e5eULL, 0x001fdd3e5c6a404aULL, 0x001fdd443a45c9b4ULL, 0x001fdd4915453d06ULL,
+        0x001fdd4cf0903a4aULL, 0x001fdd4fcf12eca8ULL, 0x001fdd51b3800ebdULL, 0x001fdd52a052c81fULL,
+        0x001fdd5297d06678ULL, 0x001fdd519c09f416ULL, 0x001fdd4faeddadf4ULL, 0x001fdd4cd1f85ae3ULL,
+        0x001fdd4906d68557ULL, 0x001fdd444ec5995eULL, 0x001fdd3eaae4e7e7ULL, 0x001fdd381c2690b6ULL,
+        0x001fdd30a35053d7ULL, 0x001fdd2840fc4bb5ULL, 0x001fdd1ef59990a4ULL, 0x001fdd14c16cc687ULL,
+        0x001fdd09a4909567ULL, 0x001fdcfd9ef60d73ULL, 0x001fdcf0b064f704ULL, 0x001fdce2d87c0ef5ULL,
+        0x001fdcd416b12fe2ULL, 0x001fdcc46a51685cULL, 0x001fdcb3d280fe83ULL, 0x001fdca24e3b610dULL,
+        0x001fdc8fdc5305e8ULL, 0x001fdc7c7b71367aULL, 0x001fdc682a15c978ULL, 0x001fdc52e696ca49ULL,
+        0x001fdc3caf200dc0ULL, 0x001fdc2581b2b40dULL, 0x001fdc0d5c24978bULL, 0x001fdbf43c1fa828ULL,
+        0x001fdbda1f2132ffULL, 0x001fdbbf027915a6ULL, 0x001fdba2e348dca6ULL, 0x001fdb85be82cca6ULL,
+        0x001fdb6790e8d567ULL, 0x001fdb48570b6e0aULL, 0x001fdb280d485992ULL, 0x001fdb06afc95304ULL,
+        0x001fdae43a829fcfULL, 0x001fdac0a93187baULL, 0x001fda9bf75ab0ddULL, 0x001fda7620485e9aULL,
+        0x001fda4f1f089206ULL, 0x001fda26ee6b0a51ULL, 0x001fd9fd88ff236fULL, 0x001fd9d2e9119167ULL,
+        0x001fd9a708a9f62cULL, 0x001fd979e1884ffeULL, 0x001fd94b6d223e23ULL, 0x001fd91ba4a01968ULL,
+        0x001fd8ea80d9dde9ULL, 0x001fd8b7fa53e32dULL, 0x001fd884093b5fa7ULL, 0x001fd84ea562b429ULL,
+        0x001fd817c63d7bd1ULL, 0x001fd7df62dc5c7dULL, 0x001fd7a571e8939fULL, 0x001fd769e99f3af9ULL,
+        0x001fd72cbfcc4027ULL, 0x001fd6ede9c509f3ULL, 0x001fd6ad5c62c56aULL, 0x001fd66b0bfc5495ULL,
+        0x001fd626ec5fd825ULL, 0x001fd5e0f0cbcc79ULL, 0x001fd5990be7b240ULL, 0x001fd54f2fbc39e0ULL,
+        0x001fd5034daae834ULL, 0x001fd4b556652a5aULL, 0x001fd46539e2cd49ULL, 0x001fd412e757ccf7ULL,
+        0x001fd3be4d296dabULL, 0x001fd36758e290ccULL, 0x001fd30df7273543ULL, 0x001fd2b213a711d6ULL,
+        0x001fd253990f3639ULL, 0x001fd1f270fa9dedULL, 0x001fd18e83e19d79ULL, 0x001fd127b90810caULL,
+        0x001fd0bdf66a2e77ULL, 0x001fd05120a7e119ULL, 0x001fcfe11aee8485ULL, 0x001fcf6dc6e0e145ULL,
+        0x001fcef7047d3c73ULL, 0x001fce7cb2014e05ULL, 0x001fcdfeabcbe9e4ULL, 0x001fcd7ccc3c2357ULL,
+        0x001fccf6eb8daaf1ULL, 0x001fcc6cdfb220f0ULL, 0x001fcbde7c270d14ULL, 0x001fcb4b91c82425ULL,
+        0x001fcab3ee9d78efULL, 0x001fca175da52a4aULL, 0x001fc975a69812baULL, 0x001fc8ce8da8ee6aULL,
+        0x001fc821d33d5afeULL, 0x001fc76f33a00056ULL, 0x001fc6b666ab1a95ULL, 0x001fc5f71f6a830dULL,
+        0x001fc5310bb43725ULL, 0x001fc463d3b63954ULL, 0x001fc38f19787f33ULL, 0x001fc2b278517099ULL,
+        0x001fc1cd844b44b3ULL, 0x001fc0dfc97849e3ULL, 0x001fbfe8cb33da7dULL, 0x001fbee8034d685eULL,
+        0x001fbddce11aa29eULL, 0x001fbcc6c86d3ec8ULL, 0x001fbba510685f20ULL, 0x001fba770230e53bULL,
+        0x001fb93bd77334fbULL, 0x001fb7f2b8b7f9a3ULL, 0x001fb69abb805c40ULL, 0x001fb532e020bd18ULL,
+        0x001fb3ba0f4f5ba6ULL, 0x001fb22f175a5919ULL, 0x001fb090a8f611d2ULL, 0x001faedd5391d064ULL,
+        0x001fad13811d33dbULL, 0x001fab3171241ea7ULL, 0x001fa935332168f3ULL, 0x001fa71c9fe1923eULL,
+        0x001fa4e551c5e8a2ULL, 0x001fa28c9bad89ccULL, 0x001fa00f7e3b9263ULL, 0x001f9d6a9b1fd933ULL,
+        0x001f9a9a25f0738bULL, 0x001f9799d2044636ULL, 0x001f9464bc97bd0bULL, 0x001f90f552512d4aULL,
+        0x001f8d452ef5dc62ULL, 0x001f894cf5c4b7a5ULL, 0x001f8504206f4492ULL, 0x001f8060c1fed8b0ULL,
+        0x001f7b573a0817deULL, 0x001f75d9d343ca1aULL, 0x001f6fd846cdfcf2ULL, 0x001f693f1aa6e98eULL,
+        0x001f61f6ce31721fULL, 0x001f59e2c1a6a9baULL, 0x001f50dfbcb697f6ULL, 0x001f46c1eb03f4e8ULL,
+        0x001f3b520fb7ea15ULL, 0x001f2e498e9ba1b7ULL, 0x001f1f4caf064bc2ULL, 0x001f0de218c6afadULL,
+        0x001ef965d850893eULL, 0x001ee0f4eaa72d51ULL, 0x001ec34bc8374737ULL, 0x001e9e8d2ac24ac4ULL,
+        0x001e6fdac3ff963fULL, 0x001e328e15f4896dULL, 0x001dde9702fd9593ULL, 0x001d64abd3a7ef2aULL,
+        0x001ca3ecfd83de22ULL, 0x001b46a9f57b0321ULL, 0x0018117d31f78f07ULL, 0x0000000000000000ULL,
+    },
+    {
+        0x1.f493b7815d984p-52, 0x1.d3bb48209ad34p-52,
+        0x1.b981f3878fdb1p-52, 0x1.a8fdc7894775ap-52,
+        0x1.9cbee014057acp-52, 0x1.92ee0946f4497p-52,
+        0x1.8ab0fbfaa7c15p-52, 0x1.839030529f234p-52,
+        0x1.7d42df4d6ce8cp-52, 0x1.7799556090673p-52,
+        0x1.72728f05f7a34p-52, 0x1.6db6b8d09e232p-52,
+        0x1.69540be9fe5c3p-52, 0x1.653ce7b006aebp-52,
+        0x1.61669cf861e4dp-52, 0x1.5dc8a243ad100p-52,
+        0x1.5a5c08b718ddcp-52, 0x1.571b1a94ae41ep-52,
+        0x1.54011523a7e45p-52, 0x1.5109f53e9ac44p-52,
+        0x1.4e3250dcd8905p-52, 0x1.4b7739d6b5a2ap-52,
+        0x1.48d62759c43bep-52, 0x1.464ce44a73a17p-52,
+        0x1.43d9815545e95p-52, 0x1.417a49cb9e5dbp-52,
+        0x1.3f2dbaa60f475p-52, 0x1.3cf27b31704a6p-52,
+        0x1.3ac7570ae88fap-52, 0x1.38ab39256410ap-52,
+        0x1.369d27a33a840p-52, 0x1.349c405ae12a3p-52,
+        0x1.32a7b5e68a4a3p-52, 0x1.30becd256aeeep-52,
+        0x1.2ee0db1a978f5p-52, 0x1.2d0d43196db97p-52,
+        0x1.2b437532a0a52p-52, 0x1.2982ecd770e78p-52,
+        0x1.27cb2faa8592ep-52, 0x1.261bcc77658e0p-52,
+        0x1.24745a4ac9c24p-52, 0x1.22d477a6fd3efp-52,
+        0x1.213bc9d04cc82p-52, 0x1.1fa9fc2e2d901p-52,
+        0x1.1e1ebfbe4ae39p-52, 0x1.1c99ca971a694p-52,
+        0x1.1b1ad777f2f8ep-52, 0x1.19a1a564eebacp-52,
+        0x1.182df74d21261p-52, 0x1.16bf93b9deef3p-52,
+        0x1.1556448602e3bp-52, 0x1.13f1d69c4096dp-52,
+        0x1.129219bbb5d35p-52, 0x1.1136e04207041p-52,
+        0x1.0fdffefa69fb6p-52, 0x1.0e8d4cf116593p-52,
+        0x1.0d3ea34aa3d30p-52, 0x1.0bf3dd1eed448p-52,
+        0x1.0aacd7571c0c4p-52, 0x1.0969708e8a254p-52,
+        0x1.082988f632e17p-52, 0x1.06ed023a72668p-52,
+        0x1.05b3bf6adb37ep-52, 0x1.047da4e3ef5c7p-52,
+        0x1.034a983a902abp-52, 0x1.021a8028fc947p-52,
+        0x1.00ed447d3a075p-52, 0x1.ff859c118f60bp-53,
+        0x1.fd360d22fe785p-53, 0x1.faebb187122bfp-53,
+        0x1.f8a6604899782p-53, 0x1.f665f20c90168p-53,
+        0x1.f42a40fb74d6dp-53, 0x1.f1f328ac25321p-53,
+        0x1.efc086101eca9p-53, 0x1.ed9237610a73ap-53,
+        0x1.eb681c0f76f08p-53, 0x1.e94214b2abf0ap-53,
+        0x1.e72002f97fe25p-53, 0x1.e501c99c1d188p-53,
+        0x1.e2e74c4ea46f6p-53, 0x1.e0d06fb49d21cp-53,
+        0x1.debd195522e37p-53, 0x1.dcad2f8fc490fp-53,
+        0x1.daa0999206e71p-53, 0x1.d8973f4d7fba7p-53,
+        0x1.d691096e7f125p-53, 0x1.d48de1533c64ap-53,
+        0x1.d28db1037ef23p-53, 0x1.d0906328b8f71p-53,
+        0x1.ce95e3068e03ap-53, 0x1.cc9e1c73bd692p-53,
+        0x1.caa8fbd36a2adp-53, 0x1.c8b66e0eba619p-53,
+        0x1.c6c6608ec8708p-53, 0x1.c4d8c136e0d1fp-53,
+        0x1.c2ed7e5f07a2fp-53, 0x1.c10486cec16a2p-53,
+        0x1.bf1dc9b81ae84p-53, 0x1.bd3936b2ec0a4p-53,
+        0x1.bb56bdb852570p-53, 0x1.b9764f1e5f73fp-53,
+        0x1.b797db93f892bp-53, 0x1.b5bb541ce3d07p-53,
+        0x1.b3e0aa0e00c04p-53, 0x1.b207cf09a985fp-53,
+        0x1.b030b4fc3a11fp-53, 0x1.ae5b4e18bb33bp-53,
+        0x1.ac878cd5af5d2p-53, 0x1.aab563e9ff10dp-53,
+        0x1.a8e4c64a03142p-53, 0x1.a715a724aa9aap-53,
+        0x1.a547f9e0bbb8ep-53, 0x1.a37bb21a2c862p-53,
+        0x1.a1b0c39f93699p-53, 0x1.9fe7226fad251p-53,
+        0x1.9e1ec2b6f7417p-53, 0x1.9c5798cd5d931p-53,
+        0x1.9a919933f99c4p-53, 0x1.98ccb892e2a36p-53,
+        0x1.9708ebb70d5f3p-53, 0x1.954627903a28fp-53,
+        0x1.9384612ef0b02p-53, 0x1.91c38dc28834dp-53,
+        0x1.9003a2973b595p-53, 0x1.8e44951446a2cp-53,
+        0x1.8c865aba10ca1p-53, 0x1.8ac8e9205c049p-53,
+        0x1.890c35f47f733p-53, 0x1.875036f7a7ecbp-53,
+        0x1.8594e1fd1f5c3p-53, 0x1.83da2ce899f1bp-53,
+        0x1.82200dac8867dp-53, 0x1.80667a486ea25p-53,
+        0x1.7ead68c73deeep-53, 0x1.7cf4cf3db2303p-53,
+        0x1.7b3ca3c8b1411p-53, 0x1.7984dc8babd9ap-53,
+        0x1.77cd6faeff450p-53, 0x1.7616535e57326p-53,
+        0x1.745f7dc70eee3p-53, 0x1.72a8e516914cdp-53,
+        0x1.70f27f78b68f2p-53, 0x1.6f3c43161f85bp-53,
+        0x1.6d8626128d359p-53, 0x1.6bd01e8b343c3p-53,
+        0x1.6a1a22950b2b9p-53, 0x1.6864283b1313fp-53,
+        0x1.66ae257c9967ap-53, 0x1.64f8104b72613p-53,
+        0x1.6341de8a2b0a9p-53, 0x1.618b860a31fcap-53,
+        0x1.5fd4fc89f5e3ep-53, 0x1.5e1e37b2f8cd9p-53,
+        0x1.5c672d17d7344p-53, 0x1.5aafd23241b5fp-53,
+        0x1.58f81c60e851ap-53, 0x1.574000e555f7ep-53,
+        0x1.558774e1bb2cdp-53, 0x1.53ce6d56a6655p-53,
+        0x1.5214df20a8b60p-53, 0x1.505abef5e5567p-53,
+        0x1.4ea001638a60ap-53, 0x1.4ce49acb311e1p-53,
+        0x1.4b287f6024162p-53, 0x1.496ba32488f34p-53,
+        0x1.47adf9e66c33cp-53, 0x1.45ef773cac763p-53,
+        0x1.44300e83c30aap-53, 0x1.426fb2da67463p-53,
+        0x1.40ae571e09e7ap-53, 0x1.3eebede725a89p-53,
+        0x1.3d28698561de7p-53, 0x1.3b63bbfb83d09p-53,
+        0x1.399dd6fb2b26ap-53, 0x1.37d6abe055870p-53,
+        0x1.360e2baca52dbp-53, 0x1.3444470265ea8p-53,
+        0x1.3278ee1f4b937p-53, 0x1.30ac10d6e48ddp-53,
+        0x1.2edd9e8cba994p-53, 0x1.2d0d862e1b859p-53,
+        0x1.2b3bb62b82ee0p-53, 0x1.29681c719d721p-53,
+        0x1.2792a661dd386p-53, 0x1.25bb40ca96c03p-53,
+        0x1.23e1d7de9c326p-53, 0x1.2206572c4c6f1p-53,
+        0x1.2028a9940a0a8p-53, 0x1.1e48b93e0d436p-53,
+        0x1.1c666f8f82ad4p-53, 0x1.1a81b51ee6d91p-53,
+        0x1.189a71a78da3dp-53, 0x1.16b08bfc42027p-53,
+        0x1.14c3e9f8e914ap-53, 0x1.12d4707310fc7p-53,
+        0x1.10e20329515f7p-53, 0x1.0eec84b160875p-53,
+        0x1.0cf3d664bcc89p-53, 0x1.0af7d84bc611dp-53,
+        0x1.08f869071f416p-53, 0x1.06f565b72a01cp-53,
+        0x1.04eea9e16a607p-53, 0x1.02e40f5398fa4p-53,
+        0x1.00d56e04234f6p-53, 0x1.fd8537dfa2ec0p-54,
+        0x1.f956d9e87d7c2p-54, 0x1.f51f654d8f69bp-54,
+        0x1.f0de784f06239p-54, 0x1.ec93abdf982e1p-54,
+        0x1.e83e9337a6f14p-54, 0x1.e3debb5d2ee12p-54,
+        0x1.df73aa9f17666p-54, 0x1.dafce0023b8d7p-54,
+        0x1.d679d29e41f24p-54, 0x1.d1e9f0e80b75cp-54,
+        0x1.cd4c9fe72269fp-54, 0x1.c8a13a5323b77p-54,
+        0x1.c3e70f9594f09p-54, 0x1.bf1d62abf8249p-54,
+        0x1.ba4368e529f52p-54, 0x1.b558487427a41p-54,
+        0x1.b05b16d136cb4p-54, 0x1.ab4ad6e101649p-54,
+        0x1.a62676d77cd72p-54, 0x1.a0eccdca4a746p-54,
+        0x1.9b9c98e38c562p-54, 0x1.96347822c1f06p-54,
+        0x1.90b2ea94ecfb4p-54, 0x1.8b1649e7b76b5p-54,
+        0x1.855cc53430a94p-54, 0x1.7f845ad46f561p-54,
+        0x1.798ad10b32a96p-54, 0x1.736dad346f8c7p-54,
+        0x1.6d2a292000590p-54, 0x1.66bd261a37c5fp-54,
+        0x1.60231cfd97f0dp-54, 0x1.59580a707ceb9p-54,
+        0x1.52575621ad397p-54, 0x1.4b1bb363dfecdp-54,
+        0x1.439ef8dff9b7bp-54, 0x1.3bd9ec1a2b156p-54,
+        0x1.33c3fc057921cp-54, 0x1.2b52e3863d8aap-54,
+        0x1.227a28f7a1b22p-54, 0x1.192a6974136a8p-54,
+        0x1.0f5053b025d77p-54, 0x1.04d32278ebbe5p-54,
+        0x1.f32482d4cd63bp-55, 0x1.dac2f5a7472f6p-55,
+        0x1.c004d2f386289p-55, 0x1.a230c2e4cd161p-55,
+        0x1.801fce82fa7c9p-55, 0x1.57cb938443c44p-55,
+        0x1.250af3c2c5cdep-55, 0x1.b8d0be3fdfa7cp-56,
+    },
+    {
+        0x0.0p+0, 0x1.4a605b6b9f704p-10,
+        0x1.55f9f43c1b067p-9, 0x1.08a1f03b0b1fdp-8,
+        0x1.69ea8d90cb857p-8, 0x1.ce160f8ec6830p-8,
+        0x1.1a59229952f8ep-7, 0x1.4eb96421acfe0p-7,
+        0x1.841040d8da478p-7, 0x1.ba48d274f8facp-7,
+        0x1.f152a4f72dd49p-7, 0x1.1490334603012p-6,
+        0x1.30d388dab5e13p-6, 0x1.4d6eaf2fbb05cp-6,
+        0x1.6a5daf40bbf79p-6, 0x1.879d1b600c0fap-6,
+        0x1.a529f4e22ebddp-6, 0x1.c301983cd08fdp-6,
+        0x1.e121adb828c57p-6, 0x1.ff881d718a5a4p-6,
+        0x1.0f1982e968000p-5, 0x1.1e9059f1f6aadp-5,
+        0x1.2e27ce83df48bp-5, 0x1.3ddf2ce98eebfp-5,
+        0x1.4db5d0e112757p-5, 0x1.5dab23cf2adcfp-5,
+        0x1.6dbe9b398d064p-5, 0x1.7defb77af271ep-5,
+        0x1.8e3e02a68b5abp-5, 0x1.9ea90f9295563p-5,
+        0x1.af30790385f70p-5, 0x1.bfd3e0f282a2cp-5,
+        0x1.d092efeadf162p-5, 0x1.e16d547b25181p-5,
+        0x1.f262c2b6c6e35p-5, 0x1.01b979e30e497p-4,
+        0x1.0a4ed2c159625p-4, 0x1.12f14d0f2179dp-4,
+        0x1.1ba0cbe97897dp-4, 0x1.245d344dd0d91p-4,
+        0x1.2d266cf9b3111p-4, 0x1.35fc5e4d93e6bp-4,
+        0x1.3edef23269a81p-4, 0x1.47ce1401b2213p-4,
+        0x1.50c9b06fa2baep-4, 0x1.59d1b577466a4p-4,
+        0x1.62e6124854d18p-4, 0x1.6c06b73694a4cp-4,
+        0x1.753395aaa1176p-4, 0x1.7e6ca013eefd6p-4,
+        0x1.87b1c9dbf2852p-4, 0x1.9103075a4a0abp-4,
+        0x1.9a604dc9d5b19p-4, 0x1.a3c9933ea6286p-4,
+        0x1.ad3ece9caf633p-4, 0x1.b6bff78f2e233p-4,
+        0x1.c04d0680b1015p-4, 0x1.c9e5f493b740ap-4,
+        0x1.d38abb9bd91e5p-4, 0x1.dd3b56176e88fp-4,
+        0x1.e6f7bf29aa54bp-4, 0x1.f0bff29520e1cp-4,
+        0x1.fa93ecb6b222cp-4, 0x1.0239d54067d2ap-3,
+        0x1.072f94bb8bf85p-3, 0x1.0c2b33d5209bap-3,
+        0x1.112cb1da26eb9p-3, 0x1.16340e5a82d63p-3,
+        0x1.1b41492757d42p-3, 0x1.2054625183c34p-3,
+        0x1.256d5a2835eb7p-3, 0x1.2a8c3137a071ap-3,
+        0x1.2fb0e847c2a65p-3, 0x1.34db805b4ab88p-3,
+        0x1.3a0bfaae8d7eep-3, 0x1.3f4258b6931aep-3,
+        0x1.447e9c20375d5p-3, 0x1.49c0c6cf5ce2dp-3,
+        0x1.4f08dade31fc1p-3, 0x1.5456da9c86835p-3,
+        0x1.59aac88f31d6cp-3, 0x1.5f04a76f883f9p-3,
+        0x1.64647a2adf19cp-3, 0x1.69ca43e21f259p-3,
+        0x1.6f3607e964713p-3, 0x1.74a7c9c7ab5a1p-3,
+        0x1.7a1f8d368a31dp-3, 0x1.7f9d5621f716cp-3,
+        0x1.852128a819a31p-3, 0x1.8aab091928152p-3,
+        0x1.903afbf74fa62p-3, 0x1.95d105f6a7c20p-3,
+        0x1.9b6d2bfd2fe55p-3, 0x1.a10f7322d7e36p-3,
+        0x1.a6b7e0b192674p-3, 0x1.ac667a25717ffp-3,
+        0x1.b21b452ccd135p-3, 0x1.b7d647a8731a5p-3,
+        0x1.bd9787abe189dp-3, 0x1.c35f0b7d89d3fp-3,
+        0x1.c92cd9971df4bp-3, 0x1.cf00f8a5e6fc1p-3,
+        0x1.d4db6f8b25142p-3, 0x1.dabc455c78ffdp-3,
+        0x1.e0a3816457177p-3, 0x1.e6912b2283cd0p-3,
+        0x1.ec854a4c99c32p-3, 0x1.f27fe6ce998c3p-3,
+        0x1.f88108cb83227p-3, 0x1.fe88b89df93b3p-3,
+        0x1.024b7f6c77475p-2, 0x1.0555f2242e9cfp-2,
+        0x1.0863b8f90432bp-2, 0x1.0b74d88b242cep-2,
+        0x1.0e895598709b7p-2, 0x1.11a134fcf2417p-2,
+        0x1.14bc7bb34ee5ep-2, 0x1.17db2ed5454dfp-2,
+        0x1.1afd539c2f047p-2, 0x1.1e22ef618810dp-2,
+        0x1.214c079f7cc95p-2, 0x1.2478a1f17de7fp-2,
+        0x1.27a8c414db113p-2, 0x1.2adc73e963fd2p-2,
+        0x1.2e13b7721075cp-2, 0x1.314e94d5af626p-2,
+        0x1.348d125f9d194p-2, 0x1.37cf36808136ep-2,
+        0x1.3b1507cf143a3p-2, 0x1.3e5e8d08ed2d0p-2,
+        0x1.41abcd1357a0dp-2, 0x1.44fccefc324f1p-2,
+        0x1.485199fad6ac8p-2, 0x1.4baa357109c96p-2,
+        0x1.4f06a8ebf6d83p-2, 0x1.5266fc2533bdep-2,
+        0x1.55cb3703d00f0p-2, 0x1.5933619d6eeb1p-2,
+        0x1.5c9f84376c235p-2, 0x1.600fa7480d2bap-2,
+        0x1.6383d377be507p-2, 0x1.66fc11a25cbd4p-2,
+        0x1.6a786ad88de12p-2, 0x1.6df8e86124c9cp-2,
+        0x1.717d93ba9613dp-2, 0x1.7506769c7b1dcp-2,
+        0x1.78939af9252dap-2, 0x1.7c250aff4149fp-2,
+        0x1.7fbad11b8d900p-2, 0x1.8354f7faa0dc9p-2,
+        0x1.86f38a8ac5aa7p-2, 0x1.8a9693fde917ap-2,
+        0x1.8e3e1fcb9f108p-2, 0x1.91ea39b33cb09p-2,
+        0x1.959aedbe09f84p-2, 0x1.995048418c0b9p-2,
+        0x1.9d0a55e1e93d2p-2, 0x1.a0c9239468431p-2,
+        0x1.a48cbea20c042p-2, 0x1.a85534aa4d873p-2,
+        0x1.ac2293a5f5a91p-2, 0x1.aff4e9ea18547p-2,
+        0x1.b3cc462b331bep-2, 0x1.b7a8b78071310p-2,
+        0x1.bb8a4d6716d86p-2, 0x1.bf7117c616a0bp-2,
+        0x1.c35d26f1d2cabp-2, 0x1.c74e8bb00d7b9p-2,
+        0x1.cb45573c0a83ap-2, 0x1.cf419b4ae5b60p-2,
+        0x1.d3436a1021072p-2, 0x1.d74ad6426de25p-2,
+        0x1.db57f320b56a2p-2, 0x1.df6ad477639fbp-2,
+        0x1.e3838ea5f9b77p-2, 0x1.e7a236a4ec3b8p-2,
+        0x1.ebc6e20bd1f46p-2, 0x1.eff1a717e8f85p-2,
+        0x1.f4229cb2f7ae4p-2, 0x1.f859da7a900bcp-2,
+        0x1.fc9778c7bbd93p-2, 0x1.006dc85b8cabdp-1,
+        0x1.02931e18b8223p-1, 0x1.04bbcafa63f26p-1,
+        0x1.06e7dccf03c2dp-1, 0x1.091761d995d78p-1,
+        0x1.0b4a68d70d9a5p-1, 0x1.0d81010414296p-1,
+        0x1.0fbb3a2325909p-1, 0x1.11f9248311f2ep-1,
+        0x1.143ad105ea991p-1, 0x1.16805128639cfp-1,
+        0x1.18c9b709b3c45p-1, 0x1.1b171573fd106p-1,
+        0x1.1d687fe54995ep-1, 0x1.1fbe0a9929616p-1,
+        0x1.2217ca92ff7e6p-1, 0x1.2475d5a90db78p-1,
+        0x1.26d84290504e1p-1, 0x1.293f28e93cd09p-1,
+        0x1.2baaa14d7953cp-1, 0x1.2e1ac55ea3be0p-1,
+        0x1.308fafd6438e2p-1, 0x1.33097c9703a29p-1,
+        0x1.358848bf550ddp-1, 0x1.380c32bda00c9p-1,
+        0x1.3a955a662cd02p-1, 0x1.3d23e10af3197p-1,
+        0x1.3fb7e99585b76p-1, 0x1.425198a355fd7p-1,
+        0x1.44f114a49366dp-1, 0x1.479685fdf5006p-1,
+        0x1.4a42172dc526cp-1, 0x1.4cf3f4f494eb4p-1,
+        0x1.4fac4e820b65bp-1, 0x1.526b55a656cc9p-1,
+        0x1.55313f08d9e3ap-1, 0x1.57fe4264c8d82p-1,
+        0x1.5ad29acc85c7bp-1, 0x1.5dae86f4aff5cp-1,
+        0x1.6092498802657p-1, 0x1.637e298550c0ap-1,
+        0x1.667272a92e315p-1, 0x1.696f75e513b1bp-1,
+        0x1.6c7589e635a7ap-1, 0x1.6f850baea7adfp-1,
+        0x1.729e5f43f6d02p-1, 0x1.75c1f0770d846p-1,
+        0x1.78f033ca0b0c5p-1, 0x1.7c29a779c6848p-1,
+        0x1.7f6ed4b20e2bbp-1, 0x1.82c050f56cf5dp-1,
+        0x1.861ebfc37bc9ap-1, 0x1.898ad48badef0p-1,
+        0x1.8d0554fe60a96p-1, 0x1.908f1bd31713cp-1,
+        0x1.94291c21b7a34p-1, 0x1.97d4657617aaep-1,
+        0x1.9b9228d24066ep-1, 0x1.9f63bee651fc4p-1,
+        0x1.a34aafdf5aefbp-1, 0x1.a748bd550c9cdp-1,
+        0x1.ab5fef17a24f0p-1, 0x1.af92a3f6ce88dp-1,
+        0x1.b3e3a8234dcfap-1, 0x1.b85653a8ff53bp-1,
+        0x1.bceeb4ee1dc6ap-1, 0x1.c1b1cd9eebad1p-1,
+        0x1.c6a5ecea97865p-1, 0x1.cbd33a8a72dd0p-1,
+        0x1.d144978a119bfp-1, 0x1.d70920657bcd3p-1,
+        0x1.dd36fa704de74p-1, 0x1.e3f11e027f053p-1,
+        0x1.eb7545b6ca8ecp-1, 0x1.f446ac979f055p-1,
+        0x1.0000000000000p+0,
+    },
+    0x1.d3bb48209ad34p+1,
+};
+
+// exp(-x), tail from r = 7.69711747013105
+const cromulent_zig_table cromulent_zig_exponential = {
+    {
+        0x001c5214272497c8ULL, 0x001cdb4dd9e4e8c1ULL, 0x001dddf62bac0bb2ULL, 0x001e5961c78b267dULL,
+        0x001ea2a61e122db3ULL, 0x001ed38ca188151fULL, 0x001ef6aefa57cbe7ULL, 0x001f113e047b0415ULL,
+        0x001f26143450340aULL, 0x001f36e5a38a59a4ULL, 0x001f44c7665c6fdcULL, 0x001f50724ece1174ULL,
+        0x001f5a66904fe3c6ULL, 0x001f630000a8e268ULL, 0x001f6a8234b7352cULL, 0x001f71200f1a241dULL,
+        0x001f7700a3582aceULL, 0x001f7c427839e926ULL, 0x001f80fdc336039bULL, 0x001f8545f904db90ULL,
+        0x001f892aec479609ULL, 0x001f8cb99e7385f9ULL, 0x001f8ffcda9ae41eULL, 0x001f92fda9cef1f4ULL,
+        0x001f95c3abd03f7aULL, 0x001f98555b782fbaULL, 0x001f9ab84415abc5ULL, 0x001f9cf12b79f9beULL,
+        0x001f9f04336bbe0bULL, 0x001fa0f4f47df317ULL, 0x001fa2c693c5c096ULL, 0x001fa47bd48bea00ULL,
+        0x001fa61726d1f214ULL, 0x001fa79ab3508d3dULL, 0x001fa908656f66a3ULL, 0x001faa61f399ff29ULL,
+        0x001faba8e640060bULL, 0x001facde9dbf2d74ULL, 0x001fae045767e107ULL, 0x001faf1b31c479a8ULL,
+        0x001fb0243042e1c3ULL, 0x001fb1203e5a9606ULL, 0x001fb21032442854ULL, 0x001fb2f4cf539c40ULL,
+        0x001fb3cec803e747ULL, 0x001fb49ebfbf69d3ULL, 0x001fb5654c6f37e3ULL, 0x001fb622f7d96944ULL,
+        0x001fb6d840d55595ULL, 0x001fb7859c5b895eULL, 0x001fb82b76765b55ULL, 0x001fb8ca33174a18ULL,
+        0x001fb9622ed4abfdULL, 0x001fb9f3bf92b61aULL, 0x001fba7f351a70aeULL, 0x001fbb04d9a0d18eULL,
+        0x001fbb84f23fe6a3ULL, 0x001fbbffbf63b7aaULL, 0x001fbc757d2c4de6ULL, 0x001fbce663c6201bULL,
+        0x001fbd52a7b9f827ULL, 0x001fbdba7a354409ULL, 0x001fbe1e094ba615ULL, 0x001fbe7d80327ddcULL,
+        0x001fbed907770cc7ULL, 0x001fbf30c52fc60dULL, 0x001fbf84dd294890ULL, 0x001fbfd5710f72baULL,
+        0x001fc022a092f366ULL, 0x001fc06c898baff1ULL, 0x001fc0b348184da5ULL, 0x001fc0f6f6bb2417ULL,
+        0x001fc137ae74d6b8ULL, 0x001fc17586dccd10ULL, 0x001fc1b09637bb3eULL, 0x001fc1e8f18c6757ULL,
+        0x001fc21eacb6d39fULL, 0x001fc251da79f165ULL, 0x001fc2828c8ffcf0ULL, 0x001fc2b0d3b99fa0ULL,
+        0x001fc2dcbfcbf264ULL, 0x001fc3065fbd7888ULL, 0x001fc32dc1b2281bULL, 0x001fc352f3069372ULL,
+        0x001fc376005a4594ULL, 0x001fc396f599614dULL, 0x001fc3b5de0591b5ULL, 0x001fc3d2c43e593eULL,
+        0x001fc3edb248cb63ULL, 0x001fc406b196bbf8ULL, 0x001fc41dcb0d6e0fULL, 0x001fc433070bcb9aULL,
+        0x001fc4466d702e23ULL, 0x001fc458059dc038ULL, 0x001fc467d6817e84ULL, 0x001fc475e696dee8ULL,
+        0x001fc4823bec237aULL, 0x001fc48cdc265ec2ULL, 0x001fc495cc852df5ULL, 0x001fc49d11e62de4ULL,
+        0x001fc4a2b0c82e76ULL, 0x001fc4a6ad4e28a1ULL, 0x001fc4a90b41fa36ULL, 0x001fc4a9ce16eaa0ULL,
+        0x001fc4a8f8ebfb8dULL, 0x001fc4a68e8e07fdULL, 0x001fc4a29179b435ULL, 0x001fc49d03dd30b1ULL,
+        0x001fc495e799d21dULL, 0x001fc48d3e457ff7ULL, 0x001fc483092bfbbbULL, 0x001fc477495001b2ULL,
+        0x001fc469ff6c4505ULL, 0x001fc45b2bf447e9ULL, 0x001fc44acf15112cULL, 0x001fc438e8b5bfc8ULL,
+        0x001fc4257877fd69ULL, 0x001fc4107db85061ULL, 0x001fc3f9f78e4daaULL, 0x001fc3e1e4ccab41ULL,
+        0x001fc3c844013349ULL, 0x001fc3ad137497faULL, 0x001fc390512a2887ULL, 0x001fc371fadf66f9ULL,
+        0x001fc3520e0b7ec8ULL, 0x001fc33087de9c10ULL, 0x001fc30d654122eeULL, 0x001fc2e8a2d2c6b5ULL,
+        0x001fc2c23ce98047ULL, 0x001fc29a2f906310ULL, 0x001fc27076864fc3ULL, 0x001fc2450d3c8400ULL,
+        0x001fc217eed505dfULL, 0x001fc1e91620ea44ULL, 0x001fc1b87d9e74b5ULL, 0x001fc1861f770f4cULL,
+        0x001fc151f57d1943ULL, 0x001fc11bf9298a66ULL, 0x001fc0e42399698bULL, 0x001fc0aa6d8b1429ULL,
+        0x001fc06ecf5b54b5ULL, 0x001fc03141024589ULL, 0x001fbff1ba0ffdb3ULL, 0x001fbfb031a904c5ULL,
+        0x001fbf6c9e828ae4ULL, 0x001fbf26f6de6175ULL, 0x001fbedf3086b12aULL, 0x001fbe9540c96960ULL,
+        0x001fbe491c7364e0ULL, 0x001fbdfab7cb3f42ULL, 0x001fbdaa068bd66dULL, 0x001fbd56fbde729eULL,
+        0x001fbd018a548fa0ULL, 0x001fbca9a3e140d6ULL, 0x001fbc4f39d22996ULL, 0x001fbbf23cc8029fULL,
+        0x001fbb929caea4e5ULL, 0x001fbb3048b49145ULL, 0x001fbacb2f41ec18ULL, 0x001fba633deee288ULL,
+        0x001fb9f861796f26ULL, 0x001fb98a85ba7204ULL, 0x001fb919959a0f74ULL, 0x001fb8a57b0347f7ULL,
+        0x001fb82e1ed6ba0bULL, 0x001fb7b368dc7daaULL, 0x001fb7353fb5079aULL, 0x001fb6b388c9010dULL,
+        0x001fb62e2837fe59ULL, 0x001fb5a500c5fdabULL, 0x001fb517f3c793fdULL, 0x001fb486e10cacd8ULL,
+        0x001fb3f1a6c9be0dULL, 0x001fb358217f4e1aULL, 0x001fb2ba2bdfa84bULL, 0x001fb2179eb2963bULL,
+        0x001fb17050b6f1fcULL, 0x001fb0c41681dff5ULL, 0x001fb012c25b7a15ULL, 0x001faf5c2418b07eULL,
+        0x001faea008f21d6fULL, 0x001fadde3b5782c1ULL, 0x001fad1682bf9febULL, 0x001fac48a3740586ULL,
+        0x001fab745e588233ULL, 0x001faa9970adb85bULL, 0x001fa9b793ce5ff0ULL, 0x001fa8ce7ce6a877ULL,
+        0x001fa7dddca51ec5ULL, 0x001fa6e55ee46785ULL, 0x001fa5e4aa4d097eULL, 0x001fa4db5fee6aa4ULL,
+        0x001fa3c91ace0685ULL, 0x001fa2ad6f6bc4fdULL, 0x001fa187eb3a333aULL, 0x001fa058140936c1ULL,
+        0x001f9f1d6761a1cfULL, 0x001f9dd759cfd804ULL, 0x001f9c85561b717cULL, 0x001f9b26bc697f01ULL,
+        0x001f99bae146ba82ULL, 0x001f98410c968892ULL, 0x001f96b878633893ULL, 0x001f95204f8b64ddULL,
+        0x001f9377ac47afd9ULL, 0x001f91bd968358e1ULL, 0x001f8ff102013e18ULL, 0x001f8e10cc45d04bULL,
+        0x001f8c1bba3d39aeULL, 0x001f8a10759374fdULL, 0x001f87ed89b24262ULL, 0x001f85b16056b915ULL,
+        0x001f835a3dad9162ULL, 0x001f80e63be21139ULL, 0x001f7e5346079f8bULL, 0x001f7b9f12413ff7ULL,
+        0x001f78c71b045cc1ULL, 0x001f75c8974d09d9ULL, 0x001f72a07190f13bULL, 0x001f6f4b3d32e4f5ULL,
+        0x001f6bc52a2b02e9ULL, 0x001f6809f685967bULL, 0x001f6414dd445771ULL, 0x001f5fe08210d08dULL,
+        0x001f5b66d9099998ULL, 0x001f56a109c3ecc0ULL, 0x001f51874c5c3324ULL, 0x001f4c10bf1d3a12ULL,
+        0x001f463332d788faULL, 0x001f3fe2eb6e694fULL, 0x001f39125157c108ULL, 0x001f31b18fb95534ULL,
+        0x001f29ae1951a877ULL, 0x001f20f20c452572ULL, 0x001f176369f1f77dULL, 0x001f0ce313a796baULL,
+        0x001f014b76ddd4a8ULL, 0x001ef46eca361cd1ULL, 0x001ee614ae6e568aULL, 0x001ed5f6f08799cfULL,
+        0x001ec3bd07b4655cULL, 0x001eaef5b14ef09fULL, 0x001e970daf08ae43ULL, 0x001e7b42096f046fULL,
+        0x001e5a8b177cb7a6ULL, 0x001e337b71d4783cULL, 0x001e0409dfac9dd0ULL, 0x001dc934dd172c78ULL,
+        0x001d7e5bd56b18bcULL, 0x001d1bfe2d5c397cULL, 0x001c951d0f886529ULL, 0x001bd127f7194493ULL,
+        0x001a9bb7320eb0d7ULL, 0x00186ef58e3f3c5cULL, 0x00137d5bd79c3244ULL, 0x0000000000000000ULL,
+    },
+    {
+        0x1.164ec94bf5dc2p-50, 0x1.ec9d9297ebb83p-51,
+        0x1.bc39e51da71fcp-51, 0x1.9e9dc0d487b85p-51,
+        0x1.8939fe6f2ed19p-51, 0x1.78750d6eac62fp-51,
+        0x1.6aa676d4bbf72p-51, 0x1.5ee7ae17313d2p-51,
+        0x1.54ad83ccf73f5p-51, 0x1.4b9d7cd4751d0p-51,
+        0x1.4379766e41361p-51, 0x1.3c14ec7c8b860p-51,
+        0x1.354ee27ccf75dp-51, 0x1.2f0e38a4411f0p-51,
+        0x1.293f5ae49aaa5p-51, 0x1.23d2bb659919fp-51,
+        0x1.1ebbca0c9fa7cp-51, 0x1.19f03bcb3c2d6p-51,
+        0x1.156786775442ap-51, 0x1.111a8034392a6p-51,
+        0x1.0d031785d48a0p-51, 0x1.091c1cdcba54ep-51,
+        0x1.056118bf58eefp-51, 0x1.01ce2b362ec2ep-51,
+        0x1.fcbfe43f6c6e6p-52, 0x1.f626e9791f7a7p-52,
+        0x1.efcc26750ea4ap-52, 0x1.e9aaf2af383c1p-52,
+        0x1.e3bf26e190960p-52, 0x1.de050af4ef19fp-52,
+        0x1.d87946fec3becp-52, 0x1.d318d6b2738c5p-52,
+        0x1.cde0fecf2a97fp-52, 0x1.c8cf442c8c8f3p-52,
+        0x1.c3e1641c2e0a6p-52, 0x1.bf154de4bef76p-52,
+        0x1.ba691d276da5dp-52, 0x1.b5db15091ea0ep-52,
+        0x1.b1699c003b608p-52, 0x1.ad13382d845c3p-52,
+        0x1.a8d68c2ad86e8p-52, 0x1.a4b2543e84c3ap-52,
+        0x1.a0a563e49f177p-52, 0x1.9caea3a24d9e9p-52,
+        0x1.98cd0f18d1ad7p-52, 0x1.94ffb34fc2a0dp-52,
+        0x1.9145ad2f37543p-52, 0x1.8d9e2823b3695p-52,
+        0x1.8a085ce695baap-52, 0x1.8683906687341p-52,
+        0x1.830f12cc0bec3p-52, 0x1.7faa3e96e1412p-52,
+        0x1.7c5477d1476d3p-52, 0x1.790d2b56b71f9p-52,
+        0x1.75d3ce2bd71c3p-52, 0x1.72a7dce5cd218p-52,
+        0x1.6f88db1f42507p-52, 0x1.6c7652f9a7b1ep-52,
+        0x1.696fd4a9748eep-52, 0x1.6674f60c3f431p-52,
+        0x1.63855247b2e93p-52, 0x1.60a0897081877p-52,
+        0x1.5dc640388bd9cp-52, 0x1.5af61fa38e106p-52,
+        0x1.582fd4c1b4460p-52, 0x1.5573106f8a759p-52,
+        0x1.52bf871acaab1p-52, 0x1.5014f08b99508p-52,
+        0x1.4d7307b1cb127p-52, 0x1.4ad98a75da14cp-52,
+        0x1.4848398d39432p-52, 0x1.45bed851bc92cp-52,
+        0x1.433d2c9bd42f8p-52, 0x1.40c2fe9f5eeadp-52,
+        0x1.3e5018caddecfp-52, 0x1.3be447a8d8b83p-52,
+        0x1.397f59c345143p-52, 0x1.37211f88ca856p-52,
+        0x1.34c96b33bc965p-52, 0x1.327810b2aa7cfp-52,
+        0x1.302ce59265964p-52, 0x1.2de7c0e962d70p-52,
+        0x1.2ba87b445db50p-52, 0x1.296eee942532bp-52,
+        0x1.273af61c7daa6p-52, 0x1.250c6e6403bbap-52,
+        0x1.22e33524fe550p-52, 0x1.20bf293f0f4a2p-52,
+        0x1.1ea02aa9b3371p-52, 0x1.1c861a6782a5bp-52,
+        0x1.1a70da7a27821p-52, 0x1.18604dd6fae9ep-52,
+        0x1.1654585c404c1p-52, 0x1.144cdec6f3a2cp-52,
+        0x1.1249c6a92154bp-52, 0x1.104af660befcfp-52,
+        0x1.0e50550efcfb8p-52, 0x1.0c59ca9009470p-52,
+        0x1.0a673f733c81ap-52, 0x1.08789cf3aad0fp-52,
+        0x1.068dccf1126dbp-52, 0x1.04a6b9e9224a3p-52,
+        0x1.02c34ef11391bp-52, 0x1.00e377af911d5p-52,
+        0x1.fe0e40add09d9p-53, 0x1.fa5c6b3efe1e6p-53,
+        0x1.f6b1498515ed1p-53, 0x1.f30cb6ea0bc81p-53,
+        0x1.ef6e8fc5b9169p-53, 0x1.ebd6b154a767ap-53,
+        0x1.e844f9af42381p-53, 0x1.e4b947c16a454p-53,
+        0x1.e1337b426509dp-53, 0x1.ddb374ad23581p-53,
+        0x1.da391538da50cp-53, 0x1.d6c43ed1ea401p-53,
+        0x1.d354d4130f2b0p-53, 0x1.cfeab83ed7182p-53,
+        0x1.cc85cf395a56ep-53, 0x1.c925fd82323fep-53,
+        0x1.c5cb282eab1a7p-53, 0x1.c27534e42e02fp-53,
+        0x1.bf2409d2dfd87p-53, 0x1.bbd78db072612p-53,
+        0x1.b88fa7b324fb7p-53, 0x1.b54c3f8cf2543p-53,
+        0x1.b20d3d66e8bb6p-53, 0x1.aed289dcaad00p-53,
+        0x1.ab9c0df81657bp-53, 0x1.a869b32d0f310p-53,
+        0x1.a53b63556c691p-53, 0x1.a21108ad0592ep-53,
+        0x1.9eea8dcdde952p-53, 0x1.9bc7ddac7035ep-53,
+        0x1.98a8e3940bbf5p-53, 0x1.958d8b235828bp-53,
+        0x1.9275c048e73e2p-53, 0x1.8f616f3fe1514p-53,
+        0x1.8c50848cc6095p-53, 0x1.8942ecfa40f55p-53,
+        0x1.86389596108e8p-53, 0x1.83316badfe62bp-53,
+        0x1.802d5ccce7278p-53, 0x1.7d2c56b7d17f9p-53,
+        0x1.7a2e476b1240cp-53, 0x1.77331d177d131p-53,
+        0x1.743ac61fa041dp-53, 0x1.714531150a9fcp-53,
+        0x1.6e524cb59a609p-53, 0x1.6b6207e8d3ce1p-53,
+        0x1.687451bd3ebf0p-53, 0x1.65891965c9b8ep-53,
+        0x1.62a04e3731a30p-53, 0x1.5fb9dfa56cf29p-53,
+        0x1.5cd5bd4119337p-53, 0x1.59f3d6b4e9cfbp-53,
+        0x1.57141bc316f29p-53, 0x1.54367c42cb5fbp-53,
+        0x1.515ae81d900fep-53, 0x1.4e814f4cb45edp-53,
+        0x1.4ba9a1d6b18a7p-53, 0x1.48d3cfcc883c6p-53,
+        0x1.45ffc94716ca9p-53, 0x1.432d7e6466cd2p-53,
+        0x1.405cdf44f09c6p-53, 0x1.3d8ddc08d3370p-53,
+        0x1.3ac064ccfefffp-53, 0x1.37f469a851af3p-53,
+        0x1.3529daa8a1ba5p-53, 0x1.3260a7cfb7615p-53,
+        0x1.2f98c11031724p-53, 0x1.2cd2164a53b60p-53,
+        0x1.2a0c9748bcdacp-53, 0x1.274833bd018a2p-53,
+        0x1.2484db3c2a32cp-53, 0x1.21c27d3b10e07p-53,
+        0x1.1f01090a9c4e4p-53, 0x1.1c406dd3d5285p-53,
+        0x1.19809a93d2398p-53, 0x1.16c17e1777ffep-53,
+        0x1.140306f707dc0p-53, 0x1.114523917ac18p-53,
+        0x1.0e87c207a2f68p-53, 0x1.0bcad03710139p-53,
+        0x1.090e3bb4b0074p-53, 0x1.0651f1c7276fap-53,
+        0x1.0395df60db165p-53, 0x1.00d9f119a3cdcp-53,
+        0x1.fc3c26504a9a8p-54, 0x1.f6c462b57febcp-54,
+        0x1.f14c6e20294a7p-54, 0x1.ebd41e5e21b6ap-54,
+        0x1.e65b483cf104bp-54, 0x1.e0e1bf77c3206p-54,
+        0x1.db6756a42905ep-54, 0x1.d5ebdf1d86b94p-54,
+        0x1.d06f28ef0e702p-54, 0x1.caf102bc25ae2p-54,
+        0x1.c57139a70d2a6p-54, 0x1.bfef99359fea1p-54,
+        0x1.ba6beb33f8f91p-54, 0x1.b4e5f794c97a3p-54,
+        0x1.af5d844f224d0p-54, 0x1.a9d255396d268p-54,
+        0x1.a4442be148852p-54, 0x1.9eb2c75ff03c7p-54,
+        0x1.991de42ad1340p-54, 0x1.93853bdfda24cp-54,
+        0x1.8de8850d0c531p-54, 0x1.884772f2be1f3p-54,
+        0x1.82a1b53fed5a1p-54, 0x1.7cf6f7c7e8179p-54,
+        0x1.7746e2307797bp-54, 0x1.71911797990c3p-54,
+        0x1.6bd5362faa94bp-54, 0x1.6612d6d0c68e7p-54,
+        0x1.60498c7dd2ed6p-54, 0x1.5a78e3db8bf04p-54,
+        0x1.54a0629786f54p-54, 0x1.4ebf86bcd0b9bp-54,
+        0x1.48d5c5f35e71ap-54, 0x1.42e28ca706751p-54,
+        0x1.3ce53d12162a9p-54, 0x1.36dd2e26d820ap-54,
+        0x1.30c9aa526da53p-54, 0x1.2aa9ee1236813p-54,
+        0x1.247d26538ff36p-54, 0x1.1e426e93e49efp-54,
+        0x1.17f8ceb4bdfa9p-54, 0x1.119f38749f5b7p-54,
+        0x1.0b348479b8105p-54, 0x1.04b76ed6a7561p-54,
+        0x1.fc4d25d68321bp-55, 0x1.ef00ccf5f4fbdp-55,
+        0x1.e186678f1736cp-55, 0x1.d3da24df17c49p-55,
+        0x1.c5f7bd78c3f9ep-55, 0x1.b7da5dddda3dbp-55,
+        0x1.a97c8be5d521ap-55, 0x1.9ad80552237e8p-55,
+        0x1.8be5954d36084p-55, 0x1.7c9cdda17d031p-55,
+        0x1.6cf40f0a72bd4p-55, 0x1.5cdf89d024adcp-55,
+        0x1.4c515c60bfe3ap-55, 0x1.3b388fe3d6ee3p-55,
+        0x1.2980290da264dp-55, 0x1.170db24d6f68cp-55,
+        0x1.03bf049c65c59p-55, 0x1.decd8b76dbdd6p-56,
+        0x1.b38d1ef79b80cp-56, 0x1.85090fbc27ac4p-56,
+        0x1.522e6e54a2abfp-56, 0x1.19335a95b8e13p-56,
+        0x1.ad6b2495b4e06p-57, 0x1.0589d8b5d4242p-57,
+    },
+    {
+        0x0.0p+0, 0x1.dc31c329f0b48p-12,
+        0x1.fb20af78dfcb7p-11, 0x1.92bb5540c3e26p-10,
+        0x1.1946ba8e1a326p-9, 0x1.6d888f3a1fefep-9,
+        0x1.c58b381cd4b11p-9, 0x1.1073d69574045p-8,
+        0x1.3fa97cee32301p-8, 0x1.7049f37ec3627p-8,
+        0x1.a23e9d497483bp-8, 0x1.d5751fa745dcdp-8,
+        0x1.04ef2295fd7fbp-7, 0x1.1fb69edb37672p-7,
+        0x1.3b0b8c1516f63p-7, 0x1.56e930be416ccp-7,
+        0x1.734b6e6aa74f7p-7, 0x1.902ea688fa7bbp-7,
+        0x1.ad8fa5542c92dp-7, 0x1.cb6b9146e275ap-7,
+        0x1.e9bfdde89c7cep-7, 0x1.04452091e02eep-6,
+        0x1.13e4554725f5dp-6, 0x1.23bc9e1b93a30p-6,
+        0x1.33cd225315d82p-6, 0x1.44151ce87f0bdp-6,
+        0x1.5493da6ab0250p-6, 0x1.6548b72a24077p-6,
+        0x1.76331da87fc96p-6, 0x1.8752853ec9968p-6,
+        0x1.98a670f132a49p-6, 0x1.aa2e6e6924e9cp-6,
+        0x1.bbea150fa5871p-6, 0x1.cdd9054331b0fp-6,
+        0x1.dffae7a51746dp-6, 0x1.f24f6c7af9895p-6,
+        0x1.026b2590dfaf0p-5, 0x1.0bc7a0c7cd654p-5,
+        0x1.153d09f19b3a5p-5, 0x1.1ecb45ff312d7p-5,
+        0x1.28723c956c00fp-5, 0x1.3231d7e3f14b1p-5,
+        0x1.3c0a047ff1901p-5, 0x1.45fab14266b1bp-5,
+        0x1.5003cf296c5eep-5, 0x1.5a25513c5d2cdp-5,
+        0x1.645f2c726a043p-5, 0x1.6eb1579b6af53p-5,
+        0x1.791bcb4ab08a0p-5, 0x1.839e81c3a396dp-5,
+        0x1.8e3976e80776ep-5, 0x1.98eca827b7c4dp-5,
+        0x1.a3b81471bf138p-5, 0x1.ae9bbc26a8083p-5,
+        0x1.b997a10bed984p-5, 0x1.c4abc640721e8p-5,
+        0x1.cfd83031e7949p-5, 0x1.db1ce49315810p-5,
+        0x1.e679ea52eb2e7p-5, 0x1.f1ef49944e838p-5,
+        0x1.fd7d0ba69967cp-5, 0x1.04919d7f5c81ap-4,
+        0x1.0a70f19871b3fp-4, 0x1.105c88756ca53p-4,
+        0x1.165468f755395p-4, 0x1.1c589a86fa342p-4,
+        0x1.22692512c9d8dp-4, 0x1.2886110ce0571p-4,
+        0x1.2eaf676948dd1p-4, 0x1.34e5319c6e718p-4,
+        0x1.3b277999b9f9fp-4, 0x1.417649d25b10fp-4,
+        0x1.47d1ad343985cp-4, 0x1.4e39af290d929p-4,
+        0x1.54ae5b959d037p-4, 0x1.5b2fbed91bb40p-4,
+        0x1.61bde5ccadef8p-4, 0x1.6858ddc30b621p-4,
+        0x1.6f00b488416b8p-4, 0x1.75b5786193c21p-4,
+        0x1.7c77380d7a6f5p-4, 0x1.834602c3bc4bbp-4,
+        0x1.8a21e835a533dp-4, 0x1.910af88e574bap-4,
+        0x1.9801447336b70p-4, 0x1.9f04dd046f428p-4,
+        0x1.a615d3dd938b6p-4, 0x1.ad343b1655464p-4,
+        0x1.b460254356546p-4, 0x1.bb99a5771268cp-4,
+        0x1.c2e0cf42e10adp-4, 0x1.ca35b6b80fd56p-4,
+        0x1.d198706914dd5p-4, 0x1.d909116ad9396p-4,
+        0x1.e087af561baf8p-4, 0x1.e8146048eb9c9p-4,
+        0x1.efaf3ae83c339p-4, 0x1.f758566190412p-4,
+        0x1.ff0fca6cbea8bp-4, 0x1.036ad7a6e7f04p-3,
+        0x1.07550eeb7a5bfp-3, 0x1.0b4697b54b62fp-3,
+        0x1.0f3f7efec171fp-3, 0x1.133fd20c9712ep-3,
+        0x1.17479e6f0ae77p-3, 0x1.1b56f2031d665p-3,
+        0x1.1f6ddaf3dca63p-3, 0x1.238c67bbbe876p-3,
+        0x1.27b2a7260993ep-3, 0x1.2be0a8504cf32p-3,
+        0x1.30167aabe7d6cp-3, 0x1.34542dffa0cadp-3,
+        0x1.3899d2694d5c7p-3, 0x1.3ce7785f8a903p-3,
+        0x1.413d30b386a97p-3, 0x1.459b0c92dccc3p-3,
+        0x1.4a011d8983093p-3, 0x1.4e6f7583cb6f7p-3,
+        0x1.52e626d078c46p-3, 0x1.57654422e78f1p-3,
+        0x1.5bece0954c2b2p-3, 0x1.607d0fab06a2ep-3,
+        0x1.6515e5530d1a9p-3, 0x1.69b775ea6da26p-3,
+        0x1.6e61d63ee84e9p-3, 0x1.73151b91a2838p-3,
+        0x1.77d15b99f46fdp-3, 0x1.7c96ac8851badp-3,
+        0x1.816525094e7e4p-3, 0x1.863cdc48c1af8p-3,
+        0x1.8b1de9f5062d3p-3, 0x1.900866425bb78p-3,
+        0x1.94fc69ee6929fp-3, 0x1.99fa0e43e1621p-3,
+        0x1.9f016d1e4c510p-3, 0x1.a412a0edf5cbap-3,
+        0x1.a92dc4bc03c47p-3, 0x1.ae52f42eb5b0ap-3,
+        0x1.b3824b8dcef3cp-3, 0x1.b8bbe7c72e4a3p-3,
+        0x1.bdffe67394433p-3, 0x1.c34e65db9afecp-3,
+        0x1.c8a784fce17ffp-3, 0x1.ce0b638f6d09bp-3,
+        0x1.d37a220b431fap-3, 0x1.d8f3e1ae3eeb6p-3,
+        0x1.de78c48224f37p-3, 0x1.e408ed62f83a4p-3,
+        0x1.e9a48005940efp-3, 0x1.ef4ba0fe8e098p-3,
+        0x1.f4fe75c963e7bp-3, 0x1.fabd24cff9351p-3,
+        0x1.0043eab934768p-2, 0x1.032f580797c2ap-2,
+        0x1.0620ef05d90d0p-2, 0x1.0918c4ee93e10p-2,
+        0x1.0c16ef88f5330p-2, 0x1.0f1b852d9a669p-2,
+        0x1.12269ccba9fb7p-2, 0x1.15384dee291ecp-2,
+        0x1.1850b0c19197fp-2, 0x1.1b6fde19abc57p-2,
+        0x1.1e95ef77b09d8p-2, 0x1.21c2ff10b7efdp-2,
+        0x1.24f727d4776fbp-2, 0x1.2832857457626p-2,
+        0x1.2b75346ae225fp-2, 0x1.2ebf52039426cp-2,
+        0x1.3210fc6312430p-2, 0x1.356a528fcd0d9p-2,
+        0x1.38cb747b17debp-2, 0x1.3c34830abb281p-2,
+        0x1.3fa5a0230a14bp-2, 0x1.431eeeb1841dep-2,
+        0x1.46a092b80beebp-2, 0x1.4a2ab158bdad0p-2,
+        0x1.4dbd70e26f91ap-2, 0x1.5158f8dde89f2p-2,
+        0x1.54fd721bda3e3p-2, 0x1.58ab06c3aa9ebp-2,
+        0x1.5c61e2631ee69p-2, 0x1.602231fef5873p-2,
+        0x1.63ec2424827e1p-2, 0x1.67bfe8fc60d9cp-2,
+        0x1.6b9db25e4e999p-2, 0x1.6f85b3e649e99p-2,
+        0x1.7378230b08de5p-2, 0x1.77753735e72dep-2,
+        0x1.7b7d29dc68019p-2, 0x1.7f90369b6ce54p-2,
+        0x1.83ae9b5446133p-2, 0x1.87d8984bc3f86p-2,
+        0x1.8c0e704b75d34p-2, 0x1.905068c545cfep-2,
+        0x1.949ec9f9a810ap-2, 0x1.98f9df2097ba2p-2,
+        0x1.9d61f695a378cp-2, 0x1.a1d76207521eep-2,
+        0x1.a65a76aa3013ap-2, 0x1.aaeb8d6fdf6dfp-2,
+        0x1.af8b03428ef59p-2, 0x1.b439394548069p-2,
+        0x1.b8f6951990b82p-2, 0x1.bdc3812aeeeafp-2,
+        0x1.c2a06d00ea57cp-2, 0x1.c78dcd983fb59p-2,
+        0x1.cc8c1dc40e08bp-2, 0x1.d19bde97e1a04p-2,
+        0x1.d6bd97db9ed73p-2, 0x1.dbf1d88a72105p-2,
+        0x1.e139375e137f5p-2, 0x1.e6945367dd34ap-2,
+        0x1.ec03d4b969d89p-2, 0x1.f1886d1eb4246p-2,
+        0x1.f722d8ebfc5f3p-2, 0x1.fcd3dfe21456fp-2,
+        0x1.014e2b160f320p-1, 0x1.043e8ebd26544p-1,
+        0x1.073b931ee3b79p-1, 0x1.0a45b8854d026p-1,
+        0x1.0d5d8812b1e27p-1, 0x1.108394a1cc388p-1,
+        0x1.13b87bc331697p-1, 0x1.16fce6dce6feap-1,
+        0x1.1a518c71e3b21p-1, 0x1.1db7319877b85p-1,
+        0x1.212eaba813ec4p-1, 0x1.24b8e228c509ep-1,
+        0x1.2856d111132b8p-1, 0x1.2c098b61f4f1fp-1,
+        0x1.2fd23e345da59p-1, 0x1.33b23450e6313p-1,
+        0x1.37aada708ddd4p-1, 0x1.3bbdc44e1d10ep-1,
+        0x1.3fecb2bb18b7ap-1, 0x1.44399afa8e11fp-1,
+        0x1.48a6afb8ee062p-1, 0x1.4d366c151f8a7p-1,
+        0x1.51eba15788993p-1, 0x1.56c9882da876cp-1,
+        0x1.5bd3d694cac6ep-1, 0x1.610edc1a7af5ep-1,
+        0x1.667fa6d4f5bfep-1, 0x1.6c2c3498418bdp-1,
+        0x1.721bb5ba94b5ap-1, 0x1.7856e9b09d475p-1,
+        0x1.7ee8a2d24311cp-1, 0x1.85de87806c5adp-1,
+        0x1.8d4a376d3d224p-1, 0x1.95431c455aa2dp-1,
+        0x1.9de9715556d8ep-1, 0x1.a76baa562fad9p-1,
+        0x1.b210f0ee67f1ap-1, 0x1.be5007beb7b14p-1,
+        0x1.cd0a65081ffd8p-1, 0x1.e0545e5881114p-1,
+        0x1.0000000000000p+0,
+    },
+    0x1.ec9d9297ebb83p+2,
+};
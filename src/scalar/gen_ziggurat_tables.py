@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# src/scalar/gen_ziggurat_tables.py
+#
+# Generates src/scalar/cromulent_ziggurat_tables.c, the 256-layer ziggurat
+# tables behind cromulent_normal / cromulent_exponential. The tables are
+# committed as literal constants so that every platform samples from
+# bit-identical tables, whatever its libm.
+#
+#   python3 src/scalar/gen_ziggurat_tables.py > src/scalar/cromulent_ziggurat_tables.c
+
+import math
+from fractions import Fraction
+
+LAYERS = 256
+
+
+def normal_f(x):
+    return math.exp(-0.5 * x * x)
+
+
+def normal_finv(y):
+    return math.sqrt(-2.0 * math.log(y))
+
+
+def normal_tail(r):
+    return math.sqrt(math.pi / 2) * math.erfc(r / math.sqrt(2))
+
+
+def exp_f(x):
+    return math.exp(-x)
+
+
+def exp_finv(y):
+    return -math.log(y)
+
+
+def exp_tail(r):
+    return math.exp(-r)
+
+
+def edges(r, f, finv, tail):
+    """Layer edges x[0..LAYERS] for tail start r, or None if r is too small.
+
+    Every layer has area v; x[0] is the width of the base strip, whose
+    rectangle plus the tail beyond r also has area v. The last entry is the
+    area left over for the top layer minus v, which is zero for the right r.
+    """
+    v = r * f(r) + tail(r)
+    x = [v / f(r), r]
+    for _ in range(2, LAYERS):
+        y = f(x[-1]) + v / x[-1]
+        if y >= 1.0:
+            return None, v
+        x.append(finv(y))
+    x.append(0.0)
+    return x, x[LAYERS - 1] * (1.0 - f(x[LAYERS - 1])) - v
+
+
+def solve(f, finv, tail, lo, hi):
+    # A larger r leaves more area for the top layer.
+    for _ in range(200):
+        mid = 0.5 * (lo + hi)
+        x, excess = edges(mid, f, finv, tail)
+        if x is None or excess < 0:
+            lo = mid
+        else:
+            hi = mid
+    x, _ = edges(hi, f, finv, tail)
+    return hi, x
+
+
+def emit(name, comment, r, x, f):
+    # Fast path: x = (w >> 11) * 2^-53 * x[i] lies inside the next layer's
+    # width, x < x[i + 1], exactly when (w >> 11) < k[i].
+    k = []
+    for i in range(LAYERS):
+        bound = Fraction(x[i + 1]) / Fraction(x[i]) * 2**53
+        k.append(math.ceil(bound))
+    fy = [0.0] + [f(x[i]) for i in range(1, LAYERS)] + [1.0]
+
+    print(f"// {comment}")
+    print(f"const cromulent_zig_table {name} = {{")
+    print("    {")
+    for i in range(0, LAYERS, 4):
+        print("        " + " ".join(f"{v:#018x}ULL," for v in k[i:i + 4]))
+    print("    },")
+    print("    {")
+    for i in range(0, LAYERS, 2):
+        print("        " + " ".join(f"{(x[j] * 2.0**-53).hex()}," for j in range(i, i + 2)))
+    print("    },")
+    print("    {")
+    for i in range(0, LAYERS + 1, 2):
+        print("        " + " ".join(f"{v.hex()}," for v in fy[i:i + 2]))
+    print("    },")
+    print(f"    {r.hex()},")
+    print("};")
+
+
+def main():
+    print("// src/scalar/cromulent_ziggurat_tables.c")
+    print("//")
+    print("// Generated by src/scalar/gen_ziggurat_tables.py; do not edit.")
+    print()
+    print('#include "cromulent.h"')
+    print()
+    r, x = solve(normal_f, normal_finv, normal_tail, 3.0, 4.0)
+    emit("cromulent_zig_normal",
+         f"exp(-x^2 / 2), tail from r = {r!r}", r, x, normal_f)
+    print()
+    r, x = solve(exp_f, exp_finv, exp_tail, 7.0, 8.5)
+    emit("cromulent_zig_exponential",
+         f"exp(-x), tail from r = {r!r}", r, x, exp_f)
+
+
+if __name__ == "__main__":
+    main()
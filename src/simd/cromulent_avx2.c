@@ -19,19 +19,282 @@ void cromulent_avx2_init(cromulent_avx2_state *state, uint64_t seed) {
 }
 
 __m256i cromulent_avx2_next(cromulent_avx2_state *state) {
-  __m256i s0 = state->s0;
-  __m256i s1 = state->s1;
+  return cromulent_step_avx2(&state->s0, &state->s1);
+}
+
+void cromulent_avx2_next_u64(cromulent_avx2_state *state, uint64_t out[4]) {
+  _mm256_storeu_si256((__m256i *)out, cromulent_avx2_next(state));
+}
+
+void cromulent_avx2_fill_lanes(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                               size_t steps) {
+  __m256i a = _mm256_loadu_si256((const __m256i *)s0);
+  __m256i b = _mm256_loadu_si256((const __m256i *)s1);
+
+  for (size_t i = 0; i < steps; ++i, dst += 4)
+    _mm256_storeu_si256((__m256i *)dst, cromulent_step_avx2(&a, &b));
+
+  _mm256_storeu_si256((__m256i *)s0, a);
+  _mm256_storeu_si256((__m256i *)s1, b);
+}
+
+// Sixteen lanes live in four register pairs. The emulated 64-bit multiply is
+// long-latency, so four independent chains keep the multiplier busy.
+void cromulent_bulk_blocks_avx2(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                size_t nblocks) {
+  __m256i a0 = _mm256_loadu_si256((const __m256i *)(s0 + 0));
+  __m256i a1 = _mm256_loadu_si256((const __m256i *)(s0 + 4));
+  __m256i a2 = _mm256_loadu_si256((const __m256i *)(s0 + 8));
+  __m256i a3 = _mm256_loadu_si256((const __m256i *)(s0 + 12));
+  __m256i b0 = _mm256_loadu_si256((const __m256i *)(s1 + 0));
+  __m256i b1 = _mm256_loadu_si256((const __m256i *)(s1 + 4));
+  __m256i b2 = _mm256_loadu_si256((const __m256i *)(s1 + 8));
+  __m256i b3 = _mm256_loadu_si256((const __m256i *)(s1 + 12));
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES) {
+    _mm256_storeu_si256((__m256i *)(dst + 0), cromulent_step_avx2(&a0, &b0));
+    _mm256_storeu_si256((__m256i *)(dst + 4), cromulent_step_avx2(&a1, &b1));
+    _mm256_storeu_si256((__m256i *)(dst + 8), cromulent_step_avx2(&a2, &b2));
+    _mm256_storeu_si256((__m256i *)(dst + 12), cromulent_step_avx2(&a3, &b3));
+  }
+
+  _mm256_storeu_si256((__m256i *)(s0 + 0), a0);
+  _mm256_storeu_si256((__m256i *)(s0 + 4), a1);
+  _mm256_storeu_si256((__m256i *)(s0 + 8), a2);
+  _mm256_storeu_si256((__m256i *)(s0 + 12), a3);
+  _mm256_storeu_si256((__m256i *)(s1 + 0), b0);
+  _mm256_storeu_si256((__m256i *)(s1 + 4), b1);
+  _mm256_storeu_si256((__m256i *)(s1 + 8), b2);
+  _mm256_storeu_si256((__m256i *)(s1 + 12), b3);
+}
+
+// cromulent_strong on the same four register pairs: its step is a longer
+// chain with three emulated multiplies, so the four chains matter even more.
+void cromulent_strong_blocks_avx2(uint64_t *a, uint64_t *b, uint64_t *dst,
+                                  size_t nblocks) {
+  __m256i a0 = _mm256_loadu_si256((const __m256i *)(a + 0));
+  __m256i a1 = _mm256_loadu_si256((const __m256i *)(a + 4));
+  __m256i a2 = _mm256_loadu_si256((const __m256i *)(a + 8));
+  __m256i a3 = _mm256_loadu_si256((const __m256i *)(a + 12));
+  __m256i b0 = _mm256_loadu_si256((const __m256i *)(b + 0));
+  __m256i b1 = _mm256_loadu_si256((const __m256i *)(b + 4));
+  __m256i b2 = _mm256_loadu_si256((const __m256i *)(b + 8));
+  __m256i b3 = _mm256_loadu_si256((const __m256i *)(b + 12));
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES) {
+    _mm256_storeu_si256((__m256i *)(dst + 0),
+                        cromulent_strong_step_avx2(&a0, &b0));
+    _mm256_storeu_si256((__m256i *)(dst + 4),
+                        cromulent_strong_step_avx2(&a1, &b1));
+    _mm256_storeu_si256((__m256i *)(dst + 8),
+                        cromulent_strong_step_avx2(&a2, &b2));
+    _mm256_storeu_si256((__m256i *)(dst + 12),
+                        cromulent_strong_step_avx2(&a3, &b3));
+  }
+
+  _mm256_storeu_si256((__m256i *)(a + 0), a0);
+  _mm256_storeu_si256((__m256i *)(a + 4), a1);
+  _mm256_storeu_si256((__m256i *)(a + 8), a2);
+  _mm256_storeu_si256((__m256i *)(a + 12), a3);
+  _mm256_storeu_si256((__m256i *)(b + 0), b0);
+  _mm256_storeu_si256((__m256i *)(b + 4), b1);
+  _mm256_storeu_si256((__m256i *)(b + 8), b2);
+  _mm256_storeu_si256((__m256i *)(b + 12), b3);
+}
+
+// Counter mode in four chains of four lanes, like the bulk kernel. The
+// affine part of each counter steps by a constant, so the loop needs only the
+// four emulated multiplies of the mixing.
+void cromulent_counter_words_avx2(uint64_t k0, uint64_t k1, uint64_t start,
+                                  uint64_t *dst, size_t n) {
+  uint64_t first[16];
+  for (int l = 0; l < 16; ++l)
+    first[l] = (start + (uint64_t)l) * C6 + k0;
+
+  const __m256i kd = _mm256_set1_epi64x((long long)rotl(k1 * C2, 31));
+  const __m256i step = _mm256_set1_epi64x((long long)(16 * C6));
+  __m256i x0 = _mm256_loadu_si256((const __m256i *)(first + 0));
+  __m256i x1 = _mm256_loadu_si256((const __m256i *)(first + 4));
+  __m256i x2 = _mm256_loadu_si256((const __m256i *)(first + 8));
+  __m256i x3 = _mm256_loadu_si256((const __m256i *)(first + 12));
+
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_si256((__m256i *)(dst + i + 0), cromulent_at_avx2(x0, kd));
+    _mm256_storeu_si256((__m256i *)(dst + i + 4), cromulent_at_avx2(x1, kd));
+    _mm256_storeu_si256((__m256i *)(dst + i + 8), cromulent_at_avx2(x2, kd));
+    _mm256_storeu_si256((__m256i *)(dst + i + 12), cromulent_at_avx2(x3, kd));
+    x0 = _mm256_add_epi64(x0, step);
+    x1 = _mm256_add_epi64(x1, step);
+    x2 = _mm256_add_epi64(x2, step);
+    x3 = _mm256_add_epi64(x3, step);
+  }
+  for (; i < n; ++i)
+    dst[i] = cromulent_at_word(k0, k1, start + i);
+}
+
+// The conversion kernels keep the four register pairs of the bulk kernel and
+// convert each step in registers before storing it.
+void cromulent_bulk_doubles_avx2(uint64_t *s0, uint64_t *s1, double *dst,
+                                 size_t nblocks, uint64_t bias) {
+  const __m256i b = _mm256_set1_epi64x((long long)bias);
+  const __m256d scale = _mm256_set1_pd(0x1.0p-53);
+  __m256i a[4], c[4];
+
+  for (int r = 0; r < 4; ++r) {
+    a[r] = _mm256_loadu_si256((const __m256i *)(s0 + 4 * r));
+    c[r] = _mm256_loadu_si256((const __m256i *)(s1 + 4 * r));
+  }
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES)
+    for (int r = 0; r < 4; ++r) {
+      const __m256i x = _mm256_add_epi64(
+          _mm256_srli_epi64(cromulent_step_avx2(&a[r], &c[r]), 11), b);
+      _mm256_storeu_pd(dst + 4 * r,
+                       _mm256_mul_pd(u53_to_double_avx2(x), scale));
+    }
 
-  state->s0 =
-      _mm256_add_epi64(mullo_epi64_avx2(s0, _mm256_set1_epi64x(C6)), s1);
-  state->s1 = _mm256_add_epi64(rotl_avx2(s1, 31), mix_fast_avx2(s0));
+  for (int r = 0; r < 4; ++r) {
+    _mm256_storeu_si256((__m256i *)(s0 + 4 * r), a[r]);
+    _mm256_storeu_si256((__m256i *)(s1 + 4 * r), c[r]);
+  }
+}
+
+// Each 64-bit word is read as two 32-bit halves in memory order, which on x86
+// is low half first.
+void cromulent_bulk_floats_avx2(uint64_t *s0, uint64_t *s1, float *dst,
+                                size_t nblocks, uint32_t bias) {
+  const __m256i b = _mm256_set1_epi32((int)bias);
+  const __m256 scale = _mm256_set1_ps(0x1.0p-24f);
+  __m256i a[4], c[4];
+
+  for (int r = 0; r < 4; ++r) {
+    a[r] = _mm256_loadu_si256((const __m256i *)(s0 + 4 * r));
+    c[r] = _mm256_loadu_si256((const __m256i *)(s1 + 4 * r));
+  }
+
+  for (size_t i = 0; i < nblocks; ++i, dst += 2 * CROMULENT_BULK_LANES)
+    for (int r = 0; r < 4; ++r) {
+      const __m256i x = _mm256_add_epi32(
+          _mm256_srli_epi32(cromulent_step_avx2(&a[r], &c[r]), 8), b);
+      _mm256_storeu_ps(dst + 8 * r, _mm256_mul_ps(_mm256_cvtepi32_ps(x), scale));
+    }
+
+  for (int r = 0; r < 4; ++r) {
+    _mm256_storeu_si256((__m256i *)(s0 + 4 * r), a[r]);
+    _mm256_storeu_si256((__m256i *)(s1 + 4 * r), c[r]);
+  }
+}
+
+// Lemire's multiply-shift on eight 32-bit draws per register: mul_epu32
+// multiplies the low half of every word, and the high halves are shifted down
+// for a second multiply. A draw is rejected only when the low product half is
+// below t, which is rare, so a group with any rejection is redone by the
+// scalar loop to keep the stream order.
+size_t cromulent_bulk_range32_avx2(const uint64_t *words, size_t nwords,
+                                   uint32_t n, uint32_t t, uint64_t *dst) {
+  const __m256i vn = _mm256_set1_epi64x(n);
+  const __m256i vt = _mm256_set1_epi32((int)t);
+  uint64_t *out = dst;
+
+  for (size_t i = 0; i < nwords; i += 4) {
+    const __m256i x = _mm256_loadu_si256((const __m256i *)(words + i));
+    const __m256i even = _mm256_mul_epu32(x, vn);
+    const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), vn);
+
+    const __m256i lo =
+        _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    const __m256i keep = _mm256_cmpeq_epi32(_mm256_max_epu32(lo, vt), lo);
+    if (_mm256_movemask_epi8(keep) != -1) {
+      out += cromulent_range32_words(words + i, 4, n, t, out);
+      continue;
+    }
+
+    const __m256i hi =
+        _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+    _mm256_storeu_si256((__m256i *)out,
+                        _mm256_cvtepu32_epi64(_mm256_castsi256_si128(hi)));
+    _mm256_storeu_si256((__m256i *)(out + 4),
+                        _mm256_cvtepu32_epi64(_mm256_extracti128_si256(hi, 1)));
+    out += 8;
+  }
+  return (size_t)(out - dst);
+}
+
+// Ziggurat fast path on four words at a time: the layer index drives two
+// gathers, one for the integer accept bound and one for the layer width. The
+// normal's sign bit 8 is moved to bit 63 and xored in. The first rejected lane
+// ends the call.
+size_t cromulent_bulk_ziggurat_avx2(const uint64_t *words, size_t nwords,
+                                    const cromulent_zig_table *t,
+                                    int symmetric, double *dst) {
+  const __m256i layer = _mm256_set1_epi64x(0xff);
+  const __m256i sign = _mm256_set1_epi64x(symmetric ? 0x100 : 0);
+  size_t i = 0;
+
+  for (; i + 4 <= nwords; i += 4) {
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(words + i));
+    const __m256i idx = _mm256_and_si256(w, layer);
+    const __m256i m = _mm256_srli_epi64(w, 11);
+    const __m256i k =
+        _mm256_i64gather_epi64((const long long *)t->k, idx, 8);
+    const __m256d width = _mm256_i64gather_pd(t->w, idx, 8);
+
+    __m256d x = _mm256_mul_pd(u53_to_double_avx2(m), width);
+    x = _mm256_xor_pd(x, _mm256_castsi256_pd(_mm256_slli_epi64(
+                             _mm256_and_si256(w, sign), 55)));
+    _mm256_storeu_pd(dst + i, x);
+
+    const int accept =
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(k, m)));
+    if (accept != 0xF) {
+      int lane = 0;
+      while (accept & (1 << lane))
+        ++lane;
+      return i + (size_t)lane;
+    }
+  }
 
-  __m256i result = _mm256_add_epi64(s0, rotl_avx2(s1, 11));
-  result = _mm256_xor_si256(result, _mm256_srli_epi64(result, 27));
-  result = mullo_epi64_avx2(result, _mm256_set1_epi64x(C3));
-  result = _mm256_xor_si256(result, _mm256_srli_epi64(result, 27));
+  return i + cromulent_bulk_ziggurat_scalar(words + i, nwords - i, t,
+                                            symmetric, dst + i);
+}
+
+// w * n for n < 2^32 from two 32x32-bit products: with w = wh * 2^32 + wl,
+// mid = wh * n + (wl * n >> 32) is the product shifted down by 32 bits, so
+// the slot is mid >> 32 and the coin (mid << 32) | (wl * n mod 2^32).
+void cromulent_bulk_alias_avx2(const uint64_t *words, size_t nwords,
+                               const cromulent_alias_entry *e, uint32_t n,
+                               uint32_t *dst) {
+  const __m256i vn = _mm256_set1_epi64x(n);
+  const __m256i flip = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+  const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  const long long *base = (const long long *)e;
+  size_t i = 0;
+
+  for (; i + 4 <= nwords; i += 4) {
+    const __m256i w = _mm256_loadu_si256((const __m256i *)(words + i));
+    const __m256i lo = _mm256_mul_epu32(w, vn);
+    const __m256i mid = _mm256_add_epi64(
+        _mm256_mul_epu32(_mm256_srli_epi64(w, 32), vn),
+        _mm256_srli_epi64(lo, 32));
+    const __m256i slot = _mm256_srli_epi64(mid, 32);
+    const __m256i coin =
+        _mm256_blend_epi32(lo, _mm256_slli_epi64(mid, 32), 0xAA);
+
+    // Entries are two words each: threshold at 2 * slot, alias after it.
+    const __m256i at = _mm256_slli_epi64(slot, 1);
+    const __m256i threshold = _mm256_i64gather_epi64(base, at, 8);
+    const __m256i alias = _mm256_i64gather_epi64(base + 1, at, 8);
+
+    // Unsigned coin < threshold, as a signed compare with the top bits flipped
+    const __m256i keep = _mm256_cmpgt_epi64(_mm256_xor_si256(threshold, flip),
+                                            _mm256_xor_si256(coin, flip));
+    const __m256i pick = _mm256_blendv_epi8(alias, slot, keep);
+    const __m256i packed = _mm256_permutevar8x32_epi32(pick, pack);
+    _mm_storeu_si128((__m128i *)(dst + i), _mm256_castsi256_si128(packed));
+  }
 
-  return result;
+  cromulent_bulk_alias_scalar(words + i, nwords - i, e, n, dst + i);
 }
 
 #endif // __AVX2__
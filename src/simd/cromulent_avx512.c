@@ -0,0 +1,234 @@
+// src/simd/cromulent_avx512.c
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+#include "cromulent.h"
+
+void cromulent_avx512_init(cromulent_avx512_state *state, uint64_t seed) {
+  uint64_t z = seed;
+  uint64_t buf[16];
+
+  for (int i = 0; i < 16; ++i)
+    buf[i] = cromulent_seed_step(&z);
+
+  state->s0 = _mm512_loadu_si512(buf);
+  state->s1 = _mm512_loadu_si512(buf + 8);
+}
+
+__m512i cromulent_avx512_next(cromulent_avx512_state *state) {
+  return cromulent_step_avx512(&state->s0, &state->s1);
+}
+
+void cromulent_avx512_next_u64(cromulent_avx512_state *state, uint64_t out[8]) {
+  _mm512_storeu_si512(out, cromulent_avx512_next(state));
+}
+
+// Sixteen lanes in two register pairs: vpmullq has a latency of about fifteen
+// cycles, so the second chain issues while the first waits on its multiplies.
+void cromulent_bulk_blocks_avx512(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                  size_t nblocks) {
+  __m512i a0 = _mm512_loadu_si512(s0 + 0);
+  __m512i a1 = _mm512_loadu_si512(s0 + 8);
+  __m512i b0 = _mm512_loadu_si512(s1 + 0);
+  __m512i b1 = _mm512_loadu_si512(s1 + 8);
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES) {
+    _mm512_storeu_si512(dst + 0, cromulent_step_avx512(&a0, &b0));
+    _mm512_storeu_si512(dst + 8, cromulent_step_avx512(&a1, &b1));
+  }
+
+  _mm512_storeu_si512(s0 + 0, a0);
+  _mm512_storeu_si512(s0 + 8, a1);
+  _mm512_storeu_si512(s1 + 0, b0);
+  _mm512_storeu_si512(s1 + 8, b1);
+}
+
+// cromulent_strong on the same two register pairs. Its multiplies, shifts and
+// rotates all issue on the same port, so more chains would not help.
+void cromulent_strong_blocks_avx512(uint64_t *a, uint64_t *b, uint64_t *dst,
+                                    size_t nblocks) {
+  __m512i a0 = _mm512_loadu_si512(a + 0);
+  __m512i a1 = _mm512_loadu_si512(a + 8);
+  __m512i b0 = _mm512_loadu_si512(b + 0);
+  __m512i b1 = _mm512_loadu_si512(b + 8);
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES) {
+    _mm512_storeu_si512(dst + 0, cromulent_strong_step_avx512(&a0, &b0));
+    _mm512_storeu_si512(dst + 8, cromulent_strong_step_avx512(&a1, &b1));
+  }
+
+  _mm512_storeu_si512(a + 0, a0);
+  _mm512_storeu_si512(a + 8, a1);
+  _mm512_storeu_si512(b + 0, b0);
+  _mm512_storeu_si512(b + 8, b1);
+}
+
+// Counter mode in two chains of eight lanes, like the bulk kernel. The
+// affine part of each counter steps by a constant, so the loop needs only the
+// four multiplies of the mixing.
+void cromulent_counter_words_avx512(uint64_t k0, uint64_t k1, uint64_t start,
+                                    uint64_t *dst, size_t n) {
+  uint64_t first[16];
+  for (int l = 0; l < 16; ++l)
+    first[l] = (start + (uint64_t)l) * C6 + k0;
+
+  const __m512i kd = _mm512_set1_epi64((long long)rotl(k1 * C2, 31));
+  const __m512i step = _mm512_set1_epi64((long long)(16 * C6));
+  __m512i x0 = _mm512_loadu_si512(first + 0);
+  __m512i x1 = _mm512_loadu_si512(first + 8);
+
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_si512(dst + i + 0, cromulent_at_avx512(x0, kd));
+    _mm512_storeu_si512(dst + i + 8, cromulent_at_avx512(x1, kd));
+    x0 = _mm512_add_epi64(x0, step);
+    x1 = _mm512_add_epi64(x1, step);
+  }
+  for (; i < n; ++i)
+    dst[i] = cromulent_at_word(k0, k1, start + i);
+}
+
+// AVX-512DQ converts 64-bit integers natively.
+void cromulent_bulk_doubles_avx512(uint64_t *s0, uint64_t *s1, double *dst,
+                                   size_t nblocks, uint64_t bias) {
+  const __m512i b = _mm512_set1_epi64((long long)bias);
+  const __m512d scale = _mm512_set1_pd(0x1.0p-53);
+  __m512i a0 = _mm512_loadu_si512(s0 + 0);
+  __m512i a1 = _mm512_loadu_si512(s0 + 8);
+  __m512i b0 = _mm512_loadu_si512(s1 + 0);
+  __m512i b1 = _mm512_loadu_si512(s1 + 8);
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES) {
+    const __m512i x0 = _mm512_add_epi64(
+        _mm512_srli_epi64(cromulent_step_avx512(&a0, &b0), 11), b);
+    const __m512i x1 = _mm512_add_epi64(
+        _mm512_srli_epi64(cromulent_step_avx512(&a1, &b1), 11), b);
+    _mm512_storeu_pd(dst + 0, _mm512_mul_pd(_mm512_cvtepu64_pd(x0), scale));
+    _mm512_storeu_pd(dst + 8, _mm512_mul_pd(_mm512_cvtepu64_pd(x1), scale));
+  }
+
+  _mm512_storeu_si512(s0 + 0, a0);
+  _mm512_storeu_si512(s0 + 8, a1);
+  _mm512_storeu_si512(s1 + 0, b0);
+  _mm512_storeu_si512(s1 + 8, b1);
+}
+
+void cromulent_bulk_floats_avx512(uint64_t *s0, uint64_t *s1, float *dst,
+                                  size_t nblocks, uint32_t bias) {
+  const __m512i b = _mm512_set1_epi32((int)bias);
+  const __m512 scale = _mm512_set1_ps(0x1.0p-24f);
+  __m512i a0 = _mm512_loadu_si512(s0 + 0);
+  __m512i a1 = _mm512_loadu_si512(s0 + 8);
+  __m512i b0 = _mm512_loadu_si512(s1 + 0);
+  __m512i b1 = _mm512_loadu_si512(s1 + 8);
+
+  for (size_t i = 0; i < nblocks; ++i, dst += 2 * CROMULENT_BULK_LANES) {
+    const __m512i x0 = _mm512_add_epi32(
+        _mm512_srli_epi32(cromulent_step_avx512(&a0, &b0), 8), b);
+    const __m512i x1 = _mm512_add_epi32(
+        _mm512_srli_epi32(cromulent_step_avx512(&a1, &b1), 8), b);
+    _mm512_storeu_ps(dst + 0, _mm512_mul_ps(_mm512_cvtepi32_ps(x0), scale));
+    _mm512_storeu_ps(dst + 16, _mm512_mul_ps(_mm512_cvtepi32_ps(x1), scale));
+  }
+
+  _mm512_storeu_si512(s0 + 0, a0);
+  _mm512_storeu_si512(s0 + 8, a1);
+  _mm512_storeu_si512(s1 + 0, b0);
+  _mm512_storeu_si512(s1 + 8, b1);
+}
+
+// Sixteen 32-bit draws per register; the AVX2 kernel's scheme with a native
+// unsigned compare.
+size_t cromulent_bulk_range32_avx512(const uint64_t *words, size_t nwords,
+                                     uint32_t n, uint32_t t, uint64_t *dst) {
+  const __m512i vn = _mm512_set1_epi64((long long)n);
+  const __m512i vt = _mm512_set1_epi32((int)t);
+  uint64_t *out = dst;
+
+  for (size_t i = 0; i < nwords; i += 8) {
+    const __m512i x = _mm512_loadu_si512(words + i);
+    const __m512i even = _mm512_mul_epu32(x, vn);
+    const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(x, 32), vn);
+
+    const __m512i lo =
+        _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+    if (_mm512_cmplt_epu32_mask(lo, vt) != 0) {
+      out += cromulent_range32_words(words + i, 8, n, t, out);
+      continue;
+    }
+
+    const __m512i hi =
+        _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd);
+    _mm512_storeu_si512(out, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(hi)));
+    _mm512_storeu_si512(out + 8,
+                        _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(hi, 1)));
+    out += 16;
+  }
+  return (size_t)(out - dst);
+}
+
+// The AVX2 ziggurat kernel on eight words, with native conversion and an
+// unsigned compare into a mask.
+size_t cromulent_bulk_ziggurat_avx512(const uint64_t *words, size_t nwords,
+                                      const cromulent_zig_table *t,
+                                      int symmetric, double *dst) {
+  const __m512i layer = _mm512_set1_epi64(0xff);
+  const __m512i sign = _mm512_set1_epi64(symmetric ? 0x100 : 0);
+  size_t i = 0;
+
+  for (; i + 8 <= nwords; i += 8) {
+    const __m512i w = _mm512_loadu_si512(words + i);
+    const __m512i idx = _mm512_and_si512(w, layer);
+    const __m512i m = _mm512_srli_epi64(w, 11);
+    const __m512i k = _mm512_i64gather_epi64(idx, t->k, 8);
+    const __m512d width = _mm512_i64gather_pd(idx, t->w, 8);
+
+    __m512d x = _mm512_mul_pd(_mm512_cvtepu64_pd(m), width);
+    x = _mm512_castsi512_pd(_mm512_xor_si512(
+        _mm512_castpd_si512(x),
+        _mm512_slli_epi64(_mm512_and_si512(w, sign), 55)));
+    _mm512_storeu_pd(dst + i, x);
+
+    const __mmask8 accept = _mm512_cmplt_epu64_mask(m, k);
+    if (accept != 0xFF) {
+      int lane = 0;
+      while (accept & (1 << lane))
+        ++lane;
+      return i + (size_t)lane;
+    }
+  }
+
+  return i + cromulent_bulk_ziggurat_scalar(words + i, nwords - i, t,
+                                            symmetric, dst + i);
+}
+
+// The slot / coin split of cromulent_bulk_alias_avx2, eight words at a time.
+void cromulent_bulk_alias_avx512(const uint64_t *words, size_t nwords,
+                                 const cromulent_alias_entry *e, uint32_t n,
+                                 uint32_t *dst) {
+  const __m512i vn = _mm512_set1_epi64(n);
+  const long long *base = (const long long *)e;
+  size_t i = 0;
+
+  for (; i + 8 <= nwords; i += 8) {
+    const __m512i w = _mm512_loadu_si512(words + i);
+    const __m512i lo = _mm512_mul_epu32(w, vn);
+    const __m512i mid = _mm512_add_epi64(
+        _mm512_mul_epu32(_mm512_srli_epi64(w, 32), vn),
+        _mm512_srli_epi64(lo, 32));
+    const __m512i slot = _mm512_srli_epi64(mid, 32);
+    const __m512i coin = _mm512_mask_blend_epi32(
+        0xAAAA, lo, _mm512_slli_epi64(mid, 32));
+
+    const __m512i at = _mm512_slli_epi64(slot, 1);
+    const __m512i threshold = _mm512_i64gather_epi64(at, base, 8);
+    const __m512i alias = _mm512_i64gather_epi64(at, base + 1, 8);
+
+    const __mmask8 keep = _mm512_cmplt_epu64_mask(coin, threshold);
+    const __m512i pick = _mm512_mask_blend_epi64(keep, alias, slot);
+    _mm256_storeu_si256((__m256i *)(dst + i), _mm512_cvtepi64_epi32(pick));
+  }
+
+  cromulent_bulk_alias_scalar(words + i, nwords - i, e, n, dst + i);
+}
+
+#endif // __AVX512F__ && __AVX512DQ__
@@ -0,0 +1,182 @@
+// src/simd/cromulent_neon.c
+//
+// NEON port of the multi-lane generators. The four-lane state reproduces
+// cromulent_avx2_init / cromulent_avx2_next exactly, so x86 and ARM nodes
+// produce bit-identical streams. With CROMULENT_NEON_EMULATION the same code
+// builds against tests/unit/neon_emu.h, a plain C model of the intrinsics, so
+// the lane parity tests run on any host.
+
+#if defined(CROMULENT_NEON_EMULATION)
+#include "neon_emu.h"
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(CROMULENT_NEON_EMULATION)
+#include "cromulent.h"
+
+// NEON shifts take immediates, so the rotate is a macro. vsriq inserts the
+// right-shifted bits into the left-shifted value in one instruction.
+#define ROTL_NEON(x, k) vsriq_n_u64(vshlq_n_u64((x), (k)), (x), 64 - (k))
+
+// 64-bit low multiply by a constant split into 32-bit halves: NEON has no
+// 64x64 multiply, but vmull/vmlal give 32x32->64 products.
+static inline uint64x2_t mullo_const_neon(uint64x2_t a, uint32x2_t b_lo,
+                                          uint32x2_t b_hi) {
+  const uint32x2_t a_lo = vmovn_u64(a);
+  const uint32x2_t a_hi = vshrn_n_u64(a, 32);
+  uint64x2_t cross = vmull_u32(a_lo, b_hi);
+  cross = vmlal_u32(cross, a_hi, b_lo);
+  return vmlal_u32(vshlq_n_u64(cross, 32), a_lo, b_lo);
+}
+
+#define CONST_LO(c) vdup_n_u32((uint32_t)(c))
+#define CONST_HI(c) vdup_n_u32((uint32_t)((c) >> 32))
+
+// One cromulent128 step on two lanes.
+static inline uint64x2_t cromulent_step_neon(uint64x2_t *s0, uint64x2_t *s1) {
+  const uint64x2_t a = *s0;
+  const uint64x2_t b = *s1;
+
+  *s0 = vaddq_u64(mullo_const_neon(a, CONST_LO(C6), CONST_HI(C6)), b);
+
+  uint64x2_t m = veorq_u64(a, vshrq_n_u64(a, 32));
+  m = mullo_const_neon(m, CONST_LO(MH3), CONST_HI(MH3));
+  m = veorq_u64(m, vshrq_n_u64(m, 32));
+  *s1 = vaddq_u64(ROTL_NEON(b, 31), m);
+
+  uint64x2_t result = vaddq_u64(a, ROTL_NEON(b, 11));
+  result = veorq_u64(result, vshrq_n_u64(result, 27));
+  result = mullo_const_neon(result, CONST_LO(C3), CONST_HI(C3));
+  result = veorq_u64(result, vshrq_n_u64(result, 27));
+  return result;
+}
+
+void cromulent_neon_init(cromulent_neon_state *state, uint64_t seed) {
+  uint64_t z = seed;
+
+  for (int i = 0; i < 4; ++i)
+    state->s0[i] = cromulent_seed_step(&z);
+  for (int i = 0; i < 4; ++i)
+    state->s1[i] = cromulent_seed_step(&z);
+}
+
+void cromulent_neon_next_u64(cromulent_neon_state *state, uint64_t out[4]) {
+  uint64x2_t a0 = vld1q_u64(state->s0), a1 = vld1q_u64(state->s0 + 2);
+  uint64x2_t b0 = vld1q_u64(state->s1), b1 = vld1q_u64(state->s1 + 2);
+
+  vst1q_u64(out, cromulent_step_neon(&a0, &b0));
+  vst1q_u64(out + 2, cromulent_step_neon(&a1, &b1));
+
+  vst1q_u64(state->s0, a0);
+  vst1q_u64(state->s0 + 2, a1);
+  vst1q_u64(state->s1, b0);
+  vst1q_u64(state->s1 + 2, b1);
+}
+
+// Sixteen lanes in eight register pairs: the multiply emulation is a long
+// dependency chain, and AArch64 has registers to spare for eight of them.
+void cromulent_bulk_blocks_neon(uint64_t *s0, uint64_t *s1, uint64_t *dst,
+                                size_t nblocks) {
+  uint64x2_t a[CROMULENT_BULK_LANES / 2], b[CROMULENT_BULK_LANES / 2];
+
+  for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+    a[r] = vld1q_u64(s0 + 2 * r);
+    b[r] = vld1q_u64(s1 + 2 * r);
+  }
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES)
+    for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r)
+      vst1q_u64(dst + 2 * r, cromulent_step_neon(&a[r], &b[r]));
+
+  for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+    vst1q_u64(s0 + 2 * r, a[r]);
+    vst1q_u64(s1 + 2 * r, b[r]);
+  }
+}
+
+// AArch64 converts 64-bit integers natively; the values are below 2^53, so
+// the conversion is exact.
+void cromulent_bulk_doubles_neon(uint64_t *s0, uint64_t *s1, double *dst,
+                                 size_t nblocks, uint64_t bias) {
+  const uint64x2_t add = vdupq_n_u64(bias);
+  const float64x2_t scale = vdupq_n_f64(0x1.0p-53);
+  uint64x2_t a[CROMULENT_BULK_LANES / 2], b[CROMULENT_BULK_LANES / 2];
+
+  for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+    a[r] = vld1q_u64(s0 + 2 * r);
+    b[r] = vld1q_u64(s1 + 2 * r);
+  }
+
+  for (size_t i = 0; i < nblocks; ++i, dst += CROMULENT_BULK_LANES)
+    for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+      const uint64x2_t x =
+          vaddq_u64(vshrq_n_u64(cromulent_step_neon(&a[r], &b[r]), 11), add);
+      vst1q_f64(dst + 2 * r, vmulq_f64(vcvtq_f64_u64(x), scale));
+    }
+
+  for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+    vst1q_u64(s0 + 2 * r, a[r]);
+    vst1q_u64(s1 + 2 * r, b[r]);
+  }
+}
+
+// Reinterpreting a word pair as four 32-bit lanes yields the low half of each
+// word first on little-endian AArch64.
+void cromulent_bulk_floats_neon(uint64_t *s0, uint64_t *s1, float *dst,
+                                size_t nblocks, uint32_t bias) {
+  const uint32x4_t add = vdupq_n_u32(bias);
+  const float32x4_t scale = vdupq_n_f32(0x1.0p-24f);
+  uint64x2_t a[CROMULENT_BULK_LANES / 2], b[CROMULENT_BULK_LANES / 2];
+
+  for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+    a[r] = vld1q_u64(s0 + 2 * r);
+    b[r] = vld1q_u64(s1 + 2 * r);
+  }
+
+  for (size_t i = 0; i < nblocks; ++i, dst += 2 * CROMULENT_BULK_LANES)
+    for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+      const uint32x4_t x = vaddq_u32(
+          vshrq_n_u32(vreinterpretq_u32_u64(cromulent_step_neon(&a[r], &b[r])),
+                      8),
+          add);
+      vst1q_f32(dst + 4 * r, vmulq_f32(vcvtq_f32_u32(x), scale));
+    }
+
+  for (int r = 0; r < CROMULENT_BULK_LANES / 2; ++r) {
+    vst1q_u64(s0 + 2 * r, a[r]);
+    vst1q_u64(s1 + 2 * r, b[r]);
+  }
+}
+
+// vmull_u32 gives the 32x32->64 products directly: one for the low halves and
+// one for the high halves of a word pair. A pair with any rejected draw is
+// redone by the scalar loop to keep the stream order.
+size_t cromulent_bulk_range32_neon(const uint64_t *words, size_t nwords,
+                                   uint32_t n, uint32_t t, uint64_t *dst) {
+  const uint32x2_t vn = vdup_n_u32(n);
+  const uint32x2_t vt = vdup_n_u32(t);
+  uint64_t *out = dst;
+
+  for (size_t i = 0; i < nwords; i += 2) {
+    const uint64x2_t x = vld1q_u64(words + i);
+    const uint64x2_t even = vmull_u32(vmovn_u64(x), vn);
+    const uint64x2_t odd = vmull_u32(vshrn_n_u64(x, 32), vn);
+
+    const uint32x2_t reject = vorr_u32(vclt_u32(vmovn_u64(even), vt),
+                                       vclt_u32(vmovn_u64(odd), vt));
+    if (vmaxv_u32(reject) != 0) {
+      out += cromulent_range32_words(words + i, 2, n, t, out);
+      continue;
+    }
+
+    const uint64x2_t hi_even = vshrq_n_u64(even, 32);
+    const uint64x2_t hi_odd = vshrq_n_u64(odd, 32);
+    vst1q_u64(out, vzip1q_u64(hi_even, hi_odd));
+    vst1q_u64(out + 2, vzip2q_u64(hi_even, hi_odd));
+    out += 4;
+  }
+  return (size_t)(out - dst);
+}
+
+#endif // __ARM_NEON || CROMULENT_NEON_EMULATION
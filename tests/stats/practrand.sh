@@ -1,5 +1,17 @@
 #!/bin/sh
+# Usage: tests/stats/practrand.sh [GENERATOR]
+#
+# Runs PractRand to 128TB on a cromulent-stream generator (default
+# cromulent128) and writes the report to tests/results/.
 set -e
 
-build/dump_raw | practrand/RNG_test stdin64 -tlmax 128TB -a -multithreaded |
-    tee tests/results/practrand128TB.txt
+gen=${1:-cromulent128}
+if [ "$gen" = cromulent128 ]; then
+    out=tests/results/practrand128TB.txt
+else
+    out=tests/results/practrand128TB-$gen.txt
+fi
+
+build/cromulent-stream --gen "$gen" --seed 0xDEADBEEF |
+    practrand/RNG_test stdin64 -tlmax 128TB -a -multithreaded |
+    tee "$out"
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Usage: tests/stats/rng_test_stub.sh stdin64 -tlmax N
+#
+# Stands in for PractRand's RNG_test in the cromulent-practrand tests. Reads
+# the stream to its end and reports its length the way RNG_test does. With
+# RNG_TEST_STUB_LIMIT set it reads that many bytes and then exits with status
+# 1, as a tester that crashed would.
+if [ -n "$RNG_TEST_STUB_LIMIT" ]; then
+    head -c "$RNG_TEST_STUB_LIMIT" >/dev/null
+    echo "stub stopped after $RNG_TEST_STUB_LIMIT bytes"
+    exit 1
+fi
+
+bytes=$(wc -c | tr -d ' ')
+echo "RNG_test stub: $*"
+echo "rng=RNG_stdin64, seed=unknown"
+awk -v b="$bytes" 'BEGIN {
+    printf "length= %d bytes (2^%.10g bytes), time= 0.0 seconds\n", b, log(b) / log(2)
+}'
+echo "  no anomalies in 1 test result(s)"
@@ -0,0 +1,239 @@
+// tests/unit/alias.c
+//
+// Unit tests for the alias-table sampler
+// Checks input validation, that the built table encodes the weights exactly,
+// that single and bulk draws follow the documented slot / coin split on every
+// backend, and the sampled frequencies.
+
+#include "cromulent.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define SEED 0x2545F4914F6CDD1DULL
+#define COUNT 5003
+#define CATEGORIES 1000
+#define SAMPLES 2000000
+
+static double weights[CATEGORIES];
+static cromulent_alias_entry entries[CATEGORIES];
+
+static void make_weights(void) {
+    // Uneven weights, with some zeros and one heavy category
+    for (int i = 0; i < CATEGORIES; i++)
+        weights[i] = (i % 7 == 3) ? 0.0 : 1.0 + (i * 37 % 101) / 10.0;
+    weights[500] = 900.0;
+}
+
+// Test that invalid weight arrays are rejected
+int test_alias_rejects() {
+    printf("Testing alias_init input validation... ");
+
+    cromulent_alias t;
+    const double zeros[3] = {0, 0, 0};
+    const double negative[3] = {1, -1, 1};
+    const double nan_weight[3] = {1, NAN, 1};
+    const double inf_weight[3] = {1, INFINITY, 1};
+    const double huge[2] = {1e308, 1e308};
+
+    CHECK(cromulent_alias_init(&t, entries, zeros, 0) == -1,
+          "Empty tables should be rejected");
+    CHECK(cromulent_alias_init(&t, entries, zeros, 3) == -1,
+          "All-zero weights should be rejected");
+    CHECK(cromulent_alias_init(&t, entries, negative, 3) == -1,
+          "Negative weights should be rejected");
+    CHECK(cromulent_alias_init(&t, entries, nan_weight, 3) == -1,
+          "NaN weights should be rejected");
+    CHECK(cromulent_alias_init(&t, entries, inf_weight, 3) == -1,
+          "Infinite weights should be rejected");
+    CHECK(cromulent_alias_init(&t, entries, huge, 2) == -1,
+          "Weights whose sum overflows should be rejected");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that the probability the table gives each category, summed over the
+// slots that can yield it, matches its weight
+int test_alias_table_exact() {
+    printf("Testing alias table probabilities... ");
+
+    cromulent_alias t;
+    make_weights();
+    CHECK(cromulent_alias_init(&t, entries, weights, CATEGORIES) == 0,
+          "Valid weights should be accepted");
+    CHECK(t.n == CATEGORIES && t.entries == entries,
+          "The table should use the caller's entries");
+
+    double sum = 0, mass[CATEGORIES] = {0};
+    for (int i = 0; i < CATEGORIES; i++)
+        sum += weights[i];
+    for (int i = 0; i < CATEGORIES; i++) {
+        const double keep = entries[i].threshold * 0x1.0p-64;
+        CHECK(entries[i].alias < CATEGORIES, "Aliases should be in range");
+        mass[i] += keep;
+        mass[entries[i].alias] += 1.0 - keep;
+    }
+    for (int i = 0; i < CATEGORIES; i++) {
+        const double expected = weights[i] / sum * CATEGORIES;
+        CHECK(fabs(mass[i] - expected) < 1e-9,
+              "Each category should get its share of the slots");
+        if (weights[i] == 0)
+            CHECK(mass[i] == 0, "Zero weights should never be drawn");
+    }
+
+    const double one = 3.0;
+    CHECK(cromulent_alias_init(&t, entries, &one, 1) == 0,
+          "A single category should be accepted");
+    cromulent_state st;
+    cromulent_init(&st, SEED);
+    for (int i = 0; i < 1000; i++)
+        CHECK(cromulent_alias_sample(&t, &st) == 0,
+              "A single category should always be drawn");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Model of one draw from a word, written from the documented split
+static uint32_t model_pick(const cromulent_alias *t, uint64_t w) {
+#ifdef __SIZEOF_INT128__
+    const __uint128_t m = (__uint128_t)w * t->n;
+    const uint64_t slot = (uint64_t)(m >> 64), coin = (uint64_t)m;
+#else
+    uint64_t slot, coin;
+    cromulent_mul_u64_fallback(w, t->n, &slot, &coin);
+#endif
+    return coin < t->entries[slot].threshold
+               ? (uint32_t)slot
+               : (uint32_t)t->entries[slot].alias;
+}
+
+static const cromulent_backend kBackends[] = {
+    CROMULENT_BACKEND_SCALAR,
+    CROMULENT_BACKEND_AVX2,
+    CROMULENT_BACKEND_AVX512,
+    CROMULENT_BACKEND_NEON,
+};
+
+// Test single draws against cromulent_next, and the bulk fill against the
+// fill_u64 stream on every backend, in one call and in uneven pieces
+int test_alias_matches_model() {
+    printf("Testing alias_sample/alias_fill against the model...");
+
+    static uint64_t stream[COUNT + 1];
+    static uint32_t expected[COUNT], actual[COUNT];
+    cromulent_alias t;
+    make_weights();
+    CHECK(cromulent_alias_init(&t, entries, weights, CATEGORIES) == 0,
+          "Valid weights should be accepted");
+
+    cromulent_state st, ref;
+    cromulent_init(&st, SEED);
+    cromulent_init(&ref, SEED);
+    for (int i = 0; i < COUNT; i++)
+        CHECK(cromulent_alias_sample(&t, &st) ==
+                  model_pick(&t, cromulent_next(&ref)),
+              "A sample should take exactly one cromulent_next draw");
+
+    cromulent_bulk_state bulk;
+    cromulent_bulk_init(&bulk, SEED);
+    cromulent_fill_u64(&bulk, stream, COUNT + 1);
+    for (int i = 0; i < COUNT; i++)
+        expected[i] = model_pick(&t, stream[i]);
+
+    const cromulent_backend original = cromulent_backend_active();
+    for (size_t b = 0; b < sizeof(kBackends) / sizeof(kBackends[0]); b++) {
+        if (cromulent_backend_select(kBackends[b]) != 0)
+            continue;
+        printf(" %s", cromulent_backend_name(kBackends[b]));
+
+        cromulent_bulk_init(&bulk, SEED);
+        cromulent_alias_fill(&t, &bulk, actual, COUNT);
+        CHECK(memcmp(expected, actual, sizeof(actual)) == 0,
+              "Bulk samples should match the model");
+        uint64_t next;
+        cromulent_fill_u64(&bulk, &next, 1);
+        CHECK(next == stream[COUNT], "Each sample should take one word");
+
+        static const size_t pieces[] = {1, 15, 16, 17, 300, 2, 1100};
+        cromulent_bulk_init(&bulk, SEED);
+        size_t done = 0;
+        for (size_t i = 0; done < COUNT; i = (i + 1) % 7) {
+            size_t take = pieces[i] < COUNT - done ? pieces[i] : COUNT - done;
+            cromulent_alias_fill(&t, &bulk, actual + done, take);
+            done += take;
+        }
+        CHECK(memcmp(expected, actual, sizeof(actual)) == 0,
+              "Chunked fills should match one large fill");
+    }
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
+// Test the sampled frequencies with a chi-square statistic
+int test_alias_frequencies() {
+    printf("Testing alias sample frequencies... ");
+
+    static uint32_t out[SAMPLES];
+    static size_t counts[CATEGORIES];
+    cromulent_alias t;
+    make_weights();
+    CHECK(cromulent_alias_init(&t, entries, weights, CATEGORIES) == 0,
+          "Valid weights should be accepted");
+
+    cromulent_bulk_state bulk;
+    cromulent_bulk_init(&bulk, SEED);
+    cromulent_alias_fill(&t, &bulk, out, SAMPLES);
+    for (size_t i = 0; i < SAMPLES; i++)
+        counts[out[i]]++;
+
+    double sum = 0, chi2 = 0;
+    int df = -1;
+    for (int i = 0; i < CATEGORIES; i++)
+        sum += weights[i];
+    for (int i = 0; i < CATEGORIES; i++) {
+        if (weights[i] == 0) {
+            CHECK(counts[i] == 0, "Zero weights should never be drawn");
+            continue;
+        }
+        const double e = SAMPLES * weights[i] / sum;
+        chi2 += (counts[i] - e) * (counts[i] - e) / e;
+        df++;
+    }
+    // Mean df, standard deviation sqrt(2 df); allow five of them
+    CHECK(chi2 < df + 5 * sqrt(2.0 * df),
+          "Frequencies should follow the weights");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG alias table tests\n");
+
+    int result = 0;
+    result |= test_alias_rejects();
+    result |= test_alias_table_exact();
+    result |= test_alias_matches_model();
+    result |= test_alias_frequencies();
+
+    if (result == 0) {
+        printf("All alias table tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
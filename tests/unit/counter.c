@@ -0,0 +1,149 @@
+// tests/unit/counter.c
+//
+// Unit tests for the counter-based mode
+// Pins the stream to known values, checks that cromulent_at_range and the
+// cursor give cromulent_at's words on every backend for any start, length and
+// split, and that counters and keys do not collide.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define KEY 0xDEADBEEFULL
+#define WORDS 4099
+
+static const cromulent_backend kBackends[] = {
+    CROMULENT_BACKEND_SCALAR,
+    CROMULENT_BACKEND_AVX2,
+    CROMULENT_BACKEND_AVX512,
+    CROMULENT_BACKEND_NEON,
+};
+
+#define BACKEND_COUNT (sizeof(kBackends) / sizeof(kBackends[0]))
+
+static int compare_u64(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Test that the stream does not change between releases
+int test_at_known_values() {
+    printf("Testing cromulent_at against known values... ");
+
+    const uint64_t counters[] = {0, 1, 2, 1000000, UINT64_MAX};
+    const uint64_t expected[2][5] = {
+        {0xa719344db29c055fULL, 0x9fa19f713f38eaf5ULL, 0xe699f373afdda31bULL,
+         0xaa4b64347c45fccbULL, 0x0d4b245601da9e85ULL},
+        {0xec0c0f00e8eefde6ULL, 0xbef0a2ba6ce77151ULL, 0xe0343756082e3212ULL,
+         0x0eb887a6c2f01191ULL, 0xa2e3fc410990feb5ULL},
+    };
+
+    for (int i = 0; i < 5; i++) {
+        CHECK(cromulent_at(0, counters[i]) == expected[0][i],
+              "Output does not match expected value for key 0");
+        CHECK(cromulent_at(KEY, counters[i]) == expected[1][i],
+              "Output does not match expected value");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that ranges and the cursor are cromulent_at on every backend, including
+// ranges that wrap past counter 2^64 - 1 and ranges split at arbitrary points
+int test_at_range_backends() {
+    printf("Testing cromulent_at_range on every backend...");
+
+    static uint64_t expected[WORDS], actual[WORDS];
+    static const uint64_t starts[] = {0, 1, 12345, UINT64_MAX - 100};
+    static const size_t pieces[] = {1, 15, 16, 17, 3, 100, 1000};
+    const cromulent_backend original = cromulent_backend_active();
+
+    for (size_t b = 0; b < BACKEND_COUNT; b++) {
+        if (cromulent_backend_select(kBackends[b]) != 0)
+            continue;
+        printf(" %s", cromulent_backend_name(kBackends[b]));
+
+        for (size_t s = 0; s < sizeof starts / sizeof starts[0]; s++) {
+            for (size_t i = 0; i < WORDS; i++)
+                expected[i] = cromulent_at(KEY, starts[s] + i);
+
+            cromulent_at_range(KEY, starts[s], actual, WORDS);
+            CHECK(memcmp(actual, expected, sizeof actual) == 0,
+                  "A range should hold the words of its counters");
+
+            memset(actual, 0, sizeof actual);
+            size_t done = 0;
+            for (size_t i = 0; done < WORDS; i = (i + 1) % 7) {
+                const size_t take = pieces[i] < WORDS - done
+                                        ? pieces[i]
+                                        : WORDS - done;
+                cromulent_at_range(KEY, starts[s] + done, actual + done, take);
+                done += take;
+            }
+            CHECK(memcmp(actual, expected, sizeof actual) == 0,
+                  "Slices filled separately should form the same range");
+
+            memset(actual, 0, sizeof actual);
+            cromulent_at_state st;
+            cromulent_at_init(&st, KEY);
+            st.counter = starts[s];
+            cromulent_at_fill(&st, actual, 1000);
+            for (size_t i = 1000; i < WORDS; i++)
+                actual[i] = cromulent_at_next(&st);
+            CHECK(memcmp(actual, expected, sizeof actual) == 0,
+                  "The cursor should walk the same stream after a seek");
+            CHECK(st.counter == starts[s] + WORDS,
+                  "The cursor should advance by the words it produced");
+        }
+    }
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
+// Test that a stream has no repeated words and that nearby keys do not share
+// words, as far as a sort of a few thousand of each can tell
+int test_at_distinct() {
+    printf("Testing that counters and keys do not collide... ");
+
+    enum { KEYS = 4, PER_KEY = WORDS };
+    static uint64_t words[KEYS * PER_KEY];
+    for (uint64_t k = 0; k < KEYS; k++)
+        cromulent_at_range(KEY + k, 0, words + k * PER_KEY, PER_KEY);
+
+    qsort(words, KEYS * PER_KEY, sizeof words[0], compare_u64);
+    for (size_t i = 1; i < KEYS * PER_KEY; i++)
+        CHECK(words[i] != words[i - 1], "No two words should be equal");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent counter-mode tests\n");
+
+    int result = 0;
+    result |= test_at_known_values();
+    result |= test_at_range_backends();
+    result |= test_at_distinct();
+
+    if (result == 0) {
+        printf("All counter-mode tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
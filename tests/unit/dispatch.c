@@ -0,0 +1,174 @@
+// tests/unit/dispatch.c
+//
+// Unit tests for runtime backend dispatch
+// Every backend the CPU supports must produce the identical bulk stream, and
+// the AVX2 and AVX-512 entry points must reproduce the scalar generator
+// lane-for-lane.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define WORDS 1031
+#define SEED 0xFEDCBA9876543210ULL
+
+static const cromulent_backend kBackends[] = {
+    CROMULENT_BACKEND_SCALAR,
+    CROMULENT_BACKEND_AVX2,
+    CROMULENT_BACKEND_AVX512,
+    CROMULENT_BACKEND_NEON,
+};
+
+#define BACKEND_COUNT (sizeof(kBackends) / sizeof(kBackends[0]))
+
+// Test that backend names round-trip and the scalar backend always exists
+int test_backend_names() {
+    printf("Testing backend names... ");
+
+    CHECK(strcmp(cromulent_backend_name(CROMULENT_BACKEND_SCALAR), "scalar") == 0,
+          "Scalar backend should be named scalar");
+    CHECK(strcmp(cromulent_backend_name(CROMULENT_BACKEND_AVX2), "avx2") == 0,
+          "AVX2 backend should be named avx2");
+    CHECK(strcmp(cromulent_backend_name(CROMULENT_BACKEND_AVX512), "avx512") == 0,
+          "AVX-512 backend should be named avx512");
+    CHECK(strcmp(cromulent_backend_name(CROMULENT_BACKEND_NEON), "neon") == 0,
+          "NEON backend should be named neon");
+    CHECK(cromulent_backend_name((cromulent_backend)99) == NULL,
+          "Unknown backends should have no name");
+    CHECK(cromulent_backend_supported(CROMULENT_BACKEND_SCALAR),
+          "Scalar backend should always be supported");
+    CHECK(cromulent_backend_supported(cromulent_backend_active()),
+          "Active backend should be supported");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that every supported backend yields the same bulk stream
+int test_backends_agree() {
+    printf("Testing bulk stream parity across backends...");
+
+    static uint64_t expected[WORDS], actual[WORDS];
+    const cromulent_backend original = cromulent_backend_active();
+
+    CHECK(cromulent_backend_select(CROMULENT_BACKEND_SCALAR) == 0,
+          "Selecting the scalar backend should succeed");
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+    cromulent_fill_u64(&st, expected, WORDS);
+
+    for (size_t i = 0; i < BACKEND_COUNT; i++) {
+        if (cromulent_backend_select(kBackends[i]) != 0) {
+            CHECK(!cromulent_backend_supported(kBackends[i]),
+                  "Selecting a supported backend should succeed");
+            continue;
+        }
+        printf(" %s", cromulent_backend_name(kBackends[i]));
+        CHECK(cromulent_backend_active() == kBackends[i],
+              "Selected backend should become active");
+
+        cromulent_bulk_init(&st, SEED);
+        cromulent_fill_u64(&st, actual, WORDS);
+        CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+              "Backend should match the scalar bulk stream");
+    }
+
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+// Test that cromulent_avx2_next_u64 runs four scalar generators in lock-step
+int test_avx2_lanes() {
+    printf("Testing AVX2 lanes against cromulent_next... ");
+
+    if (!cromulent_backend_supported(CROMULENT_BACKEND_AVX2)) {
+        printf("SKIPPED (no AVX2)\n");
+        return 0;
+    }
+
+    cromulent_state lanes[4];
+    uint64_t z = SEED;
+    for (int i = 0; i < 4; i++)
+        lanes[i].s0 = cromulent_seed_step(&z);
+    for (int i = 0; i < 4; i++)
+        lanes[i].s1 = cromulent_seed_step(&z);
+
+    cromulent_avx2_state st;
+    cromulent_avx2_init(&st, SEED);
+
+    for (int step = 0; step < 1000; step++) {
+        uint64_t out[4];
+        cromulent_avx2_next_u64(&st, out);
+        for (int i = 0; i < 4; i++)
+            CHECK(out[i] == cromulent_next(&lanes[i]),
+                  "AVX2 lane should match the scalar generator");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that cromulent_avx512_next_u64 runs eight scalar generators in lock-step
+int test_avx512_lanes() {
+    printf("Testing AVX-512 lanes against cromulent_next... ");
+
+    if (!cromulent_backend_supported(CROMULENT_BACKEND_AVX512)) {
+        printf("SKIPPED (no AVX-512)\n");
+        return 0;
+    }
+
+    cromulent_state lanes[8];
+    uint64_t z = SEED;
+    for (int i = 0; i < 8; i++)
+        lanes[i].s0 = cromulent_seed_step(&z);
+    for (int i = 0; i < 8; i++)
+        lanes[i].s1 = cromulent_seed_step(&z);
+
+    cromulent_avx512_state st;
+    cromulent_avx512_init(&st, SEED);
+
+    for (int step = 0; step < 1000; step++) {
+        uint64_t out[8];
+        cromulent_avx512_next_u64(&st, out);
+        for (int i = 0; i < 8; i++)
+            CHECK(out[i] == cromulent_next(&lanes[i]),
+                  "AVX-512 lane should match the scalar generator");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+#endif
+
+int main() {
+    printf("Running Cromulent PRNG dispatch tests\n");
+
+    int result = 0;
+    result |= test_backend_names();
+    result |= test_backends_agree();
+#if defined(__x86_64__) || defined(_M_X64)
+    result |= test_avx2_lanes();
+    result |= test_avx512_lanes();
+#endif
+
+    if (result == 0) {
+        printf("All dispatch tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,445 @@
+// tests/unit/fill.c
+//
+// Unit tests for the bulk fill API (cromulent_fill_u64 / cromulent_fill_bytes,
+// the double / float fills and cromulent_fill_range)
+// Verifies the multi-lane stream against cromulent_next lane-for-lane and
+// checks that splitting a fill across calls never changes the output. The
+// floating-point and bounded fills must be exact functions of that stream on
+// every backend.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define WORDS 4099
+#define SEED 0x0123456789ABCDEFULL
+
+// Reference model: CROMULENT_BULK_LANES scalar generators seeded from one
+// SplitMix64 sequence, read step-major.
+static void reference_stream(uint64_t seed, uint64_t *out, size_t n) {
+    cromulent_state lanes[CROMULENT_BULK_LANES];
+    uint64_t z = seed;
+
+    for (int i = 0; i < CROMULENT_BULK_LANES; i++)
+        lanes[i].s0 = cromulent_seed_step(&z);
+    for (int i = 0; i < CROMULENT_BULK_LANES; i++)
+        lanes[i].s1 = cromulent_seed_step(&z);
+
+    for (size_t i = 0; i < n; i++)
+        out[i] = cromulent_next(&lanes[i % CROMULENT_BULK_LANES]);
+}
+
+// Test that the bulk stream matches the scalar generator lane-for-lane
+int test_fill_matches_reference() {
+    printf("Testing fill_u64 against scalar lanes... ");
+
+    static uint64_t expected[WORDS], actual[WORDS];
+    reference_stream(SEED, expected, WORDS);
+
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+    cromulent_fill_u64(&st, actual, WORDS);
+
+    CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+          "Bulk stream should match the scalar lanes");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that arbitrary chunking produces the same words as one large fill
+int test_fill_u64_chunking() {
+    printf("Testing fill_u64 chunking... ");
+
+    static uint64_t expected[WORDS], actual[WORDS];
+    reference_stream(SEED, expected, WORDS);
+
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+
+    const size_t chunks[] = {1, 0, 3, 15, 16, 17, 31, 100, 5, 1000, 7};
+    size_t done = 0;
+    for (size_t i = 0; done < WORDS; i = (i + 1) % (sizeof(chunks) / sizeof(chunks[0]))) {
+        size_t n = chunks[i];
+        if (n > WORDS - done)
+            n = WORDS - done;
+        cromulent_fill_u64(&st, actual + done, n);
+        done += n;
+    }
+
+    CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+          "Chunked fills should concatenate to the same stream");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that fill_bytes yields the little-endian encoding of the word stream,
+// for unaligned destinations and odd lengths
+int test_fill_bytes_layout() {
+    printf("Testing fill_bytes layout and alignment... ");
+
+    static uint64_t words[WORDS];
+    static uint8_t expected[WORDS * 8], storage[WORDS * 8 + 1];
+    reference_stream(SEED, words, WORDS);
+    for (size_t i = 0; i < WORDS; i++)
+        for (int b = 0; b < 8; b++)
+            expected[8 * i + b] = (uint8_t)(words[i] >> (8 * b));
+
+    for (size_t offset = 0; offset < 2; offset++) {
+        uint8_t *actual = storage + offset;
+        memset(storage, 0, sizeof(storage));
+
+        cromulent_bulk_state st;
+        cromulent_bulk_init(&st, SEED);
+
+        const size_t chunks[] = {3, 125, 1, 129, 4096, 255, 8, 7};
+        size_t done = 0;
+        for (size_t i = 0; done < sizeof(expected); i = (i + 1) % 8) {
+            size_t n = chunks[i];
+            if (n > sizeof(expected) - done)
+                n = sizeof(expected) - done;
+            cromulent_fill_bytes(&st, actual + done, n);
+            done += n;
+        }
+
+        CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+              "Byte stream should be the little-endian word stream");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that fill_u64 after a partial word resumes on the next word boundary
+int test_fill_mixed() {
+    printf("Testing fill_u64 after fill_bytes... ");
+
+    uint64_t expected[64];
+    reference_stream(SEED, expected, 64);
+
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+
+    uint8_t bytes[3];
+    cromulent_fill_bytes(&st, bytes, sizeof(bytes));
+
+    uint64_t actual[63];
+    cromulent_fill_u64(&st, actual, 63);
+
+    CHECK(memcmp(expected + 1, actual, sizeof(actual)) == 0,
+          "fill_u64 should skip the rest of a partly used word");
+
+    printf("OK\n");
+    return 0;
+}
+
+static const cromulent_backend kBackends[] = {
+    CROMULENT_BACKEND_SCALAR,
+    CROMULENT_BACKEND_AVX2,
+    CROMULENT_BACKEND_AVX512,
+    CROMULENT_BACKEND_NEON,
+};
+
+#define BACKEND_COUNT (sizeof(kBackends) / sizeof(kBackends[0]))
+
+// Fill `n` values in uneven pieces, to cross the buffered-block paths
+static void fill_double_pieces(cromulent_bulk_state *st, double *dst, size_t n,
+                               int oc) {
+    static const size_t pieces[] = {1, 15, 16, 17, 3, 100, 1000};
+    size_t done = 0;
+    for (size_t i = 0; done < n; i = (i + 1) % 7) {
+        size_t take = pieces[i] < n - done ? pieces[i] : n - done;
+        if (oc)
+            cromulent_fill_double_oc(st, dst + done, take);
+        else
+            cromulent_fill_double(st, dst + done, take);
+        done += take;
+    }
+}
+
+static void fill_float_pieces(cromulent_bulk_state *st, float *dst, size_t n,
+                              int oc) {
+    static const size_t pieces[] = {1, 31, 32, 33, 5, 200, 2000};
+    size_t done = 0;
+    for (size_t i = 0; done < n; i = (i + 1) % 7) {
+        size_t take = pieces[i] < n - done ? pieces[i] : n - done;
+        if (oc)
+            cromulent_fill_float_oc(st, dst + done, take);
+        else
+            cromulent_fill_float(st, dst + done, take);
+        done += take;
+    }
+}
+
+// Test that double / float fills are the exact conversion of the word stream
+// on every supported backend, in one call and in uneven pieces
+int test_fill_real_exact() {
+    printf("Testing fill_double/fill_float conversions...");
+
+    static uint64_t words[WORDS];
+    static double expected_d[WORDS], actual_d[WORDS];
+    static float expected_f[2 * WORDS], actual_f[2 * WORDS];
+    reference_stream(SEED, words, WORDS);
+
+    const cromulent_backend original = cromulent_backend_active();
+    for (size_t b = 0; b < BACKEND_COUNT; b++) {
+        if (cromulent_backend_select(kBackends[b]) != 0)
+            continue;
+        printf(" %s", cromulent_backend_name(kBackends[b]));
+
+        for (int oc = 0; oc <= 1; oc++) {
+            for (size_t i = 0; i < WORDS; i++) {
+                expected_d[i] = (double)((words[i] >> 11) + oc) * 0x1.0p-53;
+                expected_f[2 * i] =
+                    (float)(((uint32_t)words[i] >> 8) + oc) * 0x1.0p-24f;
+                expected_f[2 * i + 1] =
+                    (float)((uint32_t)(words[i] >> 40) + oc) * 0x1.0p-24f;
+            }
+
+            cromulent_bulk_state st;
+            cromulent_bulk_init(&st, SEED);
+            if (oc)
+                cromulent_fill_double_oc(&st, actual_d, WORDS);
+            else
+                cromulent_fill_double(&st, actual_d, WORDS);
+            CHECK(memcmp(expected_d, actual_d, sizeof(actual_d)) == 0,
+                  "fill_double should convert the bulk stream exactly");
+
+            cromulent_bulk_init(&st, SEED);
+            fill_double_pieces(&st, actual_d, WORDS, oc);
+            CHECK(memcmp(expected_d, actual_d, sizeof(actual_d)) == 0,
+                  "Chunked fill_double should match one large fill");
+
+            cromulent_bulk_init(&st, SEED);
+            if (oc)
+                cromulent_fill_float_oc(&st, actual_f, 2 * WORDS);
+            else
+                cromulent_fill_float(&st, actual_f, 2 * WORDS);
+            CHECK(memcmp(expected_f, actual_f, sizeof(actual_f)) == 0,
+                  "fill_float should convert both halves of each word");
+
+            cromulent_bulk_init(&st, SEED);
+            fill_float_pieces(&st, actual_f, 2 * WORDS, oc);
+            CHECK(memcmp(expected_f, actual_f, sizeof(actual_f)) == 0,
+                  "Chunked fill_float should match one large fill");
+        }
+    }
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
+// Test the stream position shared between word, byte and float fills
+int test_fill_real_mixed() {
+    printf("Testing float/double fills mixed with other fills... ");
+
+    uint64_t words[8];
+    reference_stream(SEED, words, 8);
+
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+
+    // One float uses the low half of word 0; the next float its high half
+    float f[3];
+    cromulent_fill_float(&st, f, 1);
+    uint8_t bytes[4];
+    cromulent_fill_bytes(&st, bytes, sizeof(bytes));
+    CHECK(bytes[0] == (uint8_t)(words[0] >> 32),
+          "A float should consume exactly four bytes");
+
+    // A double skips the rest of a partly used word
+    cromulent_fill_float(&st, f, 1);
+    double d;
+    cromulent_fill_double(&st, &d, 1);
+    CHECK(d == (double)(words[2] >> 11) * 0x1.0p-53,
+          "fill_double should start on a word boundary");
+
+    // Floats resume on a half-word boundary after bytes
+    cromulent_fill_bytes(&st, bytes, 1);
+    cromulent_fill_float(&st, f, 3);
+    CHECK(f[0] == (float)((uint32_t)(words[3] >> 40)) * 0x1.0p-24f,
+          "fill_float should skip the rest of a partly used half");
+    CHECK(f[1] == (float)((uint32_t)words[4] >> 8) * 0x1.0p-24f,
+          "fill_float should continue with the next word");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test the ranges of the [0, 1) and (0, 1] variants
+int test_fill_real_bounds() {
+    printf("Testing fill_double/fill_float bounds... ");
+
+    static double d[WORDS];
+    static float f[2 * WORDS];
+    cromulent_bulk_state st;
+
+    cromulent_bulk_init(&st, SEED);
+    cromulent_fill_double(&st, d, WORDS);
+    cromulent_fill_float(&st, f, 2 * WORDS);
+    for (size_t i = 0; i < WORDS; i++)
+        CHECK(d[i] >= 0.0 && d[i] < 1.0, "fill_double should be in [0, 1)");
+    for (size_t i = 0; i < 2 * WORDS; i++)
+        CHECK(f[i] >= 0.0f && f[i] < 1.0f, "fill_float should be in [0, 1)");
+
+    cromulent_fill_double_oc(&st, d, WORDS);
+    cromulent_fill_float_oc(&st, f, 2 * WORDS);
+    for (size_t i = 0; i < WORDS; i++)
+        CHECK(d[i] > 0.0 && d[i] <= 1.0, "fill_double_oc should be in (0, 1]");
+    for (size_t i = 0; i < 2 * WORDS; i++)
+        CHECK(f[i] > 0.0f && f[i] <= 1.0f, "fill_float_oc should be in (0, 1]");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Reference model of cromulent_fill_range: one draw per 32-bit half below
+// 2^32, per word above, keeping Lemire's multiply-shift unless rejected.
+static size_t reference_range(const uint64_t *words, size_t nwords, uint64_t n,
+                              uint64_t *out, size_t count) {
+    size_t kept = 0;
+    if (n <= UINT32_MAX) {
+        const uint64_t t = ((1ULL << 32) - n) % n;
+        for (size_t i = 0; i < 2 * nwords && kept < count; i++) {
+            const uint64_t m = (uint32_t)(words[i / 2] >> (32 * (i % 2))) * n;
+            if ((m & 0xffffffffULL) >= t)
+                out[kept++] = m >> 32;
+        }
+    } else {
+        const uint64_t t = (0 - n) % n;
+        for (size_t i = 0; i < nwords && kept < count; i++) {
+            uint64_t hi, lo;
+            cromulent_mul_u64_fallback(words[i], n, &hi, &lo);
+            if (lo >= t)
+                out[kept++] = hi;
+        }
+    }
+    return kept;
+}
+
+static void fill_range_pieces(cromulent_bulk_state *st, uint64_t n,
+                              uint64_t *dst, size_t count) {
+    static const size_t pieces[] = {1, 31, 32, 33, 5, 200, 2000, 16};
+    size_t done = 0;
+    for (size_t i = 0; done < count; i = (i + 1) % 8) {
+        size_t take = pieces[i] < count - done ? pieces[i] : count - done;
+        cromulent_fill_range(st, n, dst + done, take);
+        done += take;
+    }
+}
+
+// Test that fill_range keeps exactly the draws the reference model keeps on
+// every supported backend, for bounds with and without rejections
+int test_fill_range_exact() {
+    printf("Testing fill_range against Lemire's method...");
+
+    static const uint64_t bounds[] = {
+        1, 2, 6, 1000003, (1ULL << 31) + 1, UINT32_MAX,
+        1ULL << 32, (1ULL << 32) + 1, 1000000000000ULL, (1ULL << 63) + 1,
+        UINT64_MAX,
+    };
+    static uint64_t words[WORDS], expected[WORDS], actual[WORDS];
+    reference_stream(SEED, words, WORDS);
+
+    const cromulent_backend original = cromulent_backend_active();
+    for (size_t b = 0; b < BACKEND_COUNT; b++) {
+        if (cromulent_backend_select(kBackends[b]) != 0)
+            continue;
+        printf(" %s", cromulent_backend_name(kBackends[b]));
+
+        for (size_t k = 0; k < sizeof(bounds) / sizeof(bounds[0]); k++) {
+            // Half of the words always leaves enough accepted draws
+            const size_t count =
+                reference_range(words, WORDS, bounds[k], expected, WORDS / 2);
+            CHECK(count == WORDS / 2, "Reference should yield enough draws");
+
+            cromulent_bulk_state st;
+            cromulent_bulk_init(&st, SEED);
+            cromulent_fill_range(&st, bounds[k], actual, count);
+            CHECK(memcmp(expected, actual, count * sizeof(uint64_t)) == 0,
+                  "fill_range should match the reference draws");
+
+            cromulent_bulk_init(&st, SEED);
+            fill_range_pieces(&st, bounds[k], actual, count);
+            CHECK(memcmp(expected, actual, count * sizeof(uint64_t)) == 0,
+                  "Chunked fill_range should match one large fill");
+
+            for (size_t i = 0; i < count; i++)
+                CHECK(actual[i] < bounds[k], "fill_range should be below n");
+        }
+    }
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
+// Test n == 0 and the stream position shared with the other fills
+int test_fill_range_mixed() {
+    printf("Testing fill_range with n = 0 and mixed fills... ");
+
+    uint64_t words[8];
+    reference_stream(SEED, words, 8);
+
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+
+    uint64_t r[4] = {1, 1, 1, 1};
+    cromulent_fill_range(&st, 0, r, 4);
+    CHECK(r[0] == 0 && r[3] == 0, "n == 0 should fill zeros");
+
+    // Bounds below 2^32 consume one half per draw, larger ones whole words
+    cromulent_fill_range(&st, 1ULL << 31, r, 1);
+    CHECK(r[0] == ((uint32_t)words[0] >> 1),
+          "The first draw should come from the low half of word 0");
+    cromulent_fill_range(&st, 1ULL << 31, r, 1);
+    CHECK(r[0] == (words[0] >> 33),
+          "The second draw should come from the high half of word 0");
+    cromulent_fill_range(&st, 1ULL << 40, r, 1);
+    CHECK(r[0] == (words[1] >> 24),
+          "A 64-bit draw should take the next word");
+    float f;
+    cromulent_fill_float(&st, &f, 1);
+    cromulent_fill_range(&st, 1ULL << 40, r, 1);
+    CHECK(r[0] == (words[3] >> 24),
+          "A 64-bit draw should skip a partly used word");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG fill tests\n");
+
+    int result = 0;
+    result |= test_fill_matches_reference();
+    result |= test_fill_u64_chunking();
+    result |= test_fill_bytes_layout();
+    result |= test_fill_mixed();
+    result |= test_fill_real_exact();
+    result |= test_fill_real_mixed();
+    result |= test_fill_real_bounds();
+    result |= test_fill_range_exact();
+    result |= test_fill_range_mixed();
+
+    if (result == 0) {
+        printf("All fill tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,183 @@
+// tests/unit/neon.c
+//
+// Unit tests for the NEON kernels
+// On ARM this exercises the real intrinsics; elsewhere the same source is
+// built against neon_emu.h. Either way the four-lane NEON stream must match
+// the scalar generator lane-for-lane, and the AVX2 stream when the CPU has it.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define STEPS 1000
+#define SEED 0x0F1E2D3C4B5A6978ULL
+
+// Test that each NEON lane matches a scalar generator
+int test_neon_lanes() {
+    printf("Testing NEON lanes against cromulent_next... ");
+
+    cromulent_state lanes[4];
+    uint64_t z = SEED;
+    for (int i = 0; i < 4; i++)
+        lanes[i].s0 = cromulent_seed_step(&z);
+    for (int i = 0; i < 4; i++)
+        lanes[i].s1 = cromulent_seed_step(&z);
+
+    cromulent_neon_state st;
+    cromulent_neon_init(&st, SEED);
+
+    for (int step = 0; step < STEPS; step++) {
+        uint64_t out[4];
+        cromulent_neon_next_u64(&st, out);
+        for (int i = 0; i < 4; i++)
+            CHECK(out[i] == cromulent_next(&lanes[i]),
+                  "NEON lane should match the scalar generator");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that the NEON and AVX2 generators produce the same stream
+int test_neon_matches_avx2() {
+    printf("Testing NEON stream against AVX2... ");
+
+#if defined(__x86_64__) || defined(_M_X64)
+    if (!cromulent_backend_supported(CROMULENT_BACKEND_AVX2)) {
+        printf("SKIPPED (no AVX2)\n");
+        return 0;
+    }
+
+    cromulent_neon_state neon;
+    cromulent_avx2_state avx2;
+    cromulent_neon_init(&neon, SEED);
+    cromulent_avx2_init(&avx2, SEED);
+
+    for (int step = 0; step < STEPS; step++) {
+        uint64_t a[4], b[4];
+        cromulent_neon_next_u64(&neon, a);
+        cromulent_avx2_next_u64(&avx2, b);
+        CHECK(memcmp(a, b, sizeof(a)) == 0,
+              "NEON and AVX2 streams should be bit-identical");
+    }
+
+    printf("OK\n");
+#else
+    printf("SKIPPED (not x86_64)\n");
+#endif
+    return 0;
+}
+
+// Test that the NEON bulk kernel matches the scalar bulk kernel
+int test_neon_bulk_kernel() {
+    printf("Testing NEON bulk kernel against scalar kernel... ");
+
+    cromulent_bulk_state a, b;
+    cromulent_bulk_init(&a, SEED);
+    cromulent_bulk_init(&b, SEED);
+
+    static uint64_t expected[64 * CROMULENT_BULK_LANES];
+    static uint64_t actual[64 * CROMULENT_BULK_LANES];
+    for (int round = 0; round < 4; round++) {
+        cromulent_bulk_blocks_scalar(a.s0, a.s1, expected, 64);
+        cromulent_bulk_blocks_neon(b.s0, b.s1, actual, 64);
+        CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+              "NEON bulk output should match the scalar kernel");
+        CHECK(memcmp(a.s0, b.s0, sizeof(a.s0)) == 0 &&
+              memcmp(a.s1, b.s1, sizeof(a.s1)) == 0,
+              "NEON bulk kernel should leave the same lane state");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that the NEON conversion kernels match the scalar ones bit-for-bit
+int test_neon_real_kernels() {
+    printf("Testing NEON double/float kernels against scalar kernels... ");
+
+    static double expected_d[16 * CROMULENT_BULK_LANES];
+    static double actual_d[16 * CROMULENT_BULK_LANES];
+    static float expected_f[32 * CROMULENT_BULK_LANES];
+    static float actual_f[32 * CROMULENT_BULK_LANES];
+
+    for (uint32_t bias = 0; bias <= 1; bias++) {
+        cromulent_bulk_state a, b;
+        cromulent_bulk_init(&a, SEED);
+        cromulent_bulk_init(&b, SEED);
+
+        cromulent_bulk_doubles_scalar(a.s0, a.s1, expected_d, 16, bias);
+        cromulent_bulk_doubles_neon(b.s0, b.s1, actual_d, 16, bias);
+        CHECK(memcmp(expected_d, actual_d, sizeof(expected_d)) == 0,
+              "NEON doubles should match the scalar kernel");
+
+        cromulent_bulk_floats_scalar(a.s0, a.s1, expected_f, 16, bias);
+        cromulent_bulk_floats_neon(b.s0, b.s1, actual_f, 16, bias);
+        CHECK(memcmp(expected_f, actual_f, sizeof(expected_f)) == 0,
+              "NEON floats should match the scalar kernel");
+        CHECK(memcmp(a.s0, b.s0, sizeof(a.s0)) == 0 &&
+              memcmp(a.s1, b.s1, sizeof(a.s1)) == 0,
+              "NEON conversion kernels should leave the same lane state");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test the NEON range kernel, including groups with rejected draws
+int test_neon_range_kernel() {
+    printf("Testing NEON range kernel against the scalar kernel... ");
+
+    static const uint32_t bounds[] = {1, 6, 1000003, (1U << 31) + 1,
+                                      UINT32_MAX};
+    static uint64_t words[16 * CROMULENT_BULK_LANES];
+    static uint64_t expected[32 * CROMULENT_BULK_LANES];
+    static uint64_t actual[32 * CROMULENT_BULK_LANES];
+
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+    cromulent_bulk_blocks_scalar(st.s0, st.s1, words, 16);
+
+    for (size_t k = 0; k < sizeof(bounds) / sizeof(bounds[0]); k++) {
+        const uint32_t n = bounds[k];
+        const uint32_t t = (uint32_t)(0u - n) % n;
+        const size_t want = cromulent_bulk_range32_scalar(
+            words, 16 * CROMULENT_BULK_LANES, n, t, expected);
+        const size_t got = cromulent_bulk_range32_neon(
+            words, 16 * CROMULENT_BULK_LANES, n, t, actual);
+        CHECK(want == got, "NEON range should keep as many draws as scalar");
+        CHECK(memcmp(expected, actual, want * sizeof(uint64_t)) == 0,
+              "NEON range should match the scalar kernel");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG NEON tests\n");
+
+    int result = 0;
+    result |= test_neon_lanes();
+    result |= test_neon_matches_avx2();
+    result |= test_neon_bulk_kernel();
+    result |= test_neon_real_kernels();
+    result |= test_neon_range_kernel();
+
+    if (result == 0) {
+        printf("All NEON tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
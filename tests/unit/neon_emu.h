@@ -0,0 +1,197 @@
+// tests/unit/neon_emu.h
+//
+// Plain C model of the NEON intrinsics used by src/simd/cromulent_neon.c, so
+// the NEON kernels can be built and checked on hosts without an ARM toolchain.
+// Only the handful of operations the kernels need are provided, with the same
+// names and lane semantics as <arm_neon.h>.
+
+#ifndef CROMULENT_NEON_EMU_H
+#define CROMULENT_NEON_EMU_H
+
+#include <stdint.h>
+#include <string.h>
+
+typedef struct {
+  uint64_t v[2];
+} uint64x2_t;
+
+typedef struct {
+  uint32_t v[2];
+} uint32x2_t;
+
+typedef struct {
+  uint32_t v[4];
+} uint32x4_t;
+
+typedef struct {
+  double v[2];
+} float64x2_t;
+
+typedef struct {
+  float v[4];
+} float32x4_t;
+
+static inline uint64x2_t vld1q_u64(const uint64_t *p) {
+  uint64x2_t r = {{p[0], p[1]}};
+  return r;
+}
+
+static inline void vst1q_u64(uint64_t *p, uint64x2_t a) {
+  p[0] = a.v[0];
+  p[1] = a.v[1];
+}
+
+static inline uint32x2_t vdup_n_u32(uint32_t x) {
+  uint32x2_t r = {{x, x}};
+  return r;
+}
+
+static inline uint64x2_t vaddq_u64(uint64x2_t a, uint64x2_t b) {
+  uint64x2_t r = {{a.v[0] + b.v[0], a.v[1] + b.v[1]}};
+  return r;
+}
+
+static inline uint64x2_t veorq_u64(uint64x2_t a, uint64x2_t b) {
+  uint64x2_t r = {{a.v[0] ^ b.v[0], a.v[1] ^ b.v[1]}};
+  return r;
+}
+
+static inline uint64x2_t vshlq_n_u64(uint64x2_t a, int n) {
+  uint64x2_t r = {{a.v[0] << n, a.v[1] << n}};
+  return r;
+}
+
+static inline uint64x2_t vshrq_n_u64(uint64x2_t a, int n) {
+  uint64x2_t r = {{a.v[0] >> n, a.v[1] >> n}};
+  return r;
+}
+
+// Shift b right by n and insert into a, keeping the top n bits of a.
+static inline uint64x2_t vsriq_n_u64(uint64x2_t a, uint64x2_t b, int n) {
+  const uint64_t keep = ~(UINT64_MAX >> n);
+  uint64x2_t r = {{(a.v[0] & keep) | (b.v[0] >> n),
+                   (a.v[1] & keep) | (b.v[1] >> n)}};
+  return r;
+}
+
+static inline uint32x2_t vmovn_u64(uint64x2_t a) {
+  uint32x2_t r = {{(uint32_t)a.v[0], (uint32_t)a.v[1]}};
+  return r;
+}
+
+static inline uint32x2_t vshrn_n_u64(uint64x2_t a, int n) {
+  uint32x2_t r = {{(uint32_t)(a.v[0] >> n), (uint32_t)(a.v[1] >> n)}};
+  return r;
+}
+
+static inline uint64x2_t vmull_u32(uint32x2_t a, uint32x2_t b) {
+  uint64x2_t r = {{(uint64_t)a.v[0] * b.v[0], (uint64_t)a.v[1] * b.v[1]}};
+  return r;
+}
+
+static inline uint64x2_t vmlal_u32(uint64x2_t acc, uint32x2_t a, uint32x2_t b) {
+  uint64x2_t r = {{acc.v[0] + (uint64_t)a.v[0] * b.v[0],
+                   acc.v[1] + (uint64_t)a.v[1] * b.v[1]}};
+  return r;
+}
+
+// Conversion kernels
+
+static inline uint64x2_t vdupq_n_u64(uint64_t x) {
+  uint64x2_t r = {{x, x}};
+  return r;
+}
+
+static inline uint32x4_t vdupq_n_u32(uint32_t x) {
+  uint32x4_t r = {{x, x, x, x}};
+  return r;
+}
+
+static inline float64x2_t vdupq_n_f64(double x) {
+  float64x2_t r = {{x, x}};
+  return r;
+}
+
+static inline float32x4_t vdupq_n_f32(float x) {
+  float32x4_t r = {{x, x, x, x}};
+  return r;
+}
+
+// Same bytes, viewed as four 32-bit lanes (host byte order, as on ARM).
+static inline uint32x4_t vreinterpretq_u32_u64(uint64x2_t a) {
+  uint32x4_t r;
+  memcpy(r.v, a.v, sizeof r.v);
+  return r;
+}
+
+static inline uint32x4_t vshrq_n_u32(uint32x4_t a, int n) {
+  uint32x4_t r = {{a.v[0] >> n, a.v[1] >> n, a.v[2] >> n, a.v[3] >> n}};
+  return r;
+}
+
+static inline uint32x4_t vaddq_u32(uint32x4_t a, uint32x4_t b) {
+  uint32x4_t r = {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2],
+                   a.v[3] + b.v[3]}};
+  return r;
+}
+
+static inline float64x2_t vcvtq_f64_u64(uint64x2_t a) {
+  float64x2_t r = {{(double)a.v[0], (double)a.v[1]}};
+  return r;
+}
+
+static inline float32x4_t vcvtq_f32_u32(uint32x4_t a) {
+  float32x4_t r = {{(float)a.v[0], (float)a.v[1], (float)a.v[2],
+                    (float)a.v[3]}};
+  return r;
+}
+
+static inline float64x2_t vmulq_f64(float64x2_t a, float64x2_t b) {
+  float64x2_t r = {{a.v[0] * b.v[0], a.v[1] * b.v[1]}};
+  return r;
+}
+
+static inline float32x4_t vmulq_f32(float32x4_t a, float32x4_t b) {
+  float32x4_t r = {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2],
+                    a.v[3] * b.v[3]}};
+  return r;
+}
+
+static inline void vst1q_f64(double *p, float64x2_t a) {
+  p[0] = a.v[0];
+  p[1] = a.v[1];
+}
+
+static inline void vst1q_f32(float *p, float32x4_t a) {
+  for (int i = 0; i < 4; ++i)
+    p[i] = a.v[i];
+}
+
+// Range kernel
+
+static inline uint32x2_t vclt_u32(uint32x2_t a, uint32x2_t b) {
+  uint32x2_t r = {{a.v[0] < b.v[0] ? UINT32_MAX : 0,
+                   a.v[1] < b.v[1] ? UINT32_MAX : 0}};
+  return r;
+}
+
+static inline uint32x2_t vorr_u32(uint32x2_t a, uint32x2_t b) {
+  uint32x2_t r = {{a.v[0] | b.v[0], a.v[1] | b.v[1]}};
+  return r;
+}
+
+static inline uint32_t vmaxv_u32(uint32x2_t a) {
+  return a.v[0] > a.v[1] ? a.v[0] : a.v[1];
+}
+
+static inline uint64x2_t vzip1q_u64(uint64x2_t a, uint64x2_t b) {
+  uint64x2_t r = {{a.v[0], b.v[0]}};
+  return r;
+}
+
+static inline uint64x2_t vzip2q_u64(uint64x2_t a, uint64x2_t b) {
+  uint64x2_t r = {{a.v[1], b.v[1]}};
+  return r;
+}
+
+#endif // CROMULENT_NEON_EMU_H
@@ -0,0 +1,240 @@
+// tests/unit/pool.c
+//
+// Unit tests for pool files
+// Checks that the payload is the documented stream for every chunk and does
+// not depend on the writer's thread count, that regenerating any range from
+// the checkpoints gives the mapped bytes, and that bad arguments and damaged
+// files are rejected.
+
+#include "cromulent.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define SEED 0x2545F4914F6CDD1DULL
+#define CHUNK 65536
+// Three full chunks and a partial one that ends inside a word
+#define SIZE (3 * CHUNK + 1000 + 5)
+
+static uint64_t load_le64(const uint8_t *in) {
+    uint64_t x = 0;
+    for (int i = 0; i < 8; i++)
+        x |= (uint64_t)in[i] << (8 * i);
+    return x;
+}
+
+static long file_size(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return -1;
+    fseek(f, 0, SEEK_END);
+    const long n = ftell(f);
+    fclose(f);
+    return n;
+}
+
+static int files_equal(const char *a, const char *b) {
+    FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+    int equal = fa && fb;
+    while (equal) {
+        const int ca = fgetc(fa), cb = fgetc(fb);
+        equal = ca == cb;
+        if (ca == EOF)
+            break;
+    }
+    if (fa)
+        fclose(fa);
+    if (fb)
+        fclose(fb);
+    return equal;
+}
+
+// Test that a bulk pool holds chunk c of the cromulent_fill_u64 stream for its
+// chunk seed, whatever the thread count
+int test_pool_bulk() {
+    printf("Testing cromulent_bulk pool contents... ");
+
+    CHECK(cromulent_pool_write("pool_t1.bin", "cromulent_bulk", SEED, SIZE,
+                               CHUNK, 1) == 0, "Writing a pool should succeed");
+    CHECK(cromulent_pool_write("pool_t4.bin", "cromulent_bulk", SEED, SIZE,
+                               CHUNK, 4) == 0, "Writing a pool should succeed");
+    CHECK(files_equal("pool_t1.bin", "pool_t4.bin"),
+          "The file should not depend on the thread count");
+
+    cromulent_pool pool;
+    CHECK(cromulent_pool_open(&pool, "pool_t4.bin") == 0,
+          "Opening a pool should succeed");
+    CHECK(strcmp(pool.generator, "cromulent_bulk") == 0 && pool.seed == SEED &&
+          pool.size == SIZE && pool.chunk_bytes == CHUNK &&
+          pool.chunks == 4 && pool.lanes == CROMULENT_BULK_LANES &&
+          pool.state_size == 2 * CROMULENT_BULK_LANES * 8,
+          "The header should describe the pool");
+    CHECK((uintptr_t)pool.data % 4096 == 0,
+          "The payload should be page-aligned");
+
+    static uint64_t ref[CHUNK / 8];
+    for (uint64_t c = 0; c < pool.chunks; c++) {
+        cromulent_bulk_state st;
+        cromulent_bulk_init(&st, cromulent_split_seed(SEED, c));
+        cromulent_fill_u64(&st, ref, CHUNK / 8);
+        const uint64_t n = c + 1 < pool.chunks ? CHUNK : SIZE - c * CHUNK;
+        for (uint64_t i = 0; i < n / 8; i++)
+            CHECK(load_le64(pool.data + c * CHUNK + 8 * i) == ref[i],
+                  "Chunk c should be the bulk stream of its chunk seed");
+        for (uint64_t b = n / 8 * 8; b < n; b++)
+            CHECK(pool.data[c * CHUNK + b] ==
+                  (uint8_t)(ref[b / 8] >> (8 * (b % 8))),
+                  "A partial last word should keep its leading bytes");
+    }
+    cromulent_pool_close(&pool);
+
+    remove("pool_t1.bin");
+    remove("pool_t4.bin");
+    printf("OK\n");
+    return 0;
+}
+
+// Test that a single-chunk registry pool is the plain stream
+int test_pool_registry() {
+    printf("Testing registry generator pools... ");
+
+    const char *names[] = {"cromulent128", "pcg64", "cromulent_strong"};
+    for (size_t g = 0; g < sizeof names / sizeof names[0]; g++) {
+        const CromulentPRNG2 *gen = cromulent_registry_v2_find(names[g]);
+        CHECK(gen != NULL, "The registry should have the generator");
+        CHECK(cromulent_pool_write("pool_reg.bin", names[g], 42, 8 * 4096,
+                                   8 * 4096, 2) == 0,
+              "Writing a pool should succeed");
+        cromulent_pool pool;
+        CHECK(cromulent_pool_open(&pool, "pool_reg.bin") == 0,
+              "Opening a pool should succeed");
+        CHECK(pool.chunks == 1 && pool.lanes == 1 &&
+              pool.state_size == gen->state_size,
+              "The header should describe the pool");
+
+        uint64_t state[64];
+        gen->init(state, 42);
+        for (size_t i = 0; i < 4096; i++)
+            CHECK(load_le64(pool.data + 8 * i) == gen->next(state),
+                  "A single-chunk pool should be the generator's stream");
+        cromulent_pool_close(&pool);
+    }
+
+    remove("pool_reg.bin");
+    printf("OK\n");
+    return 0;
+}
+
+// Test that regenerating ranges from the checkpoints gives the mapped bytes
+int test_pool_regenerate() {
+    printf("Testing regeneration from checkpoints... ");
+
+    const char *names[] = {"cromulent_bulk", "cromulent128"};
+    static uint8_t buf[SIZE];
+    for (size_t g = 0; g < 2; g++) {
+        CHECK(cromulent_pool_write("pool_regen.bin", names[g], SEED, SIZE,
+                                   CHUNK, 3) == 0,
+              "Writing a pool should succeed");
+        cromulent_pool pool;
+        CHECK(cromulent_pool_open(&pool, "pool_regen.bin") == 0,
+              "Opening a pool should succeed");
+
+        CHECK(cromulent_pool_regenerate(&pool, 0, buf, SIZE) == 0 &&
+              memcmp(buf, pool.data, SIZE) == 0,
+              "Regenerating the whole pool should match");
+        cromulent_state rng;
+        cromulent_init(&rng, SEED);
+        for (int trial = 0; trial < 200; trial++) {
+            const uint64_t at = cromulent_range(&rng, SIZE + 1);
+            const size_t n = (size_t)cromulent_range(&rng, SIZE - at + 1);
+            memset(buf, 0, n);
+            CHECK(cromulent_pool_regenerate(&pool, at, buf, n) == 0 &&
+                  memcmp(buf, pool.data + at, n) == 0,
+                  "Regenerating any range should match the mapped bytes");
+        }
+        errno = 0;
+        CHECK(cromulent_pool_regenerate(&pool, SIZE - 4, buf, 5) == -1 &&
+              errno == EINVAL, "Ranges past the end should be rejected");
+        cromulent_pool_close(&pool);
+    }
+
+    remove("pool_regen.bin");
+    printf("OK\n");
+    return 0;
+}
+
+// Test that bad arguments and damaged files are rejected
+int test_pool_reject() {
+    printf("Testing rejected pools... ");
+
+    errno = 0;
+    CHECK(cromulent_pool_write("pool_bad.bin", "no_such_generator", 1, 4096,
+                               4096, 1) == -1 && errno == ENOTSUP,
+          "An unknown generator should be rejected");
+    errno = 0;
+    CHECK(cromulent_pool_write("pool_bad.bin", "cromulent128", 1, 4096, 12,
+                               1) == -1 && errno == EINVAL,
+          "A chunk size that is not whole words should be rejected");
+
+    CHECK(cromulent_pool_write("pool_bad.bin", "cromulent128", 1, 3 * 4096,
+                               4096, 1) == 0, "Writing a pool should succeed");
+    const long full = file_size("pool_bad.bin");
+    CHECK(full > 3 * 4096, "The file should hold header and payload");
+
+    // Truncated payload
+    FILE *in = fopen("pool_bad.bin", "rb");
+    FILE *out = fopen("pool_cut.bin", "wb");
+    CHECK(in && out, "The copies should open");
+    for (long i = 0; i < full - 1; i++)
+        fputc(fgetc(in), out);
+    fclose(in);
+    fclose(out);
+    cromulent_pool pool;
+    errno = 0;
+    CHECK(cromulent_pool_open(&pool, "pool_cut.bin") == -1 && errno == EINVAL,
+          "A truncated pool should be rejected");
+
+    // No magic, as left by an interrupted write
+    FILE *f = fopen("pool_bad.bin", "r+b");
+    CHECK(f != NULL, "The pool should open for update");
+    fputc(0, f);
+    fclose(f);
+    errno = 0;
+    CHECK(cromulent_pool_open(&pool, "pool_bad.bin") == -1 && errno == EINVAL,
+          "A pool without its magic should be rejected");
+
+    CHECK(cromulent_pool_open(&pool, "pool_missing.bin") == -1 &&
+          errno == ENOENT, "A missing file should be reported");
+
+    remove("pool_bad.bin");
+    remove("pool_cut.bin");
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG pool tests\n");
+
+    int result = 0;
+    result |= test_pool_bulk();
+    result |= test_pool_registry();
+    result |= test_pool_regenerate();
+    result |= test_pool_reject();
+
+    if (result == 0) {
+        printf("All pool tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
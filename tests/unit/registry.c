@@ -0,0 +1,239 @@
+// tests/unit/registry.c
+//
+// Unit tests for the state-passing (v2) generator registry
+// Every v2 entry must reproduce its generator's native stream, keep separate
+// instances independent, fill like repeated next(), and round-trip through
+// save/load. The AVX2 entry must exist exactly when the CPU supports AVX2.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define SEED 0x9E3779B97F4A7C15ULL
+#define DRAWS 1000
+#define MAX_STATE 128
+
+// Large enough for every registered state, aligned for uint64_t
+typedef union {
+    uint64_t words[MAX_STATE / sizeof(uint64_t)];
+    unsigned char bytes[MAX_STATE];
+} state_buf;
+
+// Test lookup by name and that v2 states fit the test buffers
+int test_registry_v2_lookup() {
+    printf("Testing v2 registry lookup... ");
+
+    static const char *names[] = {"xoshiro256", "cromulent128", "splitmix64",
+                                  "pcg64", "cromulent_strong", "cromulent_at",
+                                  "cromulent128_avx2"};
+    const int has_avx2 = cromulent_backend_supported(CROMULENT_BACKEND_AVX2);
+    size_t n = 0, n1 = 0;
+    const CromulentPRNG2 *all = cromulent_registry_v2_all(&n);
+    cromulent_registry_all(&n1);
+    CHECK(n == sizeof(names) / sizeof(names[0]) - !has_avx2,
+          "v2 registry should list every available generator");
+    CHECK(n1 == n, "v1 and v2 registries should list the same generators");
+    CHECK((cromulent_registry_find("cromulent128_avx2") != NULL) == has_avx2,
+          "AVX2 entry should be present exactly when the CPU has AVX2");
+
+    for (size_t i = 0; i < n; i++) {
+        const CromulentPRNG2 *g = cromulent_registry_v2_find(names[i]);
+        CHECK(g != NULL, "Registered generator should be found");
+        CHECK(g >= all && g < all + n, "find should return a table entry");
+        CHECK(g->state_size > 0 && g->state_size <= MAX_STATE,
+              "State size should be small and non-zero");
+    }
+    CHECK(cromulent_registry_v2_find("no-such-prng") == NULL,
+          "Unknown names should not be found");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that v2 entries produce the same values as the native state API
+int test_registry_v2_matches_native() {
+    printf("Testing v2 streams against the native APIs... ");
+
+    state_buf buf;
+    const CromulentPRNG2 *g;
+
+    xoshiro256_state xs;
+    xoshiro256_init(&xs, SEED);
+    g = cromulent_registry_v2_find("xoshiro256");
+    g->init(&buf, SEED);
+    for (int i = 0; i < DRAWS; i++)
+        CHECK(g->next(&buf) == xoshiro256_next(&xs), "xoshiro256 should match");
+
+    pcg64_state pcg;
+    pcg64_init(&pcg, SEED);
+    g = cromulent_registry_v2_find("pcg64");
+    g->init(&buf, SEED);
+    for (int i = 0; i < DRAWS; i++)
+        CHECK(g->next(&buf) == pcg64_next(&pcg), "pcg64 should match");
+
+    splitmix64_state sm;
+    splitmix64_init(&sm, SEED);
+    g = cromulent_registry_v2_find("splitmix64");
+    g->init(&buf, SEED);
+    for (int i = 0; i < DRAWS; i++)
+        CHECK(g->next(&buf) == splitmix64_next(&sm), "splitmix64 should match");
+
+    cromulent_state cs;
+    cromulent_init(&cs, SEED);
+    g = cromulent_registry_v2_find("cromulent128");
+    g->init(&buf, SEED);
+    for (int i = 0; i < DRAWS; i++)
+        CHECK(g->next(&buf) == cromulent_next(&cs), "cromulent128 should match");
+
+    cromulent_strong_state ss;
+    cromulent_strong_init(&ss, SEED);
+    g = cromulent_registry_v2_find("cromulent_strong");
+    g->init(&buf, SEED);
+    for (int i = 0; i < DRAWS; i++)
+        CHECK(g->next(&buf) == cromulent_strong_next(&ss),
+              "cromulent_strong should match");
+
+    cromulent_at_state as;
+    cromulent_at_init(&as, SEED);
+    g = cromulent_registry_v2_find("cromulent_at");
+    g->init(&buf, SEED);
+    for (int i = 0; i < DRAWS; i++)
+        CHECK(g->next(&buf) == cromulent_at(SEED, (uint64_t)i) &&
+              cromulent_at_next(&as) == cromulent_at(SEED, (uint64_t)i),
+              "cromulent_at should match");
+
+    cromulent_x4_state x4;
+    cromulent_x4_init(&x4, SEED);
+    g = cromulent_registry_v2_find("cromulent128_avx2");
+    if (g) {
+        g->init(&buf, SEED);
+        for (int i = 0; i < DRAWS; i += 4) {
+            uint64_t lanes[4];
+            cromulent_x4_next(&x4, lanes);
+            for (int j = 0; j < 4; j++)
+                CHECK(g->next(&buf) == lanes[j],
+                      "cromulent128_avx2 should match cromulent_x4");
+        }
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that the v1 globals still produce the reference streams
+int test_registry_v1_wrappers() {
+    printf("Testing v1 globals against the v2 streams... ");
+
+    static const char *names[] = {"xoshiro256", "splitmix64", "pcg64",
+                                  "cromulent_strong", "cromulent_at",
+                                  "cromulent128_avx2"};
+    state_buf buf;
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        const CromulentPRNG *v1 = cromulent_registry_find(names[i]);
+        const CromulentPRNG2 *v2 = cromulent_registry_v2_find(names[i]);
+        CHECK((v1 == NULL) == (v2 == NULL),
+              "Generator should be in both tables or in neither");
+        if (!v1)
+            continue;
+        v1->init(SEED);
+        v2->init(&buf, SEED);
+        for (int j = 0; j < DRAWS; j++)
+            CHECK(v1->next() == v2->next(&buf),
+                  "v1 global should follow the same stream as v2");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test independence, fill and save/load for every v2 entry
+int test_registry_v2_instances() {
+    printf("Testing v2 instances, fill and save/load... ");
+
+    size_t n = 0;
+    const CromulentPRNG2 *all = cromulent_registry_v2_all(&n);
+    static uint64_t expected[DRAWS], actual[DRAWS];
+
+    for (size_t i = 0; i < n; i++) {
+        const CromulentPRNG2 *g = &all[i];
+        state_buf a, b, saved;
+        unsigned char blob[MAX_STATE];
+
+        // Two interleaved instances must not affect each other
+        g->init(&a, SEED);
+        for (int j = 0; j < DRAWS; j++)
+            expected[j] = g->next(&a);
+        g->init(&a, SEED);
+        g->init(&b, SEED + 1);
+        for (int j = 0; j < DRAWS; j++) {
+            actual[j] = g->next(&a);
+            g->next(&b);
+        }
+        CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+              "Instances should be independent");
+
+        // fill() equals repeated next(), across split calls and mixed
+        // with next()
+        g->init(&a, SEED);
+        g->fill(&a, actual, 7);
+        actual[7] = g->next(&a);
+        g->fill(&a, actual + 8, 1);
+        g->fill(&a, actual + 9, DRAWS - 9);
+        CHECK(memcmp(expected, actual, sizeof(expected)) == 0,
+              "fill should match repeated next");
+
+        // save/load resumes the stream in a fresh buffer
+        g->init(&a, SEED);
+        for (int j = 0; j < 10; j++)
+            g->next(&a);
+        g->save(&a, blob);
+        memset(&saved, 0xA5, sizeof(saved));
+        g->load(&saved, blob);
+        for (int j = 10; j < DRAWS; j++)
+            CHECK(g->next(&saved) == expected[j],
+                  "Loaded state should resume the stream");
+    }
+
+    // cromulent128 v2 saves in the cromulent_save format
+    const CromulentPRNG2 *g = cromulent_registry_v2_find("cromulent128");
+    cromulent_state cs;
+    state_buf buf;
+    uint8_t native[16], v2[16];
+    cromulent_init(&cs, SEED);
+    g->init(&buf, SEED);
+    cromulent_save(&cs, native);
+    g->save(&buf, v2);
+    CHECK(memcmp(native, v2, sizeof(native)) == 0,
+          "cromulent128 should save like cromulent_save");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG registry tests\n");
+
+    int result = 0;
+    result |= test_registry_v2_lookup();
+    result |= test_registry_v2_matches_native();
+    result |= test_registry_v1_wrappers();
+    result |= test_registry_v2_instances();
+
+    if (result == 0) {
+        printf("All registry tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
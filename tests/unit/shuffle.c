@@ -0,0 +1,250 @@
+// tests/unit/shuffle.c
+//
+// Unit tests for cromulent_shuffle, cromulent_sample_k and
+// cromulent_shuffle_large
+// Checks that shuffles are permutations independent of the element size, that
+// all permutations of a small array are equally likely, that sampled indices
+// are distinct with equal inclusion rates, and that the bucketed shuffle is a
+// uniform permutation that does not depend on the thread count.
+
+#include "cromulent.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define SEED 0x2545F4914F6CDD1DULL
+
+static int is_permutation(const uint64_t *a, size_t n) {
+    unsigned char *seen = calloc(n, 1);
+    int ok = seen != NULL;
+    for (size_t i = 0; ok && i < n; i++) {
+        ok = a[i] < n && !seen[a[i]];
+        if (ok)
+            seen[a[i]] = 1;
+    }
+    free(seen);
+    return ok;
+}
+
+// Test that every element size gives the same permutation of the same state
+int test_shuffle_sizes() {
+    printf("Testing shuffle across element sizes... ");
+
+    enum { N = 1001 };
+    static uint64_t ref[N];
+    static unsigned char wide[N * 24];
+    uint32_t small[N];
+    uint8_t bytes[256];
+
+    for (size_t i = 0; i < N; i++)
+        ref[i] = i;
+    cromulent_state st;
+    cromulent_init(&st, SEED);
+    cromulent_shuffle(&st, ref, N, sizeof(uint64_t));
+    CHECK(is_permutation(ref, N), "A shuffle should be a permutation");
+
+    for (size_t i = 0; i < N; i++) {
+        small[i] = (uint32_t)i;
+        memset(wide + 24 * i, 0, 24);
+        memcpy(wide + 24 * i + 8, &i, sizeof i);
+    }
+    cromulent_init(&st, SEED);
+    cromulent_shuffle(&st, small, N, sizeof(uint32_t));
+    cromulent_init(&st, SEED);
+    cromulent_shuffle(&st, wide, N, 24);
+    for (size_t i = 0; i < N; i++) {
+        uint64_t w;
+        memcpy(&w, wide + 24 * i + 8, sizeof w);
+        CHECK(small[i] == ref[i] && w == ref[i],
+              "Every element size should give the same permutation");
+    }
+
+    for (size_t i = 0; i < 256; i++)
+        bytes[i] = (uint8_t)i;
+    cromulent_shuffle(&st, bytes, 256, 1);
+    int seen[256] = {0};
+    for (size_t i = 0; i < 256; i++)
+        seen[bytes[i]]++;
+    for (size_t i = 0; i < 256; i++)
+        CHECK(seen[i] == 1, "A byte shuffle should be a permutation");
+
+    cromulent_shuffle(&st, NULL, 0, 8);
+    uint64_t one = 7;
+    cromulent_shuffle(&st, &one, 1, 8);
+    CHECK(one == 7, "A single element should stay put");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that all 120 orders of five elements are equally likely, which covers
+// the paired draws and the single draw left for an odd length
+int test_shuffle_uniform() {
+    printf("Testing shuffle uniformity over all permutations... ");
+
+    enum { K = 5, PERMS = 120, TRIALS = 600000 };
+    static size_t counts[PERMS];
+    cromulent_state st;
+    cromulent_init(&st, SEED);
+
+    for (int t = 0; t < TRIALS; t++) {
+        uint32_t a[K] = {0, 1, 2, 3, 4};
+        cromulent_shuffle(&st, a, K, sizeof a[0]);
+        // Lehmer code of the permutation
+        int rank = 0;
+        for (int i = 0; i < K; i++) {
+            int smaller = 0;
+            for (int j = i + 1; j < K; j++)
+                smaller += a[j] < a[i];
+            rank = rank * (K - i) + smaller;
+        }
+        counts[rank]++;
+    }
+
+    const double e = (double)TRIALS / PERMS;
+    double chi2 = 0;
+    for (int p = 0; p < PERMS; p++)
+        chi2 += (counts[p] - e) * (counts[p] - e) / e;
+    // 119 degrees of freedom; allow five standard deviations
+    CHECK(chi2 < 119 + 5 * sqrt(2.0 * 119), "Permutations should be uniform");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that sampled indices are distinct and equally likely to be included
+int test_sample_k() {
+    printf("Testing sample_k... ");
+
+    enum { N = 20, K = 5, TRIALS = 200000 };
+    static size_t counts[N];
+    uint64_t dst[N];
+    cromulent_state st;
+    cromulent_init(&st, SEED);
+
+    CHECK(cromulent_sample_k(&st, 3, dst, 4) == -1,
+          "k above n should be rejected");
+    CHECK(cromulent_sample_k(&st, N, dst, N) == 0 && is_permutation(dst, N),
+          "k == n should return every index");
+    CHECK(cromulent_sample_k(&st, N, dst, 0) == 0, "k == 0 should succeed");
+
+    for (int t = 0; t < TRIALS; t++) {
+        CHECK(cromulent_sample_k(&st, N, dst, K) == 0,
+              "Valid samples should succeed");
+        for (int i = 0; i < K; i++) {
+            CHECK(dst[i] < N, "Indices should be in range");
+            for (int j = 0; j < i; j++)
+                CHECK(dst[i] != dst[j], "Indices should be distinct");
+            counts[dst[i]]++;
+        }
+    }
+
+    // Each index is included with probability K / N
+    const double p = (double)K / N, e = TRIALS * p;
+    const double sd = sqrt(TRIALS * p * (1 - p));
+    for (int i = 0; i < N; i++)
+        CHECK(fabs(counts[i] - e) < 5 * sd,
+              "Every index should be included equally often");
+
+    // A large population: the skips must land inside it
+    static uint64_t big[1000];
+    CHECK(cromulent_sample_k(&st, 1ULL << 40, big, 1000) == 0,
+          "Sampling a huge range should succeed");
+    for (int i = 0; i < 1000; i++)
+        CHECK(big[i] < (1ULL << 40), "Indices should be in range");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test the bucketed shuffle on an array big enough to use many buckets
+int test_shuffle_large() {
+    printf("Testing shuffle_large... ");
+
+    const size_t n = (3 << 20) + 12345;
+    uint64_t *a = malloc(n * sizeof(uint64_t));
+    uint64_t *b = malloc(n * sizeof(uint64_t));
+    void *ws = malloc(cromulent_shuffle_large_workspace(n, sizeof(uint64_t)));
+    CHECK(a && b && ws, "Allocation should succeed");
+
+    for (size_t i = 0; i < n; i++)
+        a[i] = b[i] = i;
+    cromulent_state sa, sb, before;
+    cromulent_init(&sa, SEED);
+    cromulent_init(&sb, SEED);
+    before = sa;
+    cromulent_shuffle_large(&sa, a, n, sizeof(uint64_t), ws, 1);
+    cromulent_shuffle_large(&sb, b, n, sizeof(uint64_t), ws, 4);
+
+    CHECK(is_permutation(a, n), "A large shuffle should be a permutation");
+    CHECK(memcmp(a, b, n * sizeof(uint64_t)) == 0,
+          "The result should not depend on the thread count");
+    cromulent_next(&before);
+    CHECK(sa.s0 == before.s0 && sa.s1 == before.s1,
+          "The state should advance by one draw");
+
+    // Where do the first elements land? Split the output into 64 strips and
+    // count the elements below n / 64 in each.
+    enum { STRIPS = 64 };
+    size_t counts[STRIPS] = {0};
+    const size_t marked = n / STRIPS;
+    for (size_t i = 0; i < n; i++)
+        if (a[i] < marked)
+            counts[i * STRIPS / n]++;
+    const double e = (double)marked / STRIPS;
+    double chi2 = 0;
+    for (int s = 0; s < STRIPS; s++)
+        chi2 += (counts[s] - e) * (counts[s] - e) / e;
+    CHECK(chi2 < 63 + 5 * sqrt(2.0 * 63),
+          "Elements should spread evenly over the output");
+
+    // A different state gives a different permutation
+    for (size_t i = 0; i < n; i++)
+        b[i] = i;
+    cromulent_shuffle_large(&sa, b, n, sizeof(uint64_t), ws, 2);
+    CHECK(memcmp(a, b, n * sizeof(uint64_t)) != 0,
+          "Successive calls should give different permutations");
+
+    // Small arrays use a single bucket and still shuffle
+    uint32_t small[100];
+    for (int i = 0; i < 100; i++)
+        small[i] = (uint32_t)i;
+    cromulent_shuffle_large(&sa, small, 100, sizeof small[0], ws, 2);
+    int moved = 0;
+    for (int i = 0; i < 100; i++)
+        moved += small[i] != (uint32_t)i;
+    CHECK(moved > 50, "A single-bucket shuffle should move elements");
+
+    free(a);
+    free(b);
+    free(ws);
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG shuffle tests\n");
+
+    int result = 0;
+    result |= test_shuffle_sizes();
+    result |= test_shuffle_uniform();
+    result |= test_sample_k();
+    result |= test_shuffle_large();
+
+    if (result == 0) {
+        printf("All shuffle tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,156 @@
+// tests/unit/split.c
+//
+// Unit tests for cromulent_split stream partitioning
+// Substreams must be reproducible, must leave the parent untouched, and must
+// not overlap: no 64-bit output may repeat across 10k streams.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define STREAMS 10000
+#define DRAWS 256
+
+static int compare_u64(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t *)a;
+    const uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Test that splitting is deterministic and does not touch the parent
+int test_split_reproducible() {
+    printf("Testing split reproducibility... ");
+
+    cromulent_state parent, before, a, b;
+    cromulent_init(&parent, 0xC0FFEE);
+    before = parent;
+
+    cromulent_split(&parent, 42, &a);
+    cromulent_split(&parent, 42, &b);
+    CHECK(parent.s0 == before.s0 && parent.s1 == before.s1,
+          "Splitting should not modify the parent");
+    CHECK(a.s0 == b.s0 && a.s1 == b.s1,
+          "Same parent and stream id should give the same child");
+
+    for (int i = 0; i < 100; i++)
+        CHECK(cromulent_next(&a) == cromulent_next(&b),
+              "Children with equal state should produce equal streams");
+
+    // In-place split replaces the state with the child
+    cromulent_state inplace = parent;
+    cromulent_split(&inplace, 42, &inplace);
+    cromulent_split(&parent, 42, &a);
+    CHECK(inplace.s0 == a.s0 && inplace.s1 == a.s1,
+          "Split should allow child to alias parent");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that 10k substreams share no outputs over their first DRAWS values
+int test_split_no_overlap() {
+    printf("Testing %d streams x %d draws for overlap... ", STREAMS, DRAWS);
+
+    uint64_t *values = malloc(sizeof(uint64_t) * STREAMS * DRAWS);
+    CHECK(values != NULL, "Allocation should succeed");
+
+    cromulent_state master;
+    cromulent_init(&master, 0x0123456789ABCDEFULL);
+
+    size_t n = 0;
+    for (uint64_t stream = 0; stream < STREAMS; stream++) {
+        cromulent_state child;
+        cromulent_split(&master, stream, &child);
+        for (int i = 0; i < DRAWS; i++)
+            values[n++] = cromulent_next(&child);
+    }
+
+    qsort(values, n, sizeof(uint64_t), compare_u64);
+    size_t duplicates = 0;
+    for (size_t i = 1; i < n; i++)
+        duplicates += values[i] == values[i - 1];
+    free(values);
+
+    CHECK(duplicates == 0, "Substreams should not share outputs");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that split seeds keep stream 0 on the seed and take the first output
+// of the split stream otherwise
+int test_split_seed() {
+    printf("Testing split seeds... ");
+
+    CHECK(cromulent_split_seed(0xC0FFEE, 0) == 0xC0FFEE,
+          "Stream 0 should be seeded with the seed itself");
+
+    cromulent_state root;
+    cromulent_init(&root, 0xC0FFEE);
+    for (uint64_t stream = 1; stream < 100; stream++) {
+        cromulent_state child;
+        cromulent_split(&root, stream, &child);
+        CHECK(cromulent_split_seed(0xC0FFEE, stream) == cromulent_next(&child),
+              "Stream c should be seeded with the first output of split c");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that neighbouring stream ids are not correlated bit-wise
+int test_split_decorrelated() {
+    printf("Testing neighbouring streams are decorrelated... ");
+
+    cromulent_state master;
+    cromulent_init(&master, 0);
+
+    // Average Hamming distance between first outputs of streams i and i+1
+    // should be close to 32 bits.
+    uint64_t total = 0;
+    const int pairs = 4096;
+    for (int i = 0; i < pairs; i++) {
+        cromulent_state a, b;
+        cromulent_split(&master, (uint64_t)i, &a);
+        cromulent_split(&master, (uint64_t)i + 1, &b);
+        uint64_t x = cromulent_next(&a) ^ cromulent_next(&b);
+        while (x) {
+            total += x & 1;
+            x >>= 1;
+        }
+    }
+
+    const double mean = (double)total / pairs;
+    CHECK(mean > 31.0 && mean < 33.0,
+          "Neighbouring streams should differ in about half their bits");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG split tests\n");
+
+    int result = 0;
+    result |= test_split_reproducible();
+    result |= test_split_no_overlap();
+    result |= test_split_decorrelated();
+    result |= test_split_seed();
+
+    if (result == 0) {
+        printf("All split tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,127 @@
+// tests/unit/stream.c
+//
+// Unit tests for cromulent-stream, run as `test_stream PATH-TO-TOOL`
+// Checks that the default output is the cromulent_init(0xDEADBEEF) stream,
+// that a pipe (vmsplice on Linux), --no-splice and --output all give the same
+// bytes, and that a reader closing the pipe early is not an error.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+// Threads, a block smaller than the output and a partial last word
+#define SPLIT_ARGS "--gen cromulent_bulk --threads 3 --block 8K --bytes 100005"
+#define SPLIT_BYTES 100005
+#define DEFAULT_BYTES 65536
+
+static const char *tool;
+
+// Run the tool with args and read up to n bytes of its stdout into buf.
+// Returns the number of bytes read, or -1 if the tool failed.
+static long run(const char *args, unsigned char *buf, size_t n) {
+    char cmd[1024];
+    snprintf(cmd, sizeof cmd, "'%s' %s", tool, args);
+    FILE *p = popen(cmd, "r");
+    if (!p)
+        return -1;
+    const size_t got = fread(buf, 1, n, p);
+    const int status = pclose(p);
+    if (status == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        return -1;
+    return (long)got;
+}
+
+// Test that the defaults give the stream dump_raw used to write
+int test_stream_default() {
+    printf("Testing the default stream... ");
+
+    static uint64_t out[DEFAULT_BYTES / 8 + 1];
+    char args[64];
+    snprintf(args, sizeof args, "--bytes %d", DEFAULT_BYTES);
+    CHECK(run(args, (unsigned char *)out, sizeof out) == DEFAULT_BYTES,
+          "The tool should write exactly --bytes bytes");
+
+    cromulent_state st;
+    cromulent_init(&st, 0xDEADBEEF);
+    for (size_t i = 0; i < DEFAULT_BYTES / 8; i++)
+        CHECK(out[i] == cromulent_next(&st),
+              "The output should be cromulent_next in native byte order");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that splicing, write() and a file all carry the same bytes
+int test_stream_paths_agree() {
+    printf("Testing splice, --no-splice and --output agree... ");
+
+    static unsigned char spliced[SPLIT_BYTES + 1], written[SPLIT_BYTES + 1],
+        file[SPLIT_BYTES + 1];
+    CHECK(run(SPLIT_ARGS, spliced, sizeof spliced) == SPLIT_BYTES,
+          "A pipe should get exactly --bytes bytes");
+    CHECK(run(SPLIT_ARGS " --no-splice", written, sizeof written) ==
+          SPLIT_BYTES, "--no-splice should write exactly --bytes bytes");
+    CHECK(run(SPLIT_ARGS " --output stream_test.bin", file, sizeof file) == 0,
+          "--output should leave stdout empty");
+
+    FILE *f = fopen("stream_test.bin", "rb");
+    CHECK(f != NULL, "--output should create the file");
+    const size_t got = fread(file, 1, sizeof file, f);
+    fclose(f);
+    remove("stream_test.bin");
+    CHECK(got == SPLIT_BYTES, "The file should hold exactly --bytes bytes");
+
+    CHECK(memcmp(spliced, written, SPLIT_BYTES) == 0,
+          "Splicing and write() should give the same bytes");
+    CHECK(memcmp(spliced, file, SPLIT_BYTES) == 0,
+          "A pipe and a file should get the same bytes");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that an endless stream exits cleanly once its reader has had enough
+int test_stream_reader_closes() {
+    printf("Testing a reader that closes the pipe... ");
+
+    static unsigned char buf[1 << 16];
+    CHECK(run("--threads 2", buf, sizeof buf) == (long)sizeof buf,
+          "Closing the pipe should end the stream with status 0");
+    CHECK(run("--threads 2 --no-splice", buf, sizeof buf) == (long)sizeof buf,
+          "Closing the pipe should end the stream with status 0");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s PATH-TO-CROMULENT-STREAM\n", argv[0]);
+        return 1;
+    }
+    tool = argv[1];
+    printf("Running Cromulent PRNG stream tool tests\n");
+
+    int result = 0;
+    result |= test_stream_default();
+    result |= test_stream_paths_agree();
+    result |= test_stream_reader_closes();
+
+    if (result == 0) {
+        printf("All stream tool tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
@@ -1,7 +1,9 @@
 // tests/unit/strong_next.c
 //
 // Unit tests for the cromulent_strong_next functionality
-// Verifies initialization and output behavior for the "strong" variant.
+// Verifies initialization and output behavior for the "strong" variant, and
+// that the multi-lane bulk form runs the same step in every lane on every
+// backend.
 
 #include "cromulent.h"
 #include <assert.h>
@@ -60,12 +62,95 @@ int test_known_sequence() {
     return 0;
 }
 
+#define LANES CROMULENT_BULK_LANES
+#define STEPS 1000
+
+static const cromulent_backend kBackends[] = {
+    CROMULENT_BACKEND_SCALAR,
+    CROMULENT_BACKEND_AVX2,
+    CROMULENT_BACKEND_AVX512,
+    CROMULENT_BACKEND_NEON,
+};
+
+#define BACKEND_COUNT (sizeof(kBackends) / sizeof(kBackends[0]))
+
+// The cromulent_strong_init seed expansion, word by word
+static uint64_t seed_word(uint64_t *z) {
+    *z += 0x9e3779b97f4a7c15ULL;
+    uint64_t x = *z;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    *z = x;
+    return x ^ (x >> 31);
+}
+
+// Test that every lane of the bulk stream is the scalar cromulent_strong_next
+// stream from its seed words, on every supported backend, in one call and in
+// uneven pieces
+int test_strong_bulk_lanes() {
+    printf("Testing strong bulk lanes against the scalar step...");
+
+    const uint64_t seed = 0x1234567890ABCDEFULL;
+    static uint64_t expected[STEPS * LANES], actual[STEPS * LANES];
+
+    // cromulent_strong_init uses the first two expansion words
+    uint64_t z = seed;
+    cromulent_strong_state first;
+    cromulent_strong_init(&first, seed);
+    CHECK(seed_word(&z) == first.a && seed_word(&z) == first.b,
+          "The seed expansion should match cromulent_strong_init");
+
+    uint64_t words[2 * LANES];
+    z = seed;
+    for (int i = 0; i < 2 * LANES; i++)
+        words[i] = seed_word(&z);
+    for (int lane = 0; lane < LANES; lane++) {
+        cromulent_strong_state st = {words[lane], words[LANES + lane]};
+        for (int step = 0; step < STEPS; step++)
+            expected[step * LANES + lane] = cromulent_strong_next(&st);
+    }
+
+    static const size_t pieces[] = {1, 15, 16, 17, 3, 100, 1000};
+    const cromulent_backend original = cromulent_backend_active();
+    for (size_t b = 0; b < BACKEND_COUNT; b++) {
+        if (cromulent_backend_select(kBackends[b]) != 0)
+            continue;
+        printf(" %s", cromulent_backend_name(kBackends[b]));
+
+        cromulent_strong_bulk_state st;
+        cromulent_strong_bulk_init(&st, seed);
+        cromulent_strong_fill_u64(&st, actual, STEPS * LANES);
+        for (size_t i = 0; i < STEPS * LANES; i++)
+            CHECK(actual[i] == expected[i],
+                  "Each lane should be the scalar strong stream");
+
+        memset(actual, 0, sizeof actual);
+        cromulent_strong_bulk_init(&st, seed);
+        size_t done = 0;
+        for (size_t i = 0; done < STEPS * LANES; i = (i + 1) % 7) {
+            size_t take = pieces[i] < STEPS * LANES - done
+                              ? pieces[i]
+                              : STEPS * LANES - done;
+            cromulent_strong_fill_u64(&st, actual + done, take);
+            done += take;
+        }
+        CHECK(memcmp(actual, expected, sizeof actual) == 0,
+              "Fills in uneven pieces should continue the same stream");
+    }
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
 int main() {
     printf("Running Cromulent strong_next tests\n");
 
     int result = 0;
     result |= test_same_seed_reproducible();
     result |= test_known_sequence();
+    result |= test_strong_bulk_lanes();
 
     if (result == 0) {
         printf("All strong_next tests passed successfully!\n");
@@ -0,0 +1,161 @@
+// tests/unit/tls.c
+//
+// Unit tests for the thread-local generator API
+// Each thread must get its own cromulent_split substream of the master seed,
+// bound streams must not depend on thread start order, and threads must not
+// disturb each other's state.
+
+#include "cromulent.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define MASTER_SEED 0x5EED5EED5EED5EEDULL
+#define THREADS 8
+#define DRAWS 100000
+
+static void expected_stream(uint64_t stream, cromulent_state *out) {
+    cromulent_state master;
+    cromulent_init(&master, MASTER_SEED);
+    cromulent_split(&master, stream, out);
+}
+
+// Test that the first thread to draw gets stream 0 and reseeding restarts it
+int test_tls_lazy_seed() {
+    printf("Testing lazy seeding of the calling thread... ");
+
+    cromulent_tls_seed(MASTER_SEED);
+    cromulent_state ref;
+    expected_stream(0, &ref);
+    for (int i = 0; i < 100; i++)
+        CHECK(cromulent_tls_next() == cromulent_next(&ref),
+              "First thread should draw from stream 0");
+
+    cromulent_tls_seed(MASTER_SEED);
+    expected_stream(0, &ref);
+    CHECK(cromulent_tls_next() == cromulent_next(&ref),
+          "Reseeding should restart the calling thread's stream");
+
+    cromulent_tls_bind(7);
+    expected_stream(7, &ref);
+    for (int i = 0; i < 100; i++)
+        CHECK(cromulent_tls_next() == cromulent_next(&ref),
+              "Bound thread should draw from the bound stream");
+
+    for (int i = 0; i < 1000; i++) {
+        const double d = cromulent_tls_double();
+        CHECK(d >= 0.0 && d < 1.0, "Double should be in [0, 1)");
+        const float f = cromulent_tls_float();
+        CHECK(f >= 0.0f && f < 1.0f, "Float should be in [0, 1)");
+        CHECK(cromulent_tls_range(10) < 10, "Range should be below n");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+typedef struct {
+    uint64_t stream;
+    int bind;
+    uint64_t first;
+    int ok;
+} worker_args;
+
+static void *worker(void *p) {
+    worker_args *args = p;
+    if (args->bind)
+        cromulent_tls_bind(args->stream);
+
+    args->first = cromulent_tls_next();
+    cromulent_state ref;
+    if (args->bind) {
+        expected_stream(args->stream, &ref);
+        args->ok = args->first == cromulent_next(&ref);
+    } else {
+        args->ok = 1;
+    }
+    for (int i = 1; i < DRAWS; i++) {
+        const uint64_t x = cromulent_tls_next();
+        if (args->bind && x != cromulent_next(&ref))
+            args->ok = 0;
+    }
+    return NULL;
+}
+
+static int run_workers(worker_args *args) {
+    pthread_t tid[THREADS];
+    for (int t = 0; t < THREADS; t++)
+        if (pthread_create(&tid[t], NULL, worker, &args[t]) != 0)
+            return 1;
+    for (int t = 0; t < THREADS; t++)
+        pthread_join(tid[t], NULL);
+    return 0;
+}
+
+// Test that bound threads reproduce their substreams while running together
+int test_tls_bound_threads() {
+    printf("Testing %d bound threads against cromulent_split... ", THREADS);
+
+    worker_args args[THREADS];
+    for (int t = 0; t < THREADS; t++)
+        args[t] = (worker_args){.stream = (uint64_t)t, .bind = 1};
+    cromulent_tls_seed(MASTER_SEED);
+    CHECK(run_workers(args) == 0, "Thread creation should succeed");
+
+    for (int t = 0; t < THREADS; t++)
+        CHECK(args[t].ok, "Each bound thread should match its substream");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that unbound threads take distinct streams 0..THREADS-1
+int test_tls_unbound_threads() {
+    printf("Testing %d lazily seeded threads get distinct streams... ", THREADS);
+
+    worker_args args[THREADS];
+    memset(args, 0, sizeof(args));
+    cromulent_tls_seed(MASTER_SEED);
+    CHECK(run_workers(args) == 0, "Thread creation should succeed");
+
+    // Each stream id must be taken by exactly one thread, in some order
+    int taken[THREADS] = {0};
+    for (uint64_t s = 0; s < THREADS; s++) {
+        cromulent_state ref;
+        expected_stream(s, &ref);
+        const uint64_t first = cromulent_next(&ref);
+        for (int t = 0; t < THREADS; t++)
+            taken[s] += args[t].first == first;
+    }
+    for (int s = 0; s < THREADS; s++)
+        CHECK(taken[s] == 1, "Every stream id should be used exactly once");
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG thread-local tests\n");
+
+    int result = 0;
+    result |= test_tls_lazy_seed();
+    result |= test_tls_bound_threads();
+    result |= test_tls_unbound_threads();
+
+    if (result == 0) {
+        printf("All thread-local tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,136 @@
+// tests/unit/wide.c
+//
+// Unit tests for the portable N-lane generators (cromulent_x2/x4/x8)
+// Each lane must match the scalar generator, fill() must equal repeated
+// next(), and x4 / x8 must reproduce the AVX2 / AVX-512 streams.
+
+#include "cromulent.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define STEPS 500
+#define SEED 0x243F6A8885A308D3ULL
+
+// Reference model: `lanes` scalar generators seeded like cromulent_avx2_init
+static void reference_stream(int lanes, uint64_t *out, size_t steps) {
+    cromulent_state st[8];
+    uint64_t z = SEED;
+
+    for (int i = 0; i < lanes; i++)
+        st[i].s0 = cromulent_seed_step(&z);
+    for (int i = 0; i < lanes; i++)
+        st[i].s1 = cromulent_seed_step(&z);
+
+    for (size_t i = 0; i < steps * lanes; i++)
+        out[i] = cromulent_next(&st[i % lanes]);
+}
+
+// Test next() and fill() for every lane count against the scalar lanes
+int test_wide_lanes() {
+    printf("Testing x2/x4/x8 against cromulent_next... ");
+
+    static uint64_t expected[STEPS * 8], actual[STEPS * 8];
+
+    cromulent_x2_state x2;
+    reference_stream(2, expected, STEPS);
+    cromulent_x2_init(&x2, SEED);
+    for (int i = 0; i < STEPS; i++)
+        cromulent_x2_next(&x2, actual + 2 * i);
+    CHECK(memcmp(expected, actual, STEPS * 2 * sizeof(uint64_t)) == 0,
+          "x2 next should match the scalar lanes");
+    cromulent_x2_init(&x2, SEED);
+    cromulent_x2_fill(&x2, actual, 7);
+    cromulent_x2_fill(&x2, actual + 14, STEPS - 7);
+    CHECK(memcmp(expected, actual, STEPS * 2 * sizeof(uint64_t)) == 0,
+          "x2 fill should match the scalar lanes");
+
+    cromulent_x4_state x4;
+    reference_stream(4, expected, STEPS);
+    cromulent_x4_init(&x4, SEED);
+    for (int i = 0; i < STEPS; i++)
+        cromulent_x4_next(&x4, actual + 4 * i);
+    CHECK(memcmp(expected, actual, STEPS * 4 * sizeof(uint64_t)) == 0,
+          "x4 next should match the scalar lanes");
+    cromulent_x4_init(&x4, SEED);
+    cromulent_x4_fill(&x4, actual, 7);
+    cromulent_x4_fill(&x4, actual + 28, STEPS - 7);
+    CHECK(memcmp(expected, actual, STEPS * 4 * sizeof(uint64_t)) == 0,
+          "x4 fill should match the scalar lanes");
+
+    cromulent_x8_state x8;
+    reference_stream(8, expected, STEPS);
+    cromulent_x8_init(&x8, SEED);
+    for (int i = 0; i < STEPS; i++)
+        cromulent_x8_next(&x8, actual + 8 * i);
+    CHECK(memcmp(expected, actual, STEPS * 8 * sizeof(uint64_t)) == 0,
+          "x8 next should match the scalar lanes");
+    cromulent_x8_init(&x8, SEED);
+    cromulent_x8_fill(&x8, actual, 7);
+    cromulent_x8_fill(&x8, actual + 56, STEPS - 7);
+    CHECK(memcmp(expected, actual, STEPS * 8 * sizeof(uint64_t)) == 0,
+          "x8 fill should match the scalar lanes");
+
+    printf("OK\n");
+    return 0;
+}
+
+// Test that x4 and x8 reproduce the SIMD generators' lane order
+int test_wide_matches_simd() {
+    printf("Testing x4/x8 against the SIMD generators... ");
+
+#if defined(__x86_64__) || defined(_M_X64)
+    if (cromulent_backend_supported(CROMULENT_BACKEND_AVX2)) {
+        cromulent_x4_state x4;
+        cromulent_avx2_state avx2;
+        cromulent_x4_init(&x4, SEED);
+        cromulent_avx2_init(&avx2, SEED);
+        for (int i = 0; i < STEPS; i++) {
+            uint64_t a[4], b[4];
+            cromulent_x4_next(&x4, a);
+            cromulent_avx2_next_u64(&avx2, b);
+            CHECK(memcmp(a, b, sizeof(a)) == 0, "x4 should match AVX2");
+        }
+    }
+
+    if (cromulent_backend_supported(CROMULENT_BACKEND_AVX512)) {
+        cromulent_x8_state x8;
+        cromulent_avx512_state avx512;
+        cromulent_x8_init(&x8, SEED);
+        cromulent_avx512_init(&avx512, SEED);
+        for (int i = 0; i < STEPS; i++) {
+            uint64_t a[8], b[8];
+            cromulent_x8_next(&x8, a);
+            cromulent_avx512_next_u64(&avx512, b);
+            CHECK(memcmp(a, b, sizeof(a)) == 0, "x8 should match AVX-512");
+        }
+    }
+#endif
+
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG wide-lane tests\n");
+
+    int result = 0;
+    result |= test_wide_lanes();
+    result |= test_wide_matches_simd();
+
+    if (result == 0) {
+        printf("All wide-lane tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}
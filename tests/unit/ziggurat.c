@@ -0,0 +1,270 @@
+// tests/unit/ziggurat.c
+//
+// Unit tests for the ziggurat normal / exponential samplers
+// Checks the fast path against the tables, the bulk fills against a plain
+// model of the algorithm over the word stream on every backend, and the
+// sampled distributions against their CDFs.
+
+#include "cromulent.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// For simplicity, define a check macro that prints error info
+#define CHECK(cond, msg) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at line %d: %s\n", __FILE__, __LINE__, msg); \
+        return 1; \
+    } \
+} while (0)
+
+#define SEED 0x2545F4914F6CDD1DULL
+#define COUNT 5003
+#define SAMPLES 1000000
+
+// Test that single draws take the table fast path and that the slow path is
+// as rare as documented
+int test_zig_fast_path() {
+    printf("Testing the scalar fast path against the tables... ");
+
+    const cromulent_zig_table *tables[] = {&cromulent_zig_normal,
+                                           &cromulent_zig_exponential};
+    const double max_slow[] = {0.02, 0.03};
+
+    for (int d = 0; d < 2; d++) {
+        const cromulent_zig_table *t = tables[d];
+        cromulent_state st, peek;
+        cromulent_init(&st, SEED);
+        int slow = 0;
+
+        for (int i = 0; i < 100000; i++) {
+            peek = st;
+            const uint64_t w = cromulent_next(&peek);
+            const double x = d == 0 ? cromulent_normal(&st)
+                                    : cromulent_exponential(&st);
+            const uint64_t m = w >> 11;
+            if (m < t->k[w & 0xff]) {
+                double expected = (double)m * t->w[w & 0xff];
+                if (d == 0 && (w & 0x100))
+                    expected = -expected;
+                CHECK(x == expected, "Fast path should be m * w[i]");
+                CHECK(st.s0 == peek.s0 && st.s1 == peek.s1,
+                      "Fast path should take exactly one draw");
+            } else {
+                slow++;
+            }
+        }
+        CHECK(slow > 0 && slow < max_slow[d] * 100000,
+              "Slow path should be rare but reachable");
+    }
+
+    printf("OK\n");
+    return 0;
+}
+
+// Model of the sampler over a plain word array, written from the algorithm
+// description
+typedef struct {
+    const uint64_t *w;
+    size_t pos;
+} words;
+
+static double open01(words *s) {
+    return (double)((s->w[s->pos++] >> 11) + 1) * 0x1.0p-53;
+}
+
+static double model_sample(const cromulent_zig_table *t, int normal,
+                           words *s) {
+    for (;;) {
+        const uint64_t w = s->w[s->pos++];
+        const unsigned i = (unsigned)(w & 0xff);
+        const int negative = normal && (w & 0x100);
+        double x = (double)(w >> 11) * t->w[i];
+        if ((w >> 11) < t->k[i])
+            return negative ? -x : x;
+
+        if (i == 0) {
+            if (normal) {
+                double a, b;
+                do {
+                    a = -log(open01(s)) / t->r;
+                    b = -log(open01(s));
+                } while (b + b < a * a);
+                x = t->r + a;
+            } else {
+                x = t->r - log(open01(s));
+            }
+            return negative ? -x : x;
+        }
+
+        const double u = (double)(s->w[s->pos++] >> 11) * 0x1.0p-53;
+        const double y = t->f[i] + u * (t->f[i + 1] - t->f[i]);
+        if (y < (normal ? exp(-0.5 * x * x) : exp(-x)))
+            return negative ? -x : x;
+    }
+}
+
+static const cromulent_backend kBackends[] = {
+    CROMULENT_BACKEND_SCALAR,
+    CROMULENT_BACKEND_AVX2,
+    CROMULENT_BACKEND_AVX512,
+    CROMULENT_BACKEND_NEON,
+};
+
+static void fill(cromulent_bulk_state *st, int normal, double *dst, size_t n) {
+    if (normal)
+        cromulent_fill_normal(st, dst, n);
+    else
+        cromulent_fill_exponential(st, dst, n);
+}
+
+// Test the bulk fills against the model on every backend, in one call and in
+// uneven pieces, and that the stream continues after the last word consumed
+int test_zig_bulk_matches_model() {
+    printf("Testing fill_normal/fill_exponential against the model...");
+
+    static uint64_t stream[2 * COUNT];
+    static double expected[COUNT], actual[COUNT];
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+    cromulent_fill_u64(&st, stream, 2 * COUNT);
+
+    const cromulent_backend original = cromulent_backend_active();
+    for (size_t b = 0; b < sizeof(kBackends) / sizeof(kBackends[0]); b++) {
+        if (cromulent_backend_select(kBackends[b]) != 0)
+            continue;
+        printf(" %s", cromulent_backend_name(kBackends[b]));
+
+        for (int normal = 0; normal <= 1; normal++) {
+            const cromulent_zig_table *t =
+                normal ? &cromulent_zig_normal : &cromulent_zig_exponential;
+            words s = {stream, 0};
+            for (size_t i = 0; i < COUNT; i++)
+                expected[i] = model_sample(t, normal, &s);
+
+            cromulent_bulk_init(&st, SEED);
+            fill(&st, normal, actual, COUNT);
+            CHECK(memcmp(expected, actual, sizeof(actual)) == 0,
+                  "Bulk variates should match the model");
+            uint64_t next;
+            cromulent_fill_u64(&st, &next, 1);
+            CHECK(next == stream[s.pos],
+                  "The stream should resume after the last word consumed");
+
+            static const size_t pieces[] = {1, 15, 16, 17, 300, 2, 1100};
+            cromulent_bulk_init(&st, SEED);
+            size_t done = 0;
+            for (size_t i = 0; done < COUNT; i = (i + 1) % 7) {
+                size_t take = pieces[i] < COUNT - done ? pieces[i]
+                                                       : COUNT - done;
+                fill(&st, normal, actual + done, take);
+                done += take;
+            }
+            CHECK(memcmp(expected, actual, sizeof(actual)) == 0,
+                  "Chunked fills should match one large fill");
+        }
+    }
+    CHECK(cromulent_backend_select(original) == 0,
+          "Restoring the original backend should succeed");
+
+    printf(" OK\n");
+    return 0;
+}
+
+static int compare_double(const void *a, const void *b) {
+    const double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Kolmogorov-Smirnov distance between sorted samples and a CDF
+static double ks_distance(const double *sorted, size_t n,
+                          double (*cdf)(double)) {
+    double d = 0;
+    for (size_t i = 0; i < n; i++) {
+        const double f = cdf(sorted[i]);
+        const double lo = f - (double)i / n, hi = (double)(i + 1) / n - f;
+        if (lo > d)
+            d = lo;
+        if (hi > d)
+            d = hi;
+    }
+    return d;
+}
+
+static double normal_cdf(double x) { return 0.5 * erfc(-x / sqrt(2.0)); }
+
+static double exponential_cdf(double x) { return -expm1(-x); }
+
+// Test the distributions: KS distance, moments and the tail beyond r
+int test_zig_distribution() {
+    printf("Testing normal and exponential distributions... ");
+
+    double *x = malloc(SAMPLES * sizeof(double));
+    CHECK(x != NULL, "Allocation should succeed");
+    cromulent_bulk_state st;
+    cromulent_bulk_init(&st, SEED);
+
+    // The KS bound is the 0.1% critical value; sigma is the standard error
+    const double ks_bound = 1.95 / sqrt((double)SAMPLES);
+    const double sigma = 1.0 / sqrt((double)SAMPLES);
+
+    for (int normal = 0; normal <= 1; normal++) {
+        const double r = normal ? cromulent_zig_normal.r
+                                : cromulent_zig_exponential.r;
+        fill(&st, normal, x, SAMPLES);
+
+        double sum = 0, sum2 = 0;
+        size_t tail = 0;
+        for (size_t i = 0; i < SAMPLES; i++) {
+            sum += x[i];
+            sum2 += x[i] * x[i];
+            tail += fabs(x[i]) > r;
+        }
+        const double mean = sum / SAMPLES;
+        const double var = sum2 / SAMPLES - mean * mean;
+        // P(|X| > r): 2 * (1 - Phi(r)) for the normal, exp(-r) otherwise
+        const double p_tail = normal ? erfc(r / sqrt(2.0)) : exp(-r);
+        const double tail_sd = sqrt(SAMPLES * p_tail);
+
+        if (normal) {
+            CHECK(fabs(mean) < 5 * sigma, "Normal mean should be 0");
+            CHECK(fabs(var - 1.0) < 5 * sqrt(2.0) * sigma,
+                  "Normal variance should be 1");
+        } else {
+            CHECK(fabs(mean - 1.0) < 5 * sigma, "Exponential mean should be 1");
+            CHECK(fabs(var - 1.0) < 5 * sqrt(8.0) * sigma,
+                  "Exponential variance should be 1");
+        }
+        CHECK(fabs(tail - SAMPLES * p_tail) < 5 * tail_sd,
+              "The tail beyond r should have the right mass");
+
+        qsort(x, SAMPLES, sizeof(double), compare_double);
+        const double d =
+            ks_distance(x, SAMPLES, normal ? normal_cdf : exponential_cdf);
+        CHECK(d < ks_bound, "KS distance should be small");
+        if (!normal)
+            CHECK(x[0] >= 0.0, "Exponential variates should be non-negative");
+    }
+
+    free(x);
+    printf("OK\n");
+    return 0;
+}
+
+int main() {
+    printf("Running Cromulent PRNG ziggurat tests\n");
+
+    int result = 0;
+    result |= test_zig_fast_path();
+    result |= test_zig_bulk_matches_model();
+    result |= test_zig_distribution();
+
+    if (result == 0) {
+        printf("All ziggurat tests passed successfully!\n");
+        return 0;
+    } else {
+        printf("Some tests failed!\n");
+        return 1;
+    }
+}